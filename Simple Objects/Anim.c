@@ -0,0 +1,41 @@
+// Anim.c
+// Runs on TM4C123
+// Playback of animations baked on the host into flash.
+
+#include <stdint.h>
+#include "ST7735.h"
+#include "Anim.h"
+
+uint16_t Anim_Play(const Anim *a, uint16_t k){
+	const AnimSpan *p = &a->spans[a->start[k]];
+	const AnimSpan *end = &a->spans[a->start[k + 1]];
+	for(; p < end; p++){
+		ST7735_DrawFastHLine(p->x, p->y, p->w, p->color);
+	}
+	return (k >= a->numFrames) ? 1 : k + 1;
+}
+
+const uint8_t *Anim_PlayClip(const AnimClip *a, const uint8_t *p){
+	uint8_t x, y, n;
+	if(p == 0)
+		p = a->data;
+	while((x = *p++) != ANIM_END){
+		y = *p++;
+		n = *p++;
+		if(n & ANIM_LITERAL){
+			n = (n & ~ANIM_LITERAL) + 1;
+			setAddrWindow(x, y, x + n - 1, y);
+			while(n--){
+				pushColor((p[0] << 8) | p[1]);
+				p += 2;
+			}
+		}
+		else{
+			ST7735_DrawFastHLine(x, y, n + 1, (p[0] << 8) | p[1]);
+			p += 2;
+		}
+	}
+	if(*p == ANIM_LOOP)
+		p = a->data + a->loop;
+	return p;
+}
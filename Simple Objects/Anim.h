@@ -0,0 +1,62 @@
+// Anim.h
+// Runs on TM4C123
+// Playback of animations baked on the host into flash. Each frame is
+// stored as the horizontal runs that differ from the frame before, so
+// playing a looping animation costs no projection or rasterizing, only
+// the SPI traffic for the pixels that actually change.
+// Host/BakeCube.c and Host/BakeLogo.c show how the tables are produced.
+
+#ifndef _ANIMH_
+#define _ANIMH_
+
+#include <stdint.h>
+
+// w pixels of one color starting at (x, y)
+typedef struct {
+	uint8_t x, y, w;
+	uint16_t color;
+} AnimSpan;
+
+// Entry 0 draws the first frame over a cleared screen. Entry k, 1 to
+// numFrames, turns frame k-1 into frame k, and entry numFrames turns the
+// last frame back into the first so playback can loop on entries 1 to
+// numFrames. Entry k is spans[start[k]] up to spans[start[k+1]-1].
+typedef struct {
+	uint16_t numFrames;
+	const uint16_t *start;  // numFrames+2 offsets into spans
+	const AnimSpan *spans;
+} Anim;
+
+//------------Anim_Play------------
+// Send one entry of a baked animation to the screen.
+// Input: a  animation
+//        k  entry to draw, 0 after clearing the screen
+// Output: entry to draw next frame, 1 to numFrames
+uint16_t Anim_Play(const Anim *a, uint16_t k);
+
+// A clip is the same sequence of entries packed as a byte stream, for
+// frames with many colors such as shaded faces. Each entry is a list of
+// runs, one address window each:
+//   x, y, n, hi, lo                fill n+1 pixels with color hi:lo
+//   x, y, 0x80|n, n+1 colors       literal pixels, high byte first
+// An x of ANIM_END closes the entry, so a frame that repeats the one
+// before is a lone ANIM_END. ANIM_LOOP in place of the next entry ends
+// the clip. Host/AnimEncode.c writes clips from the simulated panel.
+#define ANIM_END     0xFF
+#define ANIM_LOOP    0xFE
+#define ANIM_LITERAL 0x80
+
+typedef struct {
+	uint16_t numFrames;
+	uint32_t loop;          // offset of entry 1, where playback wraps to
+	const uint8_t *data;
+} AnimClip;
+
+//------------Anim_PlayClip------------
+// Decode one entry of a clip straight to the screen.
+// Input: a  clip
+//        p  entry to draw, 0 for entry 0 after clearing the screen
+// Output: entry to draw next frame
+const uint8_t *Anim_PlayClip(const AnimClip *a, const uint8_t *p);
+
+#endif
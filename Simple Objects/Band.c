@@ -0,0 +1,236 @@
+// Band.c
+// Runs on TM4C123
+// Off-screen render band with a 16-bit depth buffer.
+
+#include <stdint.h>
+#include "ST7735.h"
+#include "Raster.h"
+#include "Band.h"
+
+static uint16_t BandColor[BAND_ROWS][BAND_W];
+static uint16_t BandZ[BAND_ROWS][BAND_W];
+static int16_t BandTop;
+static int16_t BandL[BAND_ROWS], BandR[BAND_ROWS];
+static const uint8_t *Horizon;
+
+static BandFace Faces[BAND_MAXFACES];
+static uint8_t NumFaces;
+
+// Keep plane gradients small enough that C + A*x + B*y fits in 32 bits
+#define BAND_GRADMAX (1L << 22)
+
+uint16_t Band_Depth(int16_t z){
+	if(z <= 0)
+		return BAND_DEPTHMAX;
+	return BAND_DEPTHMAX / z;
+}
+
+void Band_Begin(int16_t top, uint16_t bg){
+	uint16_t *c = &BandColor[0][0];
+	uint16_t *z = &BandZ[0][0];
+	int16_t i;
+	BandTop = top;
+	for(i = 0; i < BAND_ROWS*BAND_W; i++){
+		c[i] = bg;
+		z[i] = 0;
+	}
+}
+
+void Band_Span(int16_t x, int16_t y, int16_t w, uint16_t color){
+	uint16_t *p;
+	y -= BandTop;
+	if(y < 0 || y >= BAND_ROWS)
+		return;
+	if(x < 0){
+		w += x;
+		x = 0;
+	}
+	if(x + w > BAND_W)
+		w = BAND_W - x;
+	p = &BandColor[y][x];
+	while(w-- > 0)
+		*p++ = color;
+}
+
+// Blend color over band pixel (x, y), screen coordinates, by coverage a
+// out of 255. RGB565 spread as 00000GGGGGG00000RRRRR000000BBBBB leaves
+// room to scale all three channels with one multiply; 5 bits of coverage
+// is as much as the 5 bit channels can show.
+static void blend(int16_t x, int16_t y, uint16_t color, uint8_t a){
+	uint32_t bg, fg, k;
+	uint16_t *p;
+	y -= BandTop;
+	if(x < 0 || x >= BAND_W || y < 0 || y >= BAND_ROWS)
+		return;
+	if(Horizon && y + BandTop > Horizon[x])
+		return;
+	p = &BandColor[y][x];
+	k = (a + 4) >> 3;
+	bg = (*p | ((uint32_t)*p << 16)) & 0x07E0F81F;
+	fg = (color | ((uint32_t)color << 16)) & 0x07E0F81F;
+	bg = ((((fg - bg)*k) >> 5) + bg) & 0x07E0F81F;
+	*p = (uint16_t)(bg | (bg >> 16));
+}
+
+void Band_LineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	int16_t top = BandTop, bottom = BandTop + BAND_ROWS - 1;
+	int16_t t, i, lo, hi, m;
+	int32_t f, step;
+	uint8_t steep, a;
+
+	if((y0 < top && y1 < top) || (y0 > bottom && y1 > bottom))
+		return;
+	if((x0 < 0 && x1 < 0) || (x0 >= BAND_W && x1 >= BAND_W))
+		return;
+	// Walk the major axis, called x here; a steep line swaps x and y
+	steep = (y1 > y0 ? y1 - y0 : y0 - y1) > (x1 > x0 ? x1 - x0 : x0 - x1);
+	if(steep){
+		t = x0; x0 = y0; y0 = t;
+		t = x1; x1 = y1; y1 = t;
+	}
+	if(x0 > x1){
+		t = x0; x0 = x1; x1 = t;
+		t = y0; y0 = y1; y1 = t;
+	}
+	step = (x1 > x0) ? ((int32_t)(y1 - y0) << 16)/(x1 - x0) : 0;
+	lo = x0;
+	hi = x1;
+	if(steep){
+		if(lo < top) lo = top;
+		if(hi > bottom) hi = bottom;
+	}
+	else{
+		if(lo < 0) lo = 0;
+		if(hi > BAND_W - 1) hi = BAND_W - 1;
+		if(step){
+			// Only steps where the line is within a row of the band
+			int32_t s0 = x0 + ((int32_t)(top - 1 - y0) << 16)/step;
+			int32_t s1 = x0 + ((int32_t)(bottom + 1 - y0) << 16)/step;
+			if(s0 > s1){
+				int32_t u = s0; s0 = s1; s1 = u;
+			}
+			if(s0 - 1 > lo) lo = s0 - 1;
+			if(s1 + 1 < hi) hi = s1 + 1;
+		}
+	}
+	f = ((int32_t)y0 << 16) + step*(lo - x0);
+	for(i = lo; i <= hi; i++){
+		m = f >> 16;
+		a = (f >> 8) & 0xFF;	// share of the line on pixel m+1
+		if(steep){
+			blend(m, i, color, 255 - a);
+			if(a)
+				blend(m + 1, i, color, a);
+		}
+		else{
+			blend(i, m, color, 255 - a);
+			if(a)
+				blend(i, m + 1, color, a);
+		}
+		f += step;
+	}
+}
+
+void Band_SetHorizon(const uint8_t *top){
+	Horizon = top;
+}
+
+void Band_Flush(int16_t x0, int16_t x1){
+	int16_t rows = BAND_ROWS;
+	int16_t x, y;
+	if(x0 < 0) x0 = 0;
+	if(x1 >= BAND_W) x1 = BAND_W - 1;
+	if(BandTop + rows > ST7735_TFTHEIGHT)
+		rows = ST7735_TFTHEIGHT - BandTop;
+	if(x0 > x1 || rows <= 0)
+		return;
+	setAddrWindow(x0, BandTop, x1, BandTop + rows - 1);
+	for(y = 0; y < rows; y++){
+		for(x = x0; x <= x1; x++){
+			pushColor(BandColor[y][x]);
+		}
+	}
+}
+
+void Band_ClearFaces(void){
+	NumFaces = 0;
+}
+
+static int32_t clampGrad(int64_t g){
+	if(g > BAND_GRADMAX) return BAND_GRADMAX;
+	if(g < -BAND_GRADMAX) return -BAND_GRADMAX;
+	return (int32_t)g;
+}
+
+uint8_t Band_AddFace(const int16_t *xs, const int16_t *ys, const uint16_t *ds,
+                     uint8_t n, uint16_t color){
+	BandFace *f;
+	int32_t x1, y1, x2, y2, d1, d2, area;
+	uint8_t i;
+
+	if(NumFaces >= BAND_MAXFACES || n < 3 || n > 4)
+		return 0;
+	x1 = xs[1] - xs[0]; y1 = ys[1] - ys[0]; d1 = ds[1] - ds[0];
+	x2 = xs[2] - xs[0]; y2 = ys[2] - ys[0]; d2 = ds[2] - ds[0];
+	area = x1*y2 - x2*y1;
+	if(area == 0)
+		return 0;
+
+	f = &Faces[NumFaces++];
+	f->A = clampGrad(((int64_t)(d1*y2 - d2*y1) << 8) / area);
+	f->B = clampGrad(((int64_t)(d2*x1 - d1*x2) << 8) / area);
+	f->C = ((int32_t)ds[0] << 8) - f->A*xs[0] - f->B*ys[0];
+	f->ymin = f->ymax = ys[0];
+	for(i = 0; i < n; i++){
+		f->xs[i] = xs[i];
+		f->ys[i] = ys[i];
+		if(ys[i] < f->ymin) f->ymin = ys[i];
+		if(ys[i] > f->ymax) f->ymax = ys[i];
+	}
+	f->color = color;
+	f->n = n;
+	return 1;
+}
+
+void Band_FillFace(const BandFace *f){
+	int16_t top = BandTop, bottom = BandTop + BAND_ROWS - 1;
+	int16_t y, x, l, r;
+	int32_t d;
+
+	if(f->ymax < top || f->ymin > bottom)
+		return;
+	if(f->ymin > top) top = f->ymin;
+	if(f->ymax < bottom) bottom = f->ymax;
+	Raster_Extents(f->xs, f->ys, f->n, top, bottom, BandL, BandR);
+	for(y = top; y <= bottom; y++){
+		uint16_t *c = BandColor[y - BandTop];
+		uint16_t *z = BandZ[y - BandTop];
+		l = BandL[y - top];
+		r = BandR[y - top];
+		if(l < 0) l = 0;
+		if(r >= BAND_W) r = BAND_W - 1;
+		d = f->C + f->A*l + f->B*y;
+		for(x = l; x <= r; x++){
+			int32_t zi = d >> 8;
+			if(zi > z[x]){
+				z[x] = zi;
+				c[x] = f->color;
+			}
+			d += f->A;
+		}
+	}
+}
+
+void Band_Render(int16_t ymin, int16_t ymax, uint16_t bg){
+	int16_t top;
+	uint8_t i;
+	if(ymin < 0) ymin = 0;
+	if(ymax >= ST7735_TFTHEIGHT) ymax = ST7735_TFTHEIGHT - 1;
+	for(top = ymin - (ymin % BAND_ROWS); top <= ymax; top += BAND_ROWS){
+		Band_Begin(top, bg);
+		for(i = 0; i < NumFaces; i++){
+			Band_FillFace(&Faces[i]);
+		}
+		Band_Flush(0, BAND_W - 1);
+	}
+}
@@ -0,0 +1,88 @@
+// Camera.h
+// Runs on TM4C123
+// Pinhole camera shared by every renderer. Holds the camera position,
+// its turn about the vertical axis, the focal length and the screen
+// point the view axis passes through. Camera_Begin derives the rotation
+// and a table of focal/z reciprocals once per frame, so projecting a
+// point is two multiplies and no divide.
+
+#ifndef _CAMERAH_
+#define _CAMERAH_
+
+#include <stdint.h>
+#include "Trig.h"
+
+// Deepest view z served from the reciprocal table, farther points divide
+#define CAMERA_MAXZ   255
+
+// Fraction bits of the reciprocal table
+#define CAMERA_RECIPQ 12
+
+// 1 projects with the FPU in Camera_Project, 0 with the reciprocal table
+#ifndef CAMERA_FLOAT
+#define CAMERA_FLOAT  0
+#endif
+
+typedef struct {
+	int16_t x, y, z;        // position in world units
+	uint16_t yaw;           // turn about the vertical axis in TRIG_STEPS per turn
+	int16_t focal;          // pixels per world unit at unit depth
+	int16_t cx, cy;         // screen point of the view axis
+	// Derived by Camera_Begin
+	int16_t sinYaw, cosYaw;
+	int16_t recipFocal;     // focal the table was built for, 0 if never
+	int32_t recip[CAMERA_MAXZ + 1];
+} Camera;
+
+//------------Camera_Init------------
+// Place a camera looking down +z with no turn.
+// Input: c        camera
+//        x, y, z  position
+//        focal    projection scale
+//        cx, cy   screen point of the view axis
+// Output: none
+void Camera_Init(Camera *c, int16_t x, int16_t y, int16_t z, int16_t focal,
+                 int16_t cx, int16_t cy);
+
+//------------Camera_Begin------------
+// Recompute the per-frame view terms after moving or turning the camera.
+// The reciprocal table is only rebuilt when the focal length changed.
+// Input: c  camera
+// Output: none
+void Camera_Begin(Camera *c);
+
+//------------Camera_View------------
+// Move a world point into camera space.
+// Input: c        camera, after Camera_Begin
+//        x, y, z  world point
+//        v        receives the camera space x, y, z
+// Output: none
+void Camera_View(const Camera *c, int16_t x, int16_t y, int16_t z, int16_t *v);
+
+//------------Camera_Project------------
+// Project a world point onto the screen.
+// Input: c        camera, after Camera_Begin
+//        x, y, z  world point
+//        sx, sy   receive the screen position
+// Output: camera space depth, clamped to at least 1
+int16_t Camera_Project(const Camera *c, int16_t x, int16_t y, int16_t z,
+                       int16_t *sx, int16_t *sy);
+
+//------------Camera_ProjectFloat------------
+// Camera_Project done in single precision float with a true divide and
+// rounding to the nearest pixel. This is the CAMERA_FLOAT path, kept
+// callable either way so the two can be compared.
+// Input: as Camera_Project
+// Output: camera space depth, clamped to at least 1
+int16_t Camera_ProjectFloat(const Camera *c, int16_t x, int16_t y, int16_t z,
+                            int16_t *sx, int16_t *sy);
+
+//------------Camera_Scale------------
+// Screen length of a camera space length at a given depth.
+// Input: c    camera, after Camera_Begin
+//        len  length in world units
+//        z    camera space depth, at least 1
+// Output: length in pixels
+int16_t Camera_Scale(const Camera *c, int16_t len, int16_t z);
+
+#endif
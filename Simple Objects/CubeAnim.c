@@ -0,0 +1,600 @@
+// CubeAnim.c
+// Runs on TM4C123
+// Generated by Host/BakeCube.c, do not edit.
+
+#include <stdint.h>
+#include "Anim.h"
+#include "CubeAnim.h"
+
+static const AnimSpan CubeSpans[] = {
+	{59,86,10,0xFFFF},{54,87,5,0xFFFF},{69,87,6,0xFFFF},{54,88,1,0xFFFF},{56,88,2,0xFFFF},{72,88,3,0xFFFF},
+	{54,89,1,0xFFFF},{58,89,2,0xFFFF},{70,89,2,0xFFFF},{74,89,1,0xFFFF},{54,90,1,0xFFFF},{60,90,2,0xFFFF},
+	{68,90,2,0xFFFF},{74,90,1,0xFFFF},{54,91,1,0xFFFF},{62,91,2,0xFFFF},{66,91,2,0xFFFF},{74,91,1,0xFFFF},
+	{54,92,1,0xFFFF},{64,92,2,0xFFFF},{74,92,1,0xFFFF},{54,93,1,0xFFFF},{64,93,1,0xFFFF},{74,93,1,0xFFFF},
+	{54,94,1,0xFFFF},{64,94,1,0xFFFF},{74,94,1,0xFFFF},{54,95,1,0xFFFF},{64,95,1,0xFFFF},{74,95,1,0xFFFF},
+	{54,96,1,0xFFFF},{64,96,1,0xFFFF},{74,96,1,0xFFFF},{54,97,1,0xFFFF},{64,97,1,0xFFFF},{74,97,1,0xFFFF},
+	{54,98,1,0xFFFF},{64,98,1,0xFFFF},{74,98,1,0xFFFF},{54,99,1,0xFFFF},{64,99,1,0xFFFF},{74,99,1,0xFFFF},
+	{54,100,1,0xFFFF},{64,100,1,0xFFFF},{74,100,1,0xFFFF},{54,101,1,0xFFFF},{64,101,1,0xFFFF},{74,101,1,0xFFFF},
+	{54,102,1,0xFFFF},{64,102,1,0xFFFF},{74,102,1,0xFFFF},{55,103,1,0xFFFF},{64,103,1,0xFFFF},{73,103,1,0xFFFF},
+	{55,104,1,0xFFFF},{64,104,1,0xFFFF},{73,104,1,0xFFFF},{56,105,1,0xFFFF},{64,105,1,0xFFFF},{72,105,1,0xFFFF},
+	{57,106,1,0xFFFF},{64,106,1,0xFFFF},{71,106,1,0xFFFF},{58,107,1,0xFFFF},{64,107,1,0xFFFF},{70,107,1,0xFFFF},
+	{58,108,1,0xFFFF},{64,108,1,0xFFFF},{70,108,1,0xFFFF},{59,109,1,0xFFFF},{64,109,1,0xFFFF},{69,109,1,0xFFFF},
+	{60,110,1,0xFFFF},{64,110,1,0xFFFF},{68,110,1,0xFFFF},{60,111,1,0xFFFF},{64,111,1,0xFFFF},{68,111,1,0xFFFF},
+	{61,112,1,0xFFFF},{64,112,1,0xFFFF},{67,112,1,0xFFFF},{62,113,1,0xFFFF},{64,113,1,0xFFFF},{66,113,1,0xFFFF},
+	{63,114,3,0xFFFF},{63,115,3,0xFFFF},{64,116,1,0xFFFF},{59,86,1,0x0000},{68,86,1,0x0000},{59,87,1,0xFFFF},
+	{68,87,1,0xFFFF},{74,87,1,0x0000},{55,88,1,0xFFFF},{57,88,1,0x0000},{72,88,2,0x0000},{75,88,2,0xFFFF},
+	{57,89,1,0xFFFF},{59,89,1,0x0000},{70,89,1,0x0000},{72,89,2,0xFFFF},{76,89,1,0xFFFF},{59,90,1,0xFFFF},
+	{60,90,2,0x0000},{70,90,1,0xFFFF},{74,90,1,0x0000},{76,90,1,0xFFFF},{60,91,2,0xFFFF},{62,91,2,0x0000},
+	{64,91,2,0xFFFF},{74,91,1,0x0000},{76,91,1,0xFFFF},{62,92,2,0xFFFF},{64,92,2,0x0000},{74,92,1,0x0000},
+	{76,92,1,0xFFFF},{62,93,1,0xFFFF},{64,93,1,0x0000},{74,93,1,0x0000},{76,93,1,0xFFFF},{62,94,1,0xFFFF},
+	{64,94,1,0x0000},{74,94,1,0x0000},{76,94,1,0xFFFF},{62,95,1,0xFFFF},{64,95,1,0x0000},{74,95,1,0x0000},
+	{76,95,1,0xFFFF},{62,96,1,0xFFFF},{64,96,1,0x0000},{74,96,1,0x0000},{76,96,1,0xFFFF},{62,97,1,0xFFFF},
+	{64,97,1,0x0000},{74,97,1,0x0000},{76,97,1,0xFFFF},{62,98,1,0xFFFF},{64,98,1,0x0000},{74,98,1,0x0000},
+	{76,98,1,0xFFFF},{62,99,1,0xFFFF},{64,99,1,0x0000},{74,99,1,0x0000},{76,99,1,0xFFFF},{62,100,1,0xFFFF},
+	{64,100,1,0x0000},{74,100,1,0x0000},{76,100,1,0xFFFF},{62,101,1,0xFFFF},{64,101,1,0x0000},{74,101,1,0x0000},
+	{76,101,1,0xFFFF},{62,102,1,0xFFFF},{64,102,1,0x0000},{74,102,1,0x0000},{76,102,1,0xFFFF},{62,103,1,0xFFFF},
+	{64,103,1,0x0000},{73,103,1,0x0000},{76,103,1,0xFFFF},{62,104,1,0xFFFF},{64,104,1,0x0000},{73,104,1,0x0000},
+	{76,104,1,0xFFFF},{62,105,1,0xFFFF},{64,105,1,0x0000},{72,105,1,0x0000},{76,105,1,0xFFFF},{56,106,1,0xFFFF},
+	{57,106,1,0x0000},{62,106,1,0xFFFF},{64,106,1,0x0000},{71,106,1,0x0000},{75,106,1,0xFFFF},{57,107,1,0xFFFF},
+	{58,107,1,0x0000},{62,107,1,0xFFFF},{64,107,7,0x0000},{73,107,2,0xFFFF},{57,108,1,0xFFFF},{58,108,1,0x0000},
+	{62,108,1,0xFFFF},{64,108,7,0x0000},{72,108,1,0xFFFF},{58,109,1,0xFFFF},{59,109,1,0x0000},{62,109,1,0xFFFF},
+	{64,109,6,0x0000},{71,109,1,0xFFFF},{59,110,1,0xFFFF},{60,110,1,0x0000},{62,110,1,0xFFFF},{64,110,5,0x0000},
+	{70,110,1,0xFFFF},{59,111,1,0xFFFF},{60,111,1,0x0000},{62,111,1,0xFFFF},{64,111,1,0x0000},{69,111,1,0xFFFF},
+	{60,112,1,0xFFFF},{61,112,1,0x0000},{62,112,1,0xFFFF},{64,112,1,0x0000},{60,113,1,0xFFFF},{64,113,1,0x0000},
+	{61,114,2,0xFFFF},{63,114,1,0x0000},{61,115,2,0xFFFF},{64,115,2,0x0000},{62,116,1,0xFFFF},{64,116,1,0x0000},
+	{56,86,4,0xFFFF},{68,86,1,0xFFFF},{54,87,2,0x0000},{57,87,3,0x0000},{68,87,1,0x0000},{73,87,1,0x0000},
+	{54,88,2,0x0000},{72,88,2,0xFFFF},{75,88,2,0x0000},{54,89,1,0x0000},{56,89,1,0xFFFF},{57,89,2,0x0000},
+	{68,89,3,0xFFFF},{72,89,2,0x0000},{76,89,1,0x0000},{54,90,1,0x0000},{56,90,2,0xFFFF},{59,90,1,0x0000},
+	{64,90,4,0xFFFF},{68,90,3,0x0000},{74,90,1,0xFFFF},{76,90,1,0x0000},{54,91,1,0x0000},{56,91,2,0xFFFF},
+	{62,91,2,0xFFFF},{64,91,4,0x0000},{74,91,1,0xFFFF},{76,91,1,0x0000},{54,92,1,0x0000},{56,92,4,0xFFFF},
+	{62,92,2,0x0000},{74,92,1,0xFFFF},{76,92,1,0x0000},{54,93,1,0x0000},{56,93,2,0xFFFF},{62,93,1,0x0000},
+	{74,93,1,0xFFFF},{76,93,1,0x0000},{54,94,1,0x0000},{56,94,2,0xFFFF},{62,94,1,0x0000},{74,94,1,0xFFFF},
+	{76,94,1,0x0000},{54,95,1,0x0000},{56,95,2,0xFFFF},{62,95,1,0x0000},{74,95,1,0xFFFF},{76,95,1,0x0000},
+	{54,96,1,0x0000},{56,96,2,0xFFFF},{62,96,1,0x0000},{74,96,1,0xFFFF},{76,96,1,0x0000},{54,97,1,0x0000},
+	{56,97,2,0xFFFF},{62,97,1,0x0000},{74,97,1,0xFFFF},{76,97,1,0x0000},{54,98,1,0x0000},{56,98,2,0xFFFF},
+	{62,98,1,0x0000},{74,98,1,0xFFFF},{76,98,1,0x0000},{54,99,1,0x0000},{56,99,2,0xFFFF},{62,99,1,0x0000},
+	{74,99,1,0xFFFF},{76,99,1,0x0000},{54,100,1,0x0000},{56,100,2,0xFFFF},{62,100,1,0x0000},{74,100,1,0xFFFF},
+	{76,100,1,0x0000},{54,101,1,0x0000},{56,101,2,0xFFFF},{62,101,1,0x0000},{74,101,1,0xFFFF},{76,101,1,0x0000},
+	{54,102,1,0x0000},{56,102,2,0xFFFF},{62,102,1,0x0000},{74,102,1,0xFFFF},{76,102,1,0x0000},{55,103,1,0x0000},
+	{56,103,2,0xFFFF},{62,103,1,0x0000},{74,103,1,0xFFFF},{76,103,1,0x0000},{55,104,1,0x0000},{56,104,2,0xFFFF},
+	{62,104,1,0x0000},{74,104,1,0xFFFF},{76,104,1,0x0000},{57,105,1,0xFFFF},{62,105,1,0x0000},{74,105,1,0xFFFF},
+	{76,105,1,0x0000},{57,106,1,0xFFFF},{62,106,1,0x0000},{72,106,2,0xFFFF},{75,106,1,0x0000},{56,107,1,0xFFFF},
+	{62,107,1,0x0000},{71,107,1,0xFFFF},{73,107,2,0x0000},{56,108,1,0xFFFF},{62,108,1,0x0000},{69,108,2,0xFFFF},
+	{72,108,1,0x0000},{57,109,1,0xFFFF},{58,109,5,0x0000},{68,109,1,0xFFFF},{71,109,1,0x0000},{57,110,1,0xFFFF},
+	{59,110,4,0x0000},{66,110,2,0xFFFF},{70,110,1,0x0000},{57,111,1,0xFFFF},{59,111,4,0x0000},{64,111,2,0xFFFF},
+	{68,111,2,0x0000},{57,112,1,0xFFFF},{60,112,3,0x0000},{63,112,1,0xFFFF},{67,112,1,0x0000},{57,113,1,0xFFFF},
+	{60,113,1,0x0000},{61,113,1,0xFFFF},{66,113,1,0x0000},{57,114,1,0xFFFF},{60,114,1,0xFFFF},{61,114,5,0x0000},
+	{57,115,3,0xFFFF},{61,115,3,0x0000},{57,116,1,0xFFFF},{62,116,1,0x0000},{71,87,2,0x0000},{71,88,1,0xFFFF},
+	{73,88,2,0x0000},{68,89,4,0x0000},{73,89,1,0xFFFF},{58,90,19,0xFFFF},{57,91,7,0x0000},{74,91,1,0x0000},
+	{76,91,1,0xFFFF},{57,92,3,0x0000},{74,92,1,0x0000},{76,92,1,0xFFFF},{57,93,1,0x0000},{74,93,1,0x0000},
+	{76,93,1,0xFFFF},{57,94,1,0x0000},{74,94,1,0x0000},{76,94,1,0xFFFF},{57,95,1,0x0000},{74,95,1,0x0000},
+	{76,95,1,0xFFFF},{57,96,1,0x0000},{74,96,1,0x0000},{76,96,1,0xFFFF},{57,97,1,0x0000},{74,97,1,0x0000},
+	{76,97,1,0xFFFF},{57,98,1,0x0000},{74,98,1,0x0000},{76,98,1,0xFFFF},{57,99,1,0x0000},{74,99,1,0x0000},
+	{76,99,1,0xFFFF},{57,100,1,0x0000},{74,100,1,0x0000},{76,100,1,0xFFFF},{57,101,1,0x0000},{74,101,1,0x0000},
+	{76,101,1,0xFFFF},{57,102,1,0x0000},{74,102,1,0x0000},{76,102,1,0xFFFF},{57,103,1,0x0000},{74,103,1,0x0000},
+	{76,103,1,0xFFFF},{57,104,1,0x0000},{74,104,1,0x0000},{76,104,1,0xFFFF},{57,105,1,0x0000},{74,105,1,0x0000},
+	{76,105,1,0xFFFF},{57,106,1,0x0000},{72,106,2,0x0000},{76,106,1,0xFFFF},{57,107,1,0x0000},{71,107,1,0x0000},
+	{76,107,1,0xFFFF},{57,108,1,0x0000},{69,108,2,0x0000},{76,108,1,0xFFFF},{56,109,1,0xFFFF},{57,109,1,0x0000},
+	{68,109,1,0x0000},{76,109,1,0xFFFF},{56,110,21,0xFFFF},{57,111,1,0x0000},{64,111,2,0x0000},{57,112,7,0x0000},
+	{57,113,6,0x0000},{57,114,4,0x0000},{57,115,3,0x0000},{57,116,1,0x0000},{56,86,2,0x0000},{69,86,2,0xFFFF},
+	{56,87,1,0x0000},{57,87,1,0xFFFF},{69,87,2,0x0000},{71,87,1,0xFFFF},{71,88,1,0x0000},{55,89,1,0xFFFF},
+	{56,89,1,0x0000},{74,89,1,0x0000},{54,90,2,0xFFFF},{75,90,2,0x0000},{54,91,1,0xFFFF},{56,91,1,0x0000},
+	{74,91,1,0xFFFF},{76,91,1,0x0000},{54,92,1,0xFFFF},{56,92,1,0x0000},{74,92,1,0xFFFF},{76,92,1,0x0000},
+	{54,93,1,0xFFFF},{56,93,1,0x0000},{74,93,1,0xFFFF},{76,93,1,0x0000},{54,94,1,0xFFFF},{56,94,1,0x0000},
+	{74,94,1,0xFFFF},{76,94,1,0x0000},{54,95,1,0xFFFF},{56,95,1,0x0000},{74,95,1,0xFFFF},{76,95,1,0x0000},
+	{54,96,1,0xFFFF},{56,96,1,0x0000},{74,96,1,0xFFFF},{76,96,1,0x0000},{54,97,1,0xFFFF},{56,97,1,0x0000},
+	{74,97,1,0xFFFF},{76,97,1,0x0000},{54,98,1,0xFFFF},{56,98,1,0x0000},{74,98,1,0xFFFF},{76,98,1,0x0000},
+	{54,99,1,0xFFFF},{56,99,1,0x0000},{74,99,1,0xFFFF},{76,99,1,0x0000},{54,100,1,0xFFFF},{56,100,1,0x0000},
+	{74,100,1,0xFFFF},{76,100,1,0x0000},{54,101,1,0xFFFF},{56,101,1,0x0000},{74,101,1,0xFFFF},{76,101,1,0x0000},
+	{54,102,1,0xFFFF},{56,102,1,0x0000},{74,102,1,0xFFFF},{76,102,1,0x0000},{54,103,1,0xFFFF},{56,103,1,0x0000},
+	{74,103,1,0xFFFF},{76,103,1,0x0000},{54,104,1,0xFFFF},{56,104,1,0x0000},{74,104,1,0xFFFF},{76,104,1,0x0000},
+	{54,105,1,0xFFFF},{56,105,1,0x0000},{74,105,1,0xFFFF},{76,105,1,0x0000},{54,106,1,0xFFFF},{56,106,1,0x0000},
+	{74,106,1,0xFFFF},{76,106,1,0x0000},{54,107,1,0xFFFF},{56,107,1,0x0000},{74,107,1,0xFFFF},{76,107,1,0x0000},
+	{54,108,1,0xFFFF},{56,108,1,0x0000},{74,108,1,0xFFFF},{76,108,1,0x0000},{54,109,1,0xFFFF},{56,109,1,0x0000},
+	{74,109,1,0xFFFF},{76,109,1,0x0000},{54,110,2,0xFFFF},{75,110,2,0x0000},{58,86,1,0x0000},{71,86,2,0xFFFF},
+	{58,87,1,0xFFFF},{71,87,1,0x0000},{72,87,1,0xFFFF},{55,88,1,0xFFFF},{53,89,2,0xFFFF},{55,89,1,0x0000},
+	{72,89,1,0xFFFF},{73,89,1,0x0000},{52,90,2,0xFFFF},{73,90,2,0x0000},{52,91,1,0xFFFF},{54,91,1,0x0000},
+	{72,91,1,0xFFFF},{74,91,1,0x0000},{52,92,1,0xFFFF},{54,92,1,0x0000},{72,92,1,0xFFFF},{74,92,1,0x0000},
+	{52,93,1,0xFFFF},{54,93,1,0x0000},{72,93,1,0xFFFF},{74,93,1,0x0000},{52,94,1,0xFFFF},{54,94,1,0x0000},
+	{72,94,1,0xFFFF},{74,94,1,0x0000},{52,95,1,0xFFFF},{54,95,1,0x0000},{72,95,1,0xFFFF},{74,95,1,0x0000},
+	{52,96,1,0xFFFF},{54,96,1,0x0000},{72,96,1,0xFFFF},{74,96,1,0x0000},{52,97,1,0xFFFF},{54,97,1,0x0000},
+	{72,97,1,0xFFFF},{74,97,1,0x0000},{52,98,1,0xFFFF},{54,98,1,0x0000},{72,98,1,0xFFFF},{74,98,1,0x0000},
+	{52,99,1,0xFFFF},{54,99,1,0x0000},{72,99,1,0xFFFF},{74,99,1,0x0000},{52,100,1,0xFFFF},{54,100,1,0x0000},
+	{72,100,1,0xFFFF},{74,100,1,0x0000},{52,101,1,0xFFFF},{54,101,1,0x0000},{72,101,1,0xFFFF},{74,101,1,0x0000},
+	{52,102,1,0xFFFF},{54,102,1,0x0000},{72,102,1,0xFFFF},{74,102,1,0x0000},{52,103,1,0xFFFF},{54,103,1,0x0000},
+	{72,103,1,0xFFFF},{74,103,1,0x0000},{52,104,1,0xFFFF},{54,104,1,0x0000},{72,104,1,0xFFFF},{74,104,1,0x0000},
+	{52,105,1,0xFFFF},{54,105,1,0x0000},{72,105,1,0xFFFF},{74,105,1,0x0000},{52,106,1,0xFFFF},{54,106,1,0x0000},
+	{72,106,1,0xFFFF},{74,106,1,0x0000},{52,107,1,0xFFFF},{54,107,1,0x0000},{72,107,1,0xFFFF},{74,107,1,0x0000},
+	{52,108,1,0xFFFF},{54,108,1,0x0000},{72,108,1,0xFFFF},{74,108,1,0x0000},{52,109,1,0xFFFF},{54,109,1,0x0000},
+	{72,109,1,0xFFFF},{74,109,1,0x0000},{52,110,2,0xFFFF},{73,110,2,0x0000},{59,86,1,0x0000},{56,87,4,0xFFFF},
+	{54,88,1,0xFFFF},{53,89,1,0x0000},{57,89,4,0xFFFF},{71,89,1,0xFFFF},{52,90,2,0x0000},{55,90,6,0x0000},
+	{65,90,6,0x0000},{52,91,1,0x0000},{54,91,1,0xFFFF},{65,91,4,0xFFFF},{71,91,1,0xFFFF},{52,92,1,0x0000},
+	{54,92,1,0xFFFF},{69,92,3,0xFFFF},{52,93,1,0x0000},{54,93,1,0xFFFF},{71,93,1,0xFFFF},{52,94,1,0x0000},
+	{54,94,1,0xFFFF},{71,94,1,0xFFFF},{52,95,1,0x0000},{54,95,1,0xFFFF},{71,95,1,0xFFFF},{52,96,1,0x0000},
+	{54,96,1,0xFFFF},{71,96,1,0xFFFF},{52,97,1,0x0000},{54,97,1,0xFFFF},{71,97,1,0xFFFF},{52,98,1,0x0000},
+	{54,98,1,0xFFFF},{71,98,1,0xFFFF},{52,99,1,0x0000},{54,99,1,0xFFFF},{71,99,1,0xFFFF},{52,100,1,0x0000},
+	{54,100,1,0xFFFF},{71,100,1,0xFFFF},{52,101,1,0x0000},{54,101,1,0xFFFF},{71,101,1,0xFFFF},{52,102,1,0x0000},
+	{54,102,1,0xFFFF},{71,102,1,0xFFFF},{52,103,1,0x0000},{54,103,1,0xFFFF},{71,103,1,0xFFFF},{52,104,1,0x0000},
+	{54,104,1,0xFFFF},{71,104,1,0xFFFF},{52,105,1,0x0000},{54,105,1,0xFFFF},{71,105,1,0xFFFF},{52,106,1,0x0000},
+	{55,106,2,0xFFFF},{71,106,1,0xFFFF},{52,107,1,0x0000},{57,107,1,0xFFFF},{71,107,1,0xFFFF},{52,108,1,0x0000},
+	{58,108,2,0xFFFF},{71,108,1,0xFFFF},{72,108,1,0x0000},{52,109,1,0x0000},{60,109,1,0xFFFF},{71,109,1,0xFFFF},
+	{72,109,1,0x0000},{52,110,9,0x0000},{63,110,8,0x0000},{72,110,1,0x0000},{63,111,2,0xFFFF},{71,111,1,0xFFFF},
+	{65,112,1,0xFFFF},{71,112,1,0xFFFF},{66,113,2,0xFFFF},{71,113,1,0xFFFF},{68,114,1,0xFFFF},{71,114,1,0xFFFF},
+	{69,115,3,0xFFFF},{71,116,1,0xFFFF},{60,86,1,0x0000},{69,86,4,0x0000},{55,87,6,0xFFFF},{69,87,6,0xFFFF},
+	{52,88,2,0xFFFF},{55,88,2,0x0000},{73,88,2,0xFFFF},{52,89,1,0xFFFF},{55,89,2,0xFFFF},{58,89,3,0x0000},
+	{72,89,1,0x0000},{74,89,1,0xFFFF},{52,90,1,0xFFFF},{54,90,1,0x0000},{58,90,3,0xFFFF},{61,90,4,0x0000},
+	{69,90,2,0xFFFF},{71,90,2,0x0000},{74,90,1,0xFFFF},{52,91,1,0xFFFF},{54,91,1,0x0000},{61,91,4,0xFFFF},
+	{65,91,2,0x0000},{71,91,2,0x0000},{74,91,1,0xFFFF},{52,92,1,0xFFFF},{54,92,1,0x0000},{65,92,2,0xFFFF},
+	{69,92,4,0x0000},{74,92,1,0xFFFF},{52,93,1,0xFFFF},{54,93,1,0x0000},{66,93,1,0xFFFF},{71,93,2,0x0000},
+	{74,93,1,0xFFFF},{52,94,1,0xFFFF},{54,94,1,0x0000},{66,94,1,0xFFFF},{71,94,2,0x0000},{74,94,1,0xFFFF},
+	{52,95,1,0xFFFF},{54,95,1,0x0000},{66,95,1,0xFFFF},{71,95,2,0x0000},{74,95,1,0xFFFF},{52,96,1,0xFFFF},
+	{54,96,1,0x0000},{66,96,1,0xFFFF},{71,96,2,0x0000},{74,96,1,0xFFFF},{52,97,1,0xFFFF},{54,97,1,0x0000},
+	{66,97,1,0xFFFF},{71,97,2,0x0000},{74,97,1,0xFFFF},{52,98,1,0xFFFF},{54,98,1,0x0000},{66,98,1,0xFFFF},
+	{71,98,2,0x0000},{74,98,1,0xFFFF},{52,99,1,0xFFFF},{54,99,1,0x0000},{66,99,1,0xFFFF},{71,99,2,0x0000},
+	{74,99,1,0xFFFF},{52,100,1,0xFFFF},{54,100,1,0x0000},{66,100,1,0xFFFF},{71,100,2,0x0000},{74,100,1,0xFFFF},
+	{52,101,1,0xFFFF},{54,101,1,0x0000},{66,101,1,0xFFFF},{71,101,2,0x0000},{74,101,1,0xFFFF},{52,102,1,0xFFFF},
+	{54,102,1,0x0000},{66,102,1,0xFFFF},{71,102,2,0x0000},{74,102,1,0xFFFF},{52,103,1,0xFFFF},{54,103,1,0x0000},
+	{66,103,1,0xFFFF},{71,103,2,0x0000},{73,103,1,0xFFFF},{52,104,1,0xFFFF},{54,104,1,0x0000},{66,104,1,0xFFFF},
+	{71,104,2,0x0000},{73,104,1,0xFFFF},{52,105,1,0xFFFF},{54,105,1,0x0000},{66,105,1,0xFFFF},{71,105,1,0x0000},
+	{53,106,1,0xFFFF},{55,106,2,0x0000},{66,106,1,0xFFFF},{71,106,1,0x0000},{54,107,2,0xFFFF},{57,107,1,0x0000},
+	{66,107,1,0xFFFF},{72,107,1,0x0000},{56,108,1,0xFFFF},{58,108,2,0x0000},{66,108,1,0xFFFF},{57,109,1,0xFFFF},
+	{60,109,1,0x0000},{66,109,1,0xFFFF},{70,109,1,0xFFFF},{71,109,1,0x0000},{58,110,2,0xFFFF},{61,110,2,0x0000},
+	{66,110,1,0xFFFF},{69,110,1,0xFFFF},{71,110,1,0x0000},{60,111,1,0xFFFF},{63,111,2,0x0000},{66,111,1,0xFFFF},
+	{69,111,1,0xFFFF},{71,111,1,0x0000},{61,112,1,0xFFFF},{65,112,1,0x0000},{66,112,1,0xFFFF},{68,112,1,0xFFFF},
+	{71,112,1,0x0000},{62,113,1,0xFFFF},{67,113,1,0x0000},{68,113,1,0xFFFF},{71,113,1,0x0000},{63,114,2,0xFFFF},
+	{66,114,2,0xFFFF},{68,114,4,0x0000},{65,115,3,0xFFFF},{69,115,3,0x0000},{66,116,1,0xFFFF},{71,116,1,0x0000},
+	{59,86,2,0xFFFF},{54,87,1,0xFFFF},{59,87,2,0x0000},{52,88,2,0x0000},{56,88,2,0xFFFF},{52,89,1,0x0000},
+	{55,89,3,0x0000},{58,89,2,0xFFFF},{70,89,1,0xFFFF},{52,90,1,0x0000},{54,90,1,0xFFFF},{58,90,2,0x0000},
+	{61,90,1,0xFFFF},{68,90,1,0xFFFF},{70,90,1,0x0000},{52,91,1,0x0000},{54,91,1,0xFFFF},{61,91,1,0x0000},
+	{64,91,1,0x0000},{66,91,1,0xFFFF},{68,91,1,0x0000},{52,92,1,0x0000},{54,92,1,0xFFFF},{64,92,1,0xFFFF},
+	{66,92,1,0x0000},{52,93,1,0x0000},{54,93,1,0xFFFF},{64,93,1,0xFFFF},{66,93,1,0x0000},{52,94,1,0x0000},
+	{54,94,1,0xFFFF},{64,94,1,0xFFFF},{66,94,1,0x0000},{52,95,1,0x0000},{54,95,1,0xFFFF},{64,95,1,0xFFFF},
+	{66,95,1,0x0000},{52,96,1,0x0000},{54,96,1,0xFFFF},{64,96,1,0xFFFF},{66,96,1,0x0000},{52,97,1,0x0000},
+	{54,97,1,0xFFFF},{64,97,1,0xFFFF},{66,97,1,0x0000},{52,98,1,0x0000},{54,98,1,0xFFFF},{64,98,1,0xFFFF},
+	{66,98,1,0x0000},{52,99,1,0x0000},{54,99,1,0xFFFF},{64,99,1,0xFFFF},{66,99,1,0x0000},{52,100,1,0x0000},
+	{54,100,1,0xFFFF},{64,100,1,0xFFFF},{66,100,1,0x0000},{52,101,1,0x0000},{54,101,1,0xFFFF},{64,101,1,0xFFFF},
+	{66,101,1,0x0000},{52,102,1,0x0000},{54,102,1,0xFFFF},{64,102,1,0xFFFF},{66,102,1,0x0000},{52,103,1,0x0000},
+	{55,103,1,0xFFFF},{64,103,1,0xFFFF},{66,103,1,0x0000},{52,104,1,0x0000},{55,104,1,0xFFFF},{64,104,1,0xFFFF},
+	{66,104,1,0x0000},{52,105,1,0x0000},{56,105,1,0xFFFF},{64,105,1,0xFFFF},{66,105,1,0x0000},{53,106,1,0x0000},
+	{57,106,1,0xFFFF},{64,106,1,0xFFFF},{66,106,1,0x0000},{71,106,1,0xFFFF},{72,106,1,0x0000},{54,107,2,0x0000},
+	{58,107,1,0xFFFF},{64,107,1,0xFFFF},{66,107,1,0x0000},{70,107,1,0xFFFF},{71,107,1,0x0000},{56,108,1,0x0000},
+	{58,108,1,0xFFFF},{64,108,1,0xFFFF},{66,108,1,0x0000},{70,108,1,0xFFFF},{71,108,1,0x0000},{57,109,1,0x0000},
+	{59,109,1,0xFFFF},{64,109,1,0xFFFF},{66,109,1,0x0000},{69,109,1,0xFFFF},{70,109,1,0x0000},{58,110,2,0x0000},
+	{60,110,1,0xFFFF},{64,110,1,0xFFFF},{66,110,1,0x0000},{68,110,1,0xFFFF},{69,110,1,0x0000},{64,111,1,0xFFFF},
+	{66,111,1,0x0000},{68,111,1,0xFFFF},{69,111,1,0x0000},{64,112,1,0xFFFF},{66,112,1,0x0000},{67,112,1,0xFFFF},
+	{68,112,1,0x0000},{64,113,1,0xFFFF},{68,113,1,0x0000},{65,114,1,0xFFFF},{66,114,2,0x0000},{63,115,2,0xFFFF},
+	{66,115,2,0x0000},{64,116,1,0xFFFF},{66,116,1,0x0000},{59,86,1,0x0000},{68,86,1,0x0000},{59,87,1,0xFFFF},
+	{68,87,1,0xFFFF},{74,87,1,0x0000},{55,88,1,0xFFFF},{57,88,1,0x0000},{72,88,2,0x0000},{75,88,2,0xFFFF},
+	{57,89,1,0xFFFF},{59,89,1,0x0000},{70,89,1,0x0000},{72,89,2,0xFFFF},{76,89,1,0xFFFF},{59,90,1,0xFFFF},
+	{60,90,2,0x0000},{70,90,1,0xFFFF},{74,90,1,0x0000},{76,90,1,0xFFFF},{60,91,2,0xFFFF},{62,91,2,0x0000},
+	{64,91,2,0xFFFF},{74,91,1,0x0000},{76,91,1,0xFFFF},{62,92,2,0xFFFF},{64,92,2,0x0000},{74,92,1,0x0000},
+	{76,92,1,0xFFFF},{62,93,1,0xFFFF},{64,93,1,0x0000},{74,93,1,0x0000},{76,93,1,0xFFFF},{62,94,1,0xFFFF},
+	{64,94,1,0x0000},{74,94,1,0x0000},{76,94,1,0xFFFF},{62,95,1,0xFFFF},{64,95,1,0x0000},{74,95,1,0x0000},
+	{76,95,1,0xFFFF},{62,96,1,0xFFFF},{64,96,1,0x0000},{74,96,1,0x0000},{76,96,1,0xFFFF},{62,97,1,0xFFFF},
+	{64,97,1,0x0000},{74,97,1,0x0000},{76,97,1,0xFFFF},{62,98,1,0xFFFF},{64,98,1,0x0000},{74,98,1,0x0000},
+	{76,98,1,0xFFFF},{62,99,1,0xFFFF},{64,99,1,0x0000},{74,99,1,0x0000},{76,99,1,0xFFFF},{62,100,1,0xFFFF},
+	{64,100,1,0x0000},{74,100,1,0x0000},{76,100,1,0xFFFF},{62,101,1,0xFFFF},{64,101,1,0x0000},{74,101,1,0x0000},
+	{76,101,1,0xFFFF},{62,102,1,0xFFFF},{64,102,1,0x0000},{74,102,1,0x0000},{76,102,1,0xFFFF},{62,103,1,0xFFFF},
+	{64,103,1,0x0000},{73,103,1,0x0000},{76,103,1,0xFFFF},{62,104,1,0xFFFF},{64,104,1,0x0000},{73,104,1,0x0000},
+	{76,104,1,0xFFFF},{62,105,1,0xFFFF},{64,105,1,0x0000},{72,105,1,0x0000},{76,105,1,0xFFFF},{56,106,1,0xFFFF},
+	{57,106,1,0x0000},{62,106,1,0xFFFF},{64,106,1,0x0000},{71,106,1,0x0000},{75,106,1,0xFFFF},{57,107,1,0xFFFF},
+	{58,107,1,0x0000},{62,107,1,0xFFFF},{64,107,7,0x0000},{73,107,2,0xFFFF},{57,108,1,0xFFFF},{58,108,1,0x0000},
+	{62,108,1,0xFFFF},{64,108,7,0x0000},{72,108,1,0xFFFF},{58,109,1,0xFFFF},{59,109,1,0x0000},{62,109,1,0xFFFF},
+	{64,109,6,0x0000},{71,109,1,0xFFFF},{59,110,1,0xFFFF},{60,110,1,0x0000},{62,110,1,0xFFFF},{64,110,5,0x0000},
+	{70,110,1,0xFFFF},{59,111,1,0xFFFF},{60,111,1,0x0000},{62,111,1,0xFFFF},{64,111,1,0x0000},{69,111,1,0xFFFF},
+	{60,112,1,0xFFFF},{61,112,1,0x0000},{62,112,1,0xFFFF},{64,112,1,0x0000},{60,113,1,0xFFFF},{64,113,1,0x0000},
+	{61,114,2,0xFFFF},{63,114,1,0x0000},{61,115,2,0xFFFF},{64,115,2,0x0000},{62,116,1,0xFFFF},{64,116,1,0x0000},
+	{56,86,4,0xFFFF},{68,86,1,0xFFFF},{54,87,2,0x0000},{57,87,3,0x0000},{68,87,1,0x0000},{73,87,1,0x0000},
+	{54,88,2,0x0000},{72,88,2,0xFFFF},{75,88,2,0x0000},{54,89,1,0x0000},{56,89,1,0xFFFF},{57,89,2,0x0000},
+	{68,89,3,0xFFFF},{72,89,2,0x0000},{76,89,1,0x0000},{54,90,1,0x0000},{56,90,2,0xFFFF},{59,90,1,0x0000},
+	{64,90,4,0xFFFF},{68,90,3,0x0000},{74,90,1,0xFFFF},{76,90,1,0x0000},{54,91,1,0x0000},{56,91,2,0xFFFF},
+	{62,91,2,0xFFFF},{64,91,4,0x0000},{74,91,1,0xFFFF},{76,91,1,0x0000},{54,92,1,0x0000},{56,92,4,0xFFFF},
+	{62,92,2,0x0000},{74,92,1,0xFFFF},{76,92,1,0x0000},{54,93,1,0x0000},{56,93,2,0xFFFF},{62,93,1,0x0000},
+	{74,93,1,0xFFFF},{76,93,1,0x0000},{54,94,1,0x0000},{56,94,2,0xFFFF},{62,94,1,0x0000},{74,94,1,0xFFFF},
+	{76,94,1,0x0000},{54,95,1,0x0000},{56,95,2,0xFFFF},{62,95,1,0x0000},{74,95,1,0xFFFF},{76,95,1,0x0000},
+	{54,96,1,0x0000},{56,96,2,0xFFFF},{62,96,1,0x0000},{74,96,1,0xFFFF},{76,96,1,0x0000},{54,97,1,0x0000},
+	{56,97,2,0xFFFF},{62,97,1,0x0000},{74,97,1,0xFFFF},{76,97,1,0x0000},{54,98,1,0x0000},{56,98,2,0xFFFF},
+	{62,98,1,0x0000},{74,98,1,0xFFFF},{76,98,1,0x0000},{54,99,1,0x0000},{56,99,2,0xFFFF},{62,99,1,0x0000},
+	{74,99,1,0xFFFF},{76,99,1,0x0000},{54,100,1,0x0000},{56,100,2,0xFFFF},{62,100,1,0x0000},{74,100,1,0xFFFF},
+	{76,100,1,0x0000},{54,101,1,0x0000},{56,101,2,0xFFFF},{62,101,1,0x0000},{74,101,1,0xFFFF},{76,101,1,0x0000},
+	{54,102,1,0x0000},{56,102,2,0xFFFF},{62,102,1,0x0000},{74,102,1,0xFFFF},{76,102,1,0x0000},{55,103,1,0x0000},
+	{56,103,2,0xFFFF},{62,103,1,0x0000},{74,103,1,0xFFFF},{76,103,1,0x0000},{55,104,1,0x0000},{56,104,2,0xFFFF},
+	{62,104,1,0x0000},{74,104,1,0xFFFF},{76,104,1,0x0000},{57,105,1,0xFFFF},{62,105,1,0x0000},{74,105,1,0xFFFF},
+	{76,105,1,0x0000},{57,106,1,0xFFFF},{62,106,1,0x0000},{72,106,2,0xFFFF},{75,106,1,0x0000},{56,107,1,0xFFFF},
+	{62,107,1,0x0000},{71,107,1,0xFFFF},{73,107,2,0x0000},{56,108,1,0xFFFF},{62,108,1,0x0000},{69,108,2,0xFFFF},
+	{72,108,1,0x0000},{57,109,1,0xFFFF},{58,109,5,0x0000},{68,109,1,0xFFFF},{71,109,1,0x0000},{57,110,1,0xFFFF},
+	{59,110,4,0x0000},{66,110,2,0xFFFF},{70,110,1,0x0000},{57,111,1,0xFFFF},{59,111,4,0x0000},{64,111,2,0xFFFF},
+	{68,111,2,0x0000},{57,112,1,0xFFFF},{60,112,3,0x0000},{63,112,1,0xFFFF},{67,112,1,0x0000},{57,113,1,0xFFFF},
+	{60,113,1,0x0000},{61,113,1,0xFFFF},{66,113,1,0x0000},{57,114,1,0xFFFF},{60,114,1,0xFFFF},{61,114,5,0x0000},
+	{57,115,3,0xFFFF},{61,115,3,0x0000},{57,116,1,0xFFFF},{62,116,1,0x0000},{71,87,2,0x0000},{71,88,1,0xFFFF},
+	{73,88,2,0x0000},{68,89,4,0x0000},{73,89,1,0xFFFF},{58,90,19,0xFFFF},{57,91,7,0x0000},{74,91,1,0x0000},
+	{76,91,1,0xFFFF},{57,92,3,0x0000},{74,92,1,0x0000},{76,92,1,0xFFFF},{57,93,1,0x0000},{74,93,1,0x0000},
+	{76,93,1,0xFFFF},{57,94,1,0x0000},{74,94,1,0x0000},{76,94,1,0xFFFF},{57,95,1,0x0000},{74,95,1,0x0000},
+	{76,95,1,0xFFFF},{57,96,1,0x0000},{74,96,1,0x0000},{76,96,1,0xFFFF},{57,97,1,0x0000},{74,97,1,0x0000},
+	{76,97,1,0xFFFF},{57,98,1,0x0000},{74,98,1,0x0000},{76,98,1,0xFFFF},{57,99,1,0x0000},{74,99,1,0x0000},
+	{76,99,1,0xFFFF},{57,100,1,0x0000},{74,100,1,0x0000},{76,100,1,0xFFFF},{57,101,1,0x0000},{74,101,1,0x0000},
+	{76,101,1,0xFFFF},{57,102,1,0x0000},{74,102,1,0x0000},{76,102,1,0xFFFF},{57,103,1,0x0000},{74,103,1,0x0000},
+	{76,103,1,0xFFFF},{57,104,1,0x0000},{74,104,1,0x0000},{76,104,1,0xFFFF},{57,105,1,0x0000},{74,105,1,0x0000},
+	{76,105,1,0xFFFF},{57,106,1,0x0000},{72,106,2,0x0000},{76,106,1,0xFFFF},{57,107,1,0x0000},{71,107,1,0x0000},
+	{76,107,1,0xFFFF},{57,108,1,0x0000},{69,108,2,0x0000},{76,108,1,0xFFFF},{56,109,1,0xFFFF},{57,109,1,0x0000},
+	{68,109,1,0x0000},{76,109,1,0xFFFF},{56,110,21,0xFFFF},{57,111,1,0x0000},{64,111,2,0x0000},{57,112,7,0x0000},
+	{57,113,6,0x0000},{57,114,4,0x0000},{57,115,3,0x0000},{57,116,1,0x0000},{56,86,2,0x0000},{69,86,2,0xFFFF},
+	{56,87,1,0x0000},{57,87,1,0xFFFF},{69,87,2,0x0000},{71,87,1,0xFFFF},{71,88,1,0x0000},{55,89,1,0xFFFF},
+	{56,89,1,0x0000},{74,89,1,0x0000},{54,90,2,0xFFFF},{75,90,2,0x0000},{54,91,1,0xFFFF},{56,91,1,0x0000},
+	{74,91,1,0xFFFF},{76,91,1,0x0000},{54,92,1,0xFFFF},{56,92,1,0x0000},{74,92,1,0xFFFF},{76,92,1,0x0000},
+	{54,93,1,0xFFFF},{56,93,1,0x0000},{74,93,1,0xFFFF},{76,93,1,0x0000},{54,94,1,0xFFFF},{56,94,1,0x0000},
+	{74,94,1,0xFFFF},{76,94,1,0x0000},{54,95,1,0xFFFF},{56,95,1,0x0000},{74,95,1,0xFFFF},{76,95,1,0x0000},
+	{54,96,1,0xFFFF},{56,96,1,0x0000},{74,96,1,0xFFFF},{76,96,1,0x0000},{54,97,1,0xFFFF},{56,97,1,0x0000},
+	{74,97,1,0xFFFF},{76,97,1,0x0000},{54,98,1,0xFFFF},{56,98,1,0x0000},{74,98,1,0xFFFF},{76,98,1,0x0000},
+	{54,99,1,0xFFFF},{56,99,1,0x0000},{74,99,1,0xFFFF},{76,99,1,0x0000},{54,100,1,0xFFFF},{56,100,1,0x0000},
+	{74,100,1,0xFFFF},{76,100,1,0x0000},{54,101,1,0xFFFF},{56,101,1,0x0000},{74,101,1,0xFFFF},{76,101,1,0x0000},
+	{54,102,1,0xFFFF},{56,102,1,0x0000},{74,102,1,0xFFFF},{76,102,1,0x0000},{54,103,1,0xFFFF},{56,103,1,0x0000},
+	{74,103,1,0xFFFF},{76,103,1,0x0000},{54,104,1,0xFFFF},{56,104,1,0x0000},{74,104,1,0xFFFF},{76,104,1,0x0000},
+	{54,105,1,0xFFFF},{56,105,1,0x0000},{74,105,1,0xFFFF},{76,105,1,0x0000},{54,106,1,0xFFFF},{56,106,1,0x0000},
+	{74,106,1,0xFFFF},{76,106,1,0x0000},{54,107,1,0xFFFF},{56,107,1,0x0000},{74,107,1,0xFFFF},{76,107,1,0x0000},
+	{54,108,1,0xFFFF},{56,108,1,0x0000},{74,108,1,0xFFFF},{76,108,1,0x0000},{54,109,1,0xFFFF},{56,109,1,0x0000},
+	{74,109,1,0xFFFF},{76,109,1,0x0000},{54,110,2,0xFFFF},{75,110,2,0x0000},{58,86,1,0x0000},{71,86,2,0xFFFF},
+	{58,87,1,0xFFFF},{71,87,1,0x0000},{72,87,1,0xFFFF},{55,88,1,0xFFFF},{53,89,2,0xFFFF},{55,89,1,0x0000},
+	{72,89,1,0xFFFF},{73,89,1,0x0000},{52,90,2,0xFFFF},{73,90,2,0x0000},{52,91,1,0xFFFF},{54,91,1,0x0000},
+	{72,91,1,0xFFFF},{74,91,1,0x0000},{52,92,1,0xFFFF},{54,92,1,0x0000},{72,92,1,0xFFFF},{74,92,1,0x0000},
+	{52,93,1,0xFFFF},{54,93,1,0x0000},{72,93,1,0xFFFF},{74,93,1,0x0000},{52,94,1,0xFFFF},{54,94,1,0x0000},
+	{72,94,1,0xFFFF},{74,94,1,0x0000},{52,95,1,0xFFFF},{54,95,1,0x0000},{72,95,1,0xFFFF},{74,95,1,0x0000},
+	{52,96,1,0xFFFF},{54,96,1,0x0000},{72,96,1,0xFFFF},{74,96,1,0x0000},{52,97,1,0xFFFF},{54,97,1,0x0000},
+	{72,97,1,0xFFFF},{74,97,1,0x0000},{52,98,1,0xFFFF},{54,98,1,0x0000},{72,98,1,0xFFFF},{74,98,1,0x0000},
+	{52,99,1,0xFFFF},{54,99,1,0x0000},{72,99,1,0xFFFF},{74,99,1,0x0000},{52,100,1,0xFFFF},{54,100,1,0x0000},
+	{72,100,1,0xFFFF},{74,100,1,0x0000},{52,101,1,0xFFFF},{54,101,1,0x0000},{72,101,1,0xFFFF},{74,101,1,0x0000},
+	{52,102,1,0xFFFF},{54,102,1,0x0000},{72,102,1,0xFFFF},{74,102,1,0x0000},{52,103,1,0xFFFF},{54,103,1,0x0000},
+	{72,103,1,0xFFFF},{74,103,1,0x0000},{52,104,1,0xFFFF},{54,104,1,0x0000},{72,104,1,0xFFFF},{74,104,1,0x0000},
+	{52,105,1,0xFFFF},{54,105,1,0x0000},{72,105,1,0xFFFF},{74,105,1,0x0000},{52,106,1,0xFFFF},{54,106,1,0x0000},
+	{72,106,1,0xFFFF},{74,106,1,0x0000},{52,107,1,0xFFFF},{54,107,1,0x0000},{72,107,1,0xFFFF},{74,107,1,0x0000},
+	{52,108,1,0xFFFF},{54,108,1,0x0000},{72,108,1,0xFFFF},{74,108,1,0x0000},{52,109,1,0xFFFF},{54,109,1,0x0000},
+	{72,109,1,0xFFFF},{74,109,1,0x0000},{52,110,2,0xFFFF},{73,110,2,0x0000},{59,86,1,0x0000},{56,87,4,0xFFFF},
+	{54,88,1,0xFFFF},{53,89,1,0x0000},{57,89,4,0xFFFF},{71,89,1,0xFFFF},{52,90,2,0x0000},{55,90,6,0x0000},
+	{65,90,6,0x0000},{52,91,1,0x0000},{54,91,1,0xFFFF},{65,91,4,0xFFFF},{71,91,1,0xFFFF},{52,92,1,0x0000},
+	{54,92,1,0xFFFF},{69,92,3,0xFFFF},{52,93,1,0x0000},{54,93,1,0xFFFF},{71,93,1,0xFFFF},{52,94,1,0x0000},
+	{54,94,1,0xFFFF},{71,94,1,0xFFFF},{52,95,1,0x0000},{54,95,1,0xFFFF},{71,95,1,0xFFFF},{52,96,1,0x0000},
+	{54,96,1,0xFFFF},{71,96,1,0xFFFF},{52,97,1,0x0000},{54,97,1,0xFFFF},{71,97,1,0xFFFF},{52,98,1,0x0000},
+	{54,98,1,0xFFFF},{71,98,1,0xFFFF},{52,99,1,0x0000},{54,99,1,0xFFFF},{71,99,1,0xFFFF},{52,100,1,0x0000},
+	{54,100,1,0xFFFF},{71,100,1,0xFFFF},{52,101,1,0x0000},{54,101,1,0xFFFF},{71,101,1,0xFFFF},{52,102,1,0x0000},
+	{54,102,1,0xFFFF},{71,102,1,0xFFFF},{52,103,1,0x0000},{54,103,1,0xFFFF},{71,103,1,0xFFFF},{52,104,1,0x0000},
+	{54,104,1,0xFFFF},{71,104,1,0xFFFF},{52,105,1,0x0000},{54,105,1,0xFFFF},{71,105,1,0xFFFF},{52,106,1,0x0000},
+	{55,106,2,0xFFFF},{71,106,1,0xFFFF},{52,107,1,0x0000},{57,107,1,0xFFFF},{71,107,1,0xFFFF},{52,108,1,0x0000},
+	{58,108,2,0xFFFF},{71,108,1,0xFFFF},{72,108,1,0x0000},{52,109,1,0x0000},{60,109,1,0xFFFF},{71,109,1,0xFFFF},
+	{72,109,1,0x0000},{52,110,9,0x0000},{63,110,8,0x0000},{72,110,1,0x0000},{63,111,2,0xFFFF},{71,111,1,0xFFFF},
+	{65,112,1,0xFFFF},{71,112,1,0xFFFF},{66,113,2,0xFFFF},{71,113,1,0xFFFF},{68,114,1,0xFFFF},{71,114,1,0xFFFF},
+	{69,115,3,0xFFFF},{71,116,1,0xFFFF},{60,86,1,0x0000},{69,86,4,0x0000},{55,87,6,0xFFFF},{69,87,6,0xFFFF},
+	{52,88,2,0xFFFF},{55,88,2,0x0000},{73,88,2,0xFFFF},{52,89,1,0xFFFF},{55,89,2,0xFFFF},{58,89,3,0x0000},
+	{72,89,1,0x0000},{74,89,1,0xFFFF},{52,90,1,0xFFFF},{54,90,1,0x0000},{58,90,3,0xFFFF},{61,90,4,0x0000},
+	{69,90,2,0xFFFF},{71,90,2,0x0000},{74,90,1,0xFFFF},{52,91,1,0xFFFF},{54,91,1,0x0000},{61,91,4,0xFFFF},
+	{65,91,2,0x0000},{71,91,2,0x0000},{74,91,1,0xFFFF},{52,92,1,0xFFFF},{54,92,1,0x0000},{65,92,2,0xFFFF},
+	{69,92,4,0x0000},{74,92,1,0xFFFF},{52,93,1,0xFFFF},{54,93,1,0x0000},{66,93,1,0xFFFF},{71,93,2,0x0000},
+	{74,93,1,0xFFFF},{52,94,1,0xFFFF},{54,94,1,0x0000},{66,94,1,0xFFFF},{71,94,2,0x0000},{74,94,1,0xFFFF},
+	{52,95,1,0xFFFF},{54,95,1,0x0000},{66,95,1,0xFFFF},{71,95,2,0x0000},{74,95,1,0xFFFF},{52,96,1,0xFFFF},
+	{54,96,1,0x0000},{66,96,1,0xFFFF},{71,96,2,0x0000},{74,96,1,0xFFFF},{52,97,1,0xFFFF},{54,97,1,0x0000},
+	{66,97,1,0xFFFF},{71,97,2,0x0000},{74,97,1,0xFFFF},{52,98,1,0xFFFF},{54,98,1,0x0000},{66,98,1,0xFFFF},
+	{71,98,2,0x0000},{74,98,1,0xFFFF},{52,99,1,0xFFFF},{54,99,1,0x0000},{66,99,1,0xFFFF},{71,99,2,0x0000},
+	{74,99,1,0xFFFF},{52,100,1,0xFFFF},{54,100,1,0x0000},{66,100,1,0xFFFF},{71,100,2,0x0000},{74,100,1,0xFFFF},
+	{52,101,1,0xFFFF},{54,101,1,0x0000},{66,101,1,0xFFFF},{71,101,2,0x0000},{74,101,1,0xFFFF},{52,102,1,0xFFFF},
+	{54,102,1,0x0000},{66,102,1,0xFFFF},{71,102,2,0x0000},{74,102,1,0xFFFF},{52,103,1,0xFFFF},{54,103,1,0x0000},
+	{66,103,1,0xFFFF},{71,103,2,0x0000},{73,103,1,0xFFFF},{52,104,1,0xFFFF},{54,104,1,0x0000},{66,104,1,0xFFFF},
+	{71,104,2,0x0000},{73,104,1,0xFFFF},{52,105,1,0xFFFF},{54,105,1,0x0000},{66,105,1,0xFFFF},{71,105,1,0x0000},
+	{53,106,1,0xFFFF},{55,106,2,0x0000},{66,106,1,0xFFFF},{71,106,1,0x0000},{54,107,2,0xFFFF},{57,107,1,0x0000},
+	{66,107,1,0xFFFF},{72,107,1,0x0000},{56,108,1,0xFFFF},{58,108,2,0x0000},{66,108,1,0xFFFF},{57,109,1,0xFFFF},
+	{60,109,1,0x0000},{66,109,1,0xFFFF},{70,109,1,0xFFFF},{71,109,1,0x0000},{58,110,2,0xFFFF},{61,110,2,0x0000},
+	{66,110,1,0xFFFF},{69,110,1,0xFFFF},{71,110,1,0x0000},{60,111,1,0xFFFF},{63,111,2,0x0000},{66,111,1,0xFFFF},
+	{69,111,1,0xFFFF},{71,111,1,0x0000},{61,112,1,0xFFFF},{65,112,1,0x0000},{66,112,1,0xFFFF},{68,112,1,0xFFFF},
+	{71,112,1,0x0000},{62,113,1,0xFFFF},{67,113,1,0x0000},{68,113,1,0xFFFF},{71,113,1,0x0000},{63,114,2,0xFFFF},
+	{66,114,2,0xFFFF},{68,114,4,0x0000},{65,115,3,0xFFFF},{69,115,3,0x0000},{66,116,1,0xFFFF},{71,116,1,0x0000},
+	{59,86,2,0xFFFF},{54,87,1,0xFFFF},{59,87,2,0x0000},{52,88,2,0x0000},{56,88,2,0xFFFF},{52,89,1,0x0000},
+	{55,89,3,0x0000},{58,89,2,0xFFFF},{70,89,1,0xFFFF},{52,90,1,0x0000},{54,90,1,0xFFFF},{58,90,2,0x0000},
+	{61,90,1,0xFFFF},{68,90,1,0xFFFF},{70,90,1,0x0000},{52,91,1,0x0000},{54,91,1,0xFFFF},{61,91,1,0x0000},
+	{64,91,1,0x0000},{66,91,1,0xFFFF},{68,91,1,0x0000},{52,92,1,0x0000},{54,92,1,0xFFFF},{64,92,1,0xFFFF},
+	{66,92,1,0x0000},{52,93,1,0x0000},{54,93,1,0xFFFF},{64,93,1,0xFFFF},{66,93,1,0x0000},{52,94,1,0x0000},
+	{54,94,1,0xFFFF},{64,94,1,0xFFFF},{66,94,1,0x0000},{52,95,1,0x0000},{54,95,1,0xFFFF},{64,95,1,0xFFFF},
+	{66,95,1,0x0000},{52,96,1,0x0000},{54,96,1,0xFFFF},{64,96,1,0xFFFF},{66,96,1,0x0000},{52,97,1,0x0000},
+	{54,97,1,0xFFFF},{64,97,1,0xFFFF},{66,97,1,0x0000},{52,98,1,0x0000},{54,98,1,0xFFFF},{64,98,1,0xFFFF},
+	{66,98,1,0x0000},{52,99,1,0x0000},{54,99,1,0xFFFF},{64,99,1,0xFFFF},{66,99,1,0x0000},{52,100,1,0x0000},
+	{54,100,1,0xFFFF},{64,100,1,0xFFFF},{66,100,1,0x0000},{52,101,1,0x0000},{54,101,1,0xFFFF},{64,101,1,0xFFFF},
+	{66,101,1,0x0000},{52,102,1,0x0000},{54,102,1,0xFFFF},{64,102,1,0xFFFF},{66,102,1,0x0000},{52,103,1,0x0000},
+	{55,103,1,0xFFFF},{64,103,1,0xFFFF},{66,103,1,0x0000},{52,104,1,0x0000},{55,104,1,0xFFFF},{64,104,1,0xFFFF},
+	{66,104,1,0x0000},{52,105,1,0x0000},{56,105,1,0xFFFF},{64,105,1,0xFFFF},{66,105,1,0x0000},{53,106,1,0x0000},
+	{57,106,1,0xFFFF},{64,106,1,0xFFFF},{66,106,1,0x0000},{71,106,1,0xFFFF},{72,106,1,0x0000},{54,107,2,0x0000},
+	{58,107,1,0xFFFF},{64,107,1,0xFFFF},{66,107,1,0x0000},{70,107,1,0xFFFF},{71,107,1,0x0000},{56,108,1,0x0000},
+	{58,108,1,0xFFFF},{64,108,1,0xFFFF},{66,108,1,0x0000},{70,108,1,0xFFFF},{71,108,1,0x0000},{57,109,1,0x0000},
+	{59,109,1,0xFFFF},{64,109,1,0xFFFF},{66,109,1,0x0000},{69,109,1,0xFFFF},{70,109,1,0x0000},{58,110,2,0x0000},
+	{60,110,1,0xFFFF},{64,110,1,0xFFFF},{66,110,1,0x0000},{68,110,1,0xFFFF},{69,110,1,0x0000},{64,111,1,0xFFFF},
+	{66,111,1,0x0000},{68,111,1,0xFFFF},{69,111,1,0x0000},{64,112,1,0xFFFF},{66,112,1,0x0000},{67,112,1,0xFFFF},
+	{68,112,1,0x0000},{64,113,1,0xFFFF},{68,113,1,0x0000},{65,114,1,0xFFFF},{66,114,2,0x0000},{63,115,2,0xFFFF},
+	{66,115,2,0x0000},{64,116,1,0xFFFF},{66,116,1,0x0000},{59,86,1,0x0000},{68,86,1,0x0000},{59,87,1,0xFFFF},
+	{68,87,1,0xFFFF},{74,87,1,0x0000},{55,88,1,0xFFFF},{57,88,1,0x0000},{72,88,2,0x0000},{75,88,2,0xFFFF},
+	{57,89,1,0xFFFF},{59,89,1,0x0000},{70,89,1,0x0000},{72,89,2,0xFFFF},{76,89,1,0xFFFF},{59,90,1,0xFFFF},
+	{60,90,2,0x0000},{70,90,1,0xFFFF},{74,90,1,0x0000},{76,90,1,0xFFFF},{60,91,2,0xFFFF},{62,91,2,0x0000},
+	{64,91,2,0xFFFF},{74,91,1,0x0000},{76,91,1,0xFFFF},{62,92,2,0xFFFF},{64,92,2,0x0000},{74,92,1,0x0000},
+	{76,92,1,0xFFFF},{62,93,1,0xFFFF},{64,93,1,0x0000},{74,93,1,0x0000},{76,93,1,0xFFFF},{62,94,1,0xFFFF},
+	{64,94,1,0x0000},{74,94,1,0x0000},{76,94,1,0xFFFF},{62,95,1,0xFFFF},{64,95,1,0x0000},{74,95,1,0x0000},
+	{76,95,1,0xFFFF},{62,96,1,0xFFFF},{64,96,1,0x0000},{74,96,1,0x0000},{76,96,1,0xFFFF},{62,97,1,0xFFFF},
+	{64,97,1,0x0000},{74,97,1,0x0000},{76,97,1,0xFFFF},{62,98,1,0xFFFF},{64,98,1,0x0000},{74,98,1,0x0000},
+	{76,98,1,0xFFFF},{62,99,1,0xFFFF},{64,99,1,0x0000},{74,99,1,0x0000},{76,99,1,0xFFFF},{62,100,1,0xFFFF},
+	{64,100,1,0x0000},{74,100,1,0x0000},{76,100,1,0xFFFF},{62,101,1,0xFFFF},{64,101,1,0x0000},{74,101,1,0x0000},
+	{76,101,1,0xFFFF},{62,102,1,0xFFFF},{64,102,1,0x0000},{74,102,1,0x0000},{76,102,1,0xFFFF},{62,103,1,0xFFFF},
+	{64,103,1,0x0000},{73,103,1,0x0000},{76,103,1,0xFFFF},{62,104,1,0xFFFF},{64,104,1,0x0000},{73,104,1,0x0000},
+	{76,104,1,0xFFFF},{62,105,1,0xFFFF},{64,105,1,0x0000},{72,105,1,0x0000},{76,105,1,0xFFFF},{56,106,1,0xFFFF},
+	{57,106,1,0x0000},{62,106,1,0xFFFF},{64,106,1,0x0000},{71,106,1,0x0000},{75,106,1,0xFFFF},{57,107,1,0xFFFF},
+	{58,107,1,0x0000},{62,107,1,0xFFFF},{64,107,7,0x0000},{73,107,2,0xFFFF},{57,108,1,0xFFFF},{58,108,1,0x0000},
+	{62,108,1,0xFFFF},{64,108,7,0x0000},{72,108,1,0xFFFF},{58,109,1,0xFFFF},{59,109,1,0x0000},{62,109,1,0xFFFF},
+	{64,109,6,0x0000},{71,109,1,0xFFFF},{59,110,1,0xFFFF},{60,110,1,0x0000},{62,110,1,0xFFFF},{64,110,5,0x0000},
+	{70,110,1,0xFFFF},{59,111,1,0xFFFF},{60,111,1,0x0000},{62,111,1,0xFFFF},{64,111,1,0x0000},{69,111,1,0xFFFF},
+	{60,112,1,0xFFFF},{61,112,1,0x0000},{62,112,1,0xFFFF},{64,112,1,0x0000},{60,113,1,0xFFFF},{64,113,1,0x0000},
+	{61,114,2,0xFFFF},{63,114,1,0x0000},{61,115,2,0xFFFF},{64,115,2,0x0000},{62,116,1,0xFFFF},{64,116,1,0x0000},
+	{56,86,4,0xFFFF},{68,86,1,0xFFFF},{54,87,2,0x0000},{57,87,3,0x0000},{68,87,1,0x0000},{73,87,1,0x0000},
+	{54,88,2,0x0000},{72,88,2,0xFFFF},{75,88,2,0x0000},{54,89,1,0x0000},{56,89,1,0xFFFF},{57,89,2,0x0000},
+	{68,89,3,0xFFFF},{72,89,2,0x0000},{76,89,1,0x0000},{54,90,1,0x0000},{56,90,2,0xFFFF},{59,90,1,0x0000},
+	{64,90,4,0xFFFF},{68,90,3,0x0000},{74,90,1,0xFFFF},{76,90,1,0x0000},{54,91,1,0x0000},{56,91,2,0xFFFF},
+	{62,91,2,0xFFFF},{64,91,4,0x0000},{74,91,1,0xFFFF},{76,91,1,0x0000},{54,92,1,0x0000},{56,92,4,0xFFFF},
+	{62,92,2,0x0000},{74,92,1,0xFFFF},{76,92,1,0x0000},{54,93,1,0x0000},{56,93,2,0xFFFF},{62,93,1,0x0000},
+	{74,93,1,0xFFFF},{76,93,1,0x0000},{54,94,1,0x0000},{56,94,2,0xFFFF},{62,94,1,0x0000},{74,94,1,0xFFFF},
+	{76,94,1,0x0000},{54,95,1,0x0000},{56,95,2,0xFFFF},{62,95,1,0x0000},{74,95,1,0xFFFF},{76,95,1,0x0000},
+	{54,96,1,0x0000},{56,96,2,0xFFFF},{62,96,1,0x0000},{74,96,1,0xFFFF},{76,96,1,0x0000},{54,97,1,0x0000},
+	{56,97,2,0xFFFF},{62,97,1,0x0000},{74,97,1,0xFFFF},{76,97,1,0x0000},{54,98,1,0x0000},{56,98,2,0xFFFF},
+	{62,98,1,0x0000},{74,98,1,0xFFFF},{76,98,1,0x0000},{54,99,1,0x0000},{56,99,2,0xFFFF},{62,99,1,0x0000},
+	{74,99,1,0xFFFF},{76,99,1,0x0000},{54,100,1,0x0000},{56,100,2,0xFFFF},{62,100,1,0x0000},{74,100,1,0xFFFF},
+	{76,100,1,0x0000},{54,101,1,0x0000},{56,101,2,0xFFFF},{62,101,1,0x0000},{74,101,1,0xFFFF},{76,101,1,0x0000},
+	{54,102,1,0x0000},{56,102,2,0xFFFF},{62,102,1,0x0000},{74,102,1,0xFFFF},{76,102,1,0x0000},{55,103,1,0x0000},
+	{56,103,2,0xFFFF},{62,103,1,0x0000},{74,103,1,0xFFFF},{76,103,1,0x0000},{55,104,1,0x0000},{56,104,2,0xFFFF},
+	{62,104,1,0x0000},{74,104,1,0xFFFF},{76,104,1,0x0000},{57,105,1,0xFFFF},{62,105,1,0x0000},{74,105,1,0xFFFF},
+	{76,105,1,0x0000},{57,106,1,0xFFFF},{62,106,1,0x0000},{72,106,2,0xFFFF},{75,106,1,0x0000},{56,107,1,0xFFFF},
+	{62,107,1,0x0000},{71,107,1,0xFFFF},{73,107,2,0x0000},{56,108,1,0xFFFF},{62,108,1,0x0000},{69,108,2,0xFFFF},
+	{72,108,1,0x0000},{57,109,1,0xFFFF},{58,109,5,0x0000},{68,109,1,0xFFFF},{71,109,1,0x0000},{57,110,1,0xFFFF},
+	{59,110,4,0x0000},{66,110,2,0xFFFF},{70,110,1,0x0000},{57,111,1,0xFFFF},{59,111,4,0x0000},{64,111,2,0xFFFF},
+	{68,111,2,0x0000},{57,112,1,0xFFFF},{60,112,3,0x0000},{63,112,1,0xFFFF},{67,112,1,0x0000},{57,113,1,0xFFFF},
+	{60,113,1,0x0000},{61,113,1,0xFFFF},{66,113,1,0x0000},{57,114,1,0xFFFF},{60,114,1,0xFFFF},{61,114,5,0x0000},
+	{57,115,3,0xFFFF},{61,115,3,0x0000},{57,116,1,0xFFFF},{62,116,1,0x0000},{71,87,2,0x0000},{71,88,1,0xFFFF},
+	{73,88,2,0x0000},{68,89,4,0x0000},{73,89,1,0xFFFF},{58,90,19,0xFFFF},{57,91,7,0x0000},{74,91,1,0x0000},
+	{76,91,1,0xFFFF},{57,92,3,0x0000},{74,92,1,0x0000},{76,92,1,0xFFFF},{57,93,1,0x0000},{74,93,1,0x0000},
+	{76,93,1,0xFFFF},{57,94,1,0x0000},{74,94,1,0x0000},{76,94,1,0xFFFF},{57,95,1,0x0000},{74,95,1,0x0000},
+	{76,95,1,0xFFFF},{57,96,1,0x0000},{74,96,1,0x0000},{76,96,1,0xFFFF},{57,97,1,0x0000},{74,97,1,0x0000},
+	{76,97,1,0xFFFF},{57,98,1,0x0000},{74,98,1,0x0000},{76,98,1,0xFFFF},{57,99,1,0x0000},{74,99,1,0x0000},
+	{76,99,1,0xFFFF},{57,100,1,0x0000},{74,100,1,0x0000},{76,100,1,0xFFFF},{57,101,1,0x0000},{74,101,1,0x0000},
+	{76,101,1,0xFFFF},{57,102,1,0x0000},{74,102,1,0x0000},{76,102,1,0xFFFF},{57,103,1,0x0000},{74,103,1,0x0000},
+	{76,103,1,0xFFFF},{57,104,1,0x0000},{74,104,1,0x0000},{76,104,1,0xFFFF},{57,105,1,0x0000},{74,105,1,0x0000},
+	{76,105,1,0xFFFF},{57,106,1,0x0000},{72,106,2,0x0000},{76,106,1,0xFFFF},{57,107,1,0x0000},{71,107,1,0x0000},
+	{76,107,1,0xFFFF},{57,108,1,0x0000},{69,108,2,0x0000},{76,108,1,0xFFFF},{56,109,1,0xFFFF},{57,109,1,0x0000},
+	{68,109,1,0x0000},{76,109,1,0xFFFF},{56,110,21,0xFFFF},{57,111,1,0x0000},{64,111,2,0x0000},{57,112,7,0x0000},
+	{57,113,6,0x0000},{57,114,4,0x0000},{57,115,3,0x0000},{57,116,1,0x0000},{56,86,2,0x0000},{69,86,2,0xFFFF},
+	{56,87,1,0x0000},{57,87,1,0xFFFF},{69,87,2,0x0000},{71,87,1,0xFFFF},{71,88,1,0x0000},{55,89,1,0xFFFF},
+	{56,89,1,0x0000},{74,89,1,0x0000},{54,90,2,0xFFFF},{75,90,2,0x0000},{54,91,1,0xFFFF},{56,91,1,0x0000},
+	{74,91,1,0xFFFF},{76,91,1,0x0000},{54,92,1,0xFFFF},{56,92,1,0x0000},{74,92,1,0xFFFF},{76,92,1,0x0000},
+	{54,93,1,0xFFFF},{56,93,1,0x0000},{74,93,1,0xFFFF},{76,93,1,0x0000},{54,94,1,0xFFFF},{56,94,1,0x0000},
+	{74,94,1,0xFFFF},{76,94,1,0x0000},{54,95,1,0xFFFF},{56,95,1,0x0000},{74,95,1,0xFFFF},{76,95,1,0x0000},
+	{54,96,1,0xFFFF},{56,96,1,0x0000},{74,96,1,0xFFFF},{76,96,1,0x0000},{54,97,1,0xFFFF},{56,97,1,0x0000},
+	{74,97,1,0xFFFF},{76,97,1,0x0000},{54,98,1,0xFFFF},{56,98,1,0x0000},{74,98,1,0xFFFF},{76,98,1,0x0000},
+	{54,99,1,0xFFFF},{56,99,1,0x0000},{74,99,1,0xFFFF},{76,99,1,0x0000},{54,100,1,0xFFFF},{56,100,1,0x0000},
+	{74,100,1,0xFFFF},{76,100,1,0x0000},{54,101,1,0xFFFF},{56,101,1,0x0000},{74,101,1,0xFFFF},{76,101,1,0x0000},
+	{54,102,1,0xFFFF},{56,102,1,0x0000},{74,102,1,0xFFFF},{76,102,1,0x0000},{54,103,1,0xFFFF},{56,103,1,0x0000},
+	{74,103,1,0xFFFF},{76,103,1,0x0000},{54,104,1,0xFFFF},{56,104,1,0x0000},{74,104,1,0xFFFF},{76,104,1,0x0000},
+	{54,105,1,0xFFFF},{56,105,1,0x0000},{74,105,1,0xFFFF},{76,105,1,0x0000},{54,106,1,0xFFFF},{56,106,1,0x0000},
+	{74,106,1,0xFFFF},{76,106,1,0x0000},{54,107,1,0xFFFF},{56,107,1,0x0000},{74,107,1,0xFFFF},{76,107,1,0x0000},
+	{54,108,1,0xFFFF},{56,108,1,0x0000},{74,108,1,0xFFFF},{76,108,1,0x0000},{54,109,1,0xFFFF},{56,109,1,0x0000},
+	{74,109,1,0xFFFF},{76,109,1,0x0000},{54,110,2,0xFFFF},{75,110,2,0x0000},{58,86,1,0x0000},{71,86,2,0xFFFF},
+	{58,87,1,0xFFFF},{71,87,1,0x0000},{72,87,1,0xFFFF},{55,88,1,0xFFFF},{53,89,2,0xFFFF},{55,89,1,0x0000},
+	{72,89,1,0xFFFF},{73,89,1,0x0000},{52,90,2,0xFFFF},{73,90,2,0x0000},{52,91,1,0xFFFF},{54,91,1,0x0000},
+	{72,91,1,0xFFFF},{74,91,1,0x0000},{52,92,1,0xFFFF},{54,92,1,0x0000},{72,92,1,0xFFFF},{74,92,1,0x0000},
+	{52,93,1,0xFFFF},{54,93,1,0x0000},{72,93,1,0xFFFF},{74,93,1,0x0000},{52,94,1,0xFFFF},{54,94,1,0x0000},
+	{72,94,1,0xFFFF},{74,94,1,0x0000},{52,95,1,0xFFFF},{54,95,1,0x0000},{72,95,1,0xFFFF},{74,95,1,0x0000},
+	{52,96,1,0xFFFF},{54,96,1,0x0000},{72,96,1,0xFFFF},{74,96,1,0x0000},{52,97,1,0xFFFF},{54,97,1,0x0000},
+	{72,97,1,0xFFFF},{74,97,1,0x0000},{52,98,1,0xFFFF},{54,98,1,0x0000},{72,98,1,0xFFFF},{74,98,1,0x0000},
+	{52,99,1,0xFFFF},{54,99,1,0x0000},{72,99,1,0xFFFF},{74,99,1,0x0000},{52,100,1,0xFFFF},{54,100,1,0x0000},
+	{72,100,1,0xFFFF},{74,100,1,0x0000},{52,101,1,0xFFFF},{54,101,1,0x0000},{72,101,1,0xFFFF},{74,101,1,0x0000},
+	{52,102,1,0xFFFF},{54,102,1,0x0000},{72,102,1,0xFFFF},{74,102,1,0x0000},{52,103,1,0xFFFF},{54,103,1,0x0000},
+	{72,103,1,0xFFFF},{74,103,1,0x0000},{52,104,1,0xFFFF},{54,104,1,0x0000},{72,104,1,0xFFFF},{74,104,1,0x0000},
+	{52,105,1,0xFFFF},{54,105,1,0x0000},{72,105,1,0xFFFF},{74,105,1,0x0000},{52,106,1,0xFFFF},{54,106,1,0x0000},
+	{72,106,1,0xFFFF},{74,106,1,0x0000},{52,107,1,0xFFFF},{54,107,1,0x0000},{72,107,1,0xFFFF},{74,107,1,0x0000},
+	{52,108,1,0xFFFF},{54,108,1,0x0000},{72,108,1,0xFFFF},{74,108,1,0x0000},{52,109,1,0xFFFF},{54,109,1,0x0000},
+	{72,109,1,0xFFFF},{74,109,1,0x0000},{52,110,2,0xFFFF},{73,110,2,0x0000},{59,86,1,0x0000},{56,87,4,0xFFFF},
+	{54,88,1,0xFFFF},{53,89,1,0x0000},{57,89,4,0xFFFF},{71,89,1,0xFFFF},{52,90,2,0x0000},{55,90,6,0x0000},
+	{65,90,6,0x0000},{52,91,1,0x0000},{54,91,1,0xFFFF},{65,91,4,0xFFFF},{71,91,1,0xFFFF},{52,92,1,0x0000},
+	{54,92,1,0xFFFF},{69,92,3,0xFFFF},{52,93,1,0x0000},{54,93,1,0xFFFF},{71,93,1,0xFFFF},{52,94,1,0x0000},
+	{54,94,1,0xFFFF},{71,94,1,0xFFFF},{52,95,1,0x0000},{54,95,1,0xFFFF},{71,95,1,0xFFFF},{52,96,1,0x0000},
+	{54,96,1,0xFFFF},{71,96,1,0xFFFF},{52,97,1,0x0000},{54,97,1,0xFFFF},{71,97,1,0xFFFF},{52,98,1,0x0000},
+	{54,98,1,0xFFFF},{71,98,1,0xFFFF},{52,99,1,0x0000},{54,99,1,0xFFFF},{71,99,1,0xFFFF},{52,100,1,0x0000},
+	{54,100,1,0xFFFF},{71,100,1,0xFFFF},{52,101,1,0x0000},{54,101,1,0xFFFF},{71,101,1,0xFFFF},{52,102,1,0x0000},
+	{54,102,1,0xFFFF},{71,102,1,0xFFFF},{52,103,1,0x0000},{54,103,1,0xFFFF},{71,103,1,0xFFFF},{52,104,1,0x0000},
+	{54,104,1,0xFFFF},{71,104,1,0xFFFF},{52,105,1,0x0000},{54,105,1,0xFFFF},{71,105,1,0xFFFF},{52,106,1,0x0000},
+	{55,106,2,0xFFFF},{71,106,1,0xFFFF},{52,107,1,0x0000},{57,107,1,0xFFFF},{71,107,1,0xFFFF},{52,108,1,0x0000},
+	{58,108,2,0xFFFF},{71,108,1,0xFFFF},{72,108,1,0x0000},{52,109,1,0x0000},{60,109,1,0xFFFF},{71,109,1,0xFFFF},
+	{72,109,1,0x0000},{52,110,9,0x0000},{63,110,8,0x0000},{72,110,1,0x0000},{63,111,2,0xFFFF},{71,111,1,0xFFFF},
+	{65,112,1,0xFFFF},{71,112,1,0xFFFF},{66,113,2,0xFFFF},{71,113,1,0xFFFF},{68,114,1,0xFFFF},{71,114,1,0xFFFF},
+	{69,115,3,0xFFFF},{71,116,1,0xFFFF},{60,86,1,0x0000},{69,86,4,0x0000},{55,87,6,0xFFFF},{69,87,6,0xFFFF},
+	{52,88,2,0xFFFF},{55,88,2,0x0000},{73,88,2,0xFFFF},{52,89,1,0xFFFF},{55,89,2,0xFFFF},{58,89,3,0x0000},
+	{72,89,1,0x0000},{74,89,1,0xFFFF},{52,90,1,0xFFFF},{54,90,1,0x0000},{58,90,3,0xFFFF},{61,90,4,0x0000},
+	{69,90,2,0xFFFF},{71,90,2,0x0000},{74,90,1,0xFFFF},{52,91,1,0xFFFF},{54,91,1,0x0000},{61,91,4,0xFFFF},
+	{65,91,2,0x0000},{71,91,2,0x0000},{74,91,1,0xFFFF},{52,92,1,0xFFFF},{54,92,1,0x0000},{65,92,2,0xFFFF},
+	{69,92,4,0x0000},{74,92,1,0xFFFF},{52,93,1,0xFFFF},{54,93,1,0x0000},{66,93,1,0xFFFF},{71,93,2,0x0000},
+	{74,93,1,0xFFFF},{52,94,1,0xFFFF},{54,94,1,0x0000},{66,94,1,0xFFFF},{71,94,2,0x0000},{74,94,1,0xFFFF},
+	{52,95,1,0xFFFF},{54,95,1,0x0000},{66,95,1,0xFFFF},{71,95,2,0x0000},{74,95,1,0xFFFF},{52,96,1,0xFFFF},
+	{54,96,1,0x0000},{66,96,1,0xFFFF},{71,96,2,0x0000},{74,96,1,0xFFFF},{52,97,1,0xFFFF},{54,97,1,0x0000},
+	{66,97,1,0xFFFF},{71,97,2,0x0000},{74,97,1,0xFFFF},{52,98,1,0xFFFF},{54,98,1,0x0000},{66,98,1,0xFFFF},
+	{71,98,2,0x0000},{74,98,1,0xFFFF},{52,99,1,0xFFFF},{54,99,1,0x0000},{66,99,1,0xFFFF},{71,99,2,0x0000},
+	{74,99,1,0xFFFF},{52,100,1,0xFFFF},{54,100,1,0x0000},{66,100,1,0xFFFF},{71,100,2,0x0000},{74,100,1,0xFFFF},
+	{52,101,1,0xFFFF},{54,101,1,0x0000},{66,101,1,0xFFFF},{71,101,2,0x0000},{74,101,1,0xFFFF},{52,102,1,0xFFFF},
+	{54,102,1,0x0000},{66,102,1,0xFFFF},{71,102,2,0x0000},{74,102,1,0xFFFF},{52,103,1,0xFFFF},{54,103,1,0x0000},
+	{66,103,1,0xFFFF},{71,103,2,0x0000},{73,103,1,0xFFFF},{52,104,1,0xFFFF},{54,104,1,0x0000},{66,104,1,0xFFFF},
+	{71,104,2,0x0000},{73,104,1,0xFFFF},{52,105,1,0xFFFF},{54,105,1,0x0000},{66,105,1,0xFFFF},{71,105,1,0x0000},
+	{53,106,1,0xFFFF},{55,106,2,0x0000},{66,106,1,0xFFFF},{71,106,1,0x0000},{54,107,2,0xFFFF},{57,107,1,0x0000},
+	{66,107,1,0xFFFF},{72,107,1,0x0000},{56,108,1,0xFFFF},{58,108,2,0x0000},{66,108,1,0xFFFF},{57,109,1,0xFFFF},
+	{60,109,1,0x0000},{66,109,1,0xFFFF},{70,109,1,0xFFFF},{71,109,1,0x0000},{58,110,2,0xFFFF},{61,110,2,0x0000},
+	{66,110,1,0xFFFF},{69,110,1,0xFFFF},{71,110,1,0x0000},{60,111,1,0xFFFF},{63,111,2,0x0000},{66,111,1,0xFFFF},
+	{69,111,1,0xFFFF},{71,111,1,0x0000},{61,112,1,0xFFFF},{65,112,1,0x0000},{66,112,1,0xFFFF},{68,112,1,0xFFFF},
+	{71,112,1,0x0000},{62,113,1,0xFFFF},{67,113,1,0x0000},{68,113,1,0xFFFF},{71,113,1,0x0000},{63,114,2,0xFFFF},
+	{66,114,2,0xFFFF},{68,114,4,0x0000},{65,115,3,0xFFFF},{69,115,3,0x0000},{66,116,1,0xFFFF},{71,116,1,0x0000},
+	{59,86,2,0xFFFF},{54,87,1,0xFFFF},{59,87,2,0x0000},{52,88,2,0x0000},{56,88,2,0xFFFF},{52,89,1,0x0000},
+	{55,89,3,0x0000},{58,89,2,0xFFFF},{70,89,1,0xFFFF},{52,90,1,0x0000},{54,90,1,0xFFFF},{58,90,2,0x0000},
+	{61,90,1,0xFFFF},{68,90,1,0xFFFF},{70,90,1,0x0000},{52,91,1,0x0000},{54,91,1,0xFFFF},{61,91,1,0x0000},
+	{64,91,1,0x0000},{66,91,1,0xFFFF},{68,91,1,0x0000},{52,92,1,0x0000},{54,92,1,0xFFFF},{64,92,1,0xFFFF},
+	{66,92,1,0x0000},{52,93,1,0x0000},{54,93,1,0xFFFF},{64,93,1,0xFFFF},{66,93,1,0x0000},{52,94,1,0x0000},
+	{54,94,1,0xFFFF},{64,94,1,0xFFFF},{66,94,1,0x0000},{52,95,1,0x0000},{54,95,1,0xFFFF},{64,95,1,0xFFFF},
+	{66,95,1,0x0000},{52,96,1,0x0000},{54,96,1,0xFFFF},{64,96,1,0xFFFF},{66,96,1,0x0000},{52,97,1,0x0000},
+	{54,97,1,0xFFFF},{64,97,1,0xFFFF},{66,97,1,0x0000},{52,98,1,0x0000},{54,98,1,0xFFFF},{64,98,1,0xFFFF},
+	{66,98,1,0x0000},{52,99,1,0x0000},{54,99,1,0xFFFF},{64,99,1,0xFFFF},{66,99,1,0x0000},{52,100,1,0x0000},
+	{54,100,1,0xFFFF},{64,100,1,0xFFFF},{66,100,1,0x0000},{52,101,1,0x0000},{54,101,1,0xFFFF},{64,101,1,0xFFFF},
+	{66,101,1,0x0000},{52,102,1,0x0000},{54,102,1,0xFFFF},{64,102,1,0xFFFF},{66,102,1,0x0000},{52,103,1,0x0000},
+	{55,103,1,0xFFFF},{64,103,1,0xFFFF},{66,103,1,0x0000},{52,104,1,0x0000},{55,104,1,0xFFFF},{64,104,1,0xFFFF},
+	{66,104,1,0x0000},{52,105,1,0x0000},{56,105,1,0xFFFF},{64,105,1,0xFFFF},{66,105,1,0x0000},{53,106,1,0x0000},
+	{57,106,1,0xFFFF},{64,106,1,0xFFFF},{66,106,1,0x0000},{71,106,1,0xFFFF},{72,106,1,0x0000},{54,107,2,0x0000},
+	{58,107,1,0xFFFF},{64,107,1,0xFFFF},{66,107,1,0x0000},{70,107,1,0xFFFF},{71,107,1,0x0000},{56,108,1,0x0000},
+	{58,108,1,0xFFFF},{64,108,1,0xFFFF},{66,108,1,0x0000},{70,108,1,0xFFFF},{71,108,1,0x0000},{57,109,1,0x0000},
+	{59,109,1,0xFFFF},{64,109,1,0xFFFF},{66,109,1,0x0000},{69,109,1,0xFFFF},{70,109,1,0x0000},{58,110,2,0x0000},
+	{60,110,1,0xFFFF},{64,110,1,0xFFFF},{66,110,1,0x0000},{68,110,1,0xFFFF},{69,110,1,0x0000},{64,111,1,0xFFFF},
+	{66,111,1,0x0000},{68,111,1,0xFFFF},{69,111,1,0x0000},{64,112,1,0xFFFF},{66,112,1,0x0000},{67,112,1,0xFFFF},
+	{68,112,1,0x0000},{64,113,1,0xFFFF},{68,113,1,0x0000},{65,114,1,0xFFFF},{66,114,2,0x0000},{63,115,2,0xFFFF},
+	{66,115,2,0x0000},{64,116,1,0xFFFF},{66,116,1,0x0000},{59,86,1,0x0000},{68,86,1,0x0000},{59,87,1,0xFFFF},
+	{68,87,1,0xFFFF},{74,87,1,0x0000},{55,88,1,0xFFFF},{57,88,1,0x0000},{72,88,2,0x0000},{75,88,2,0xFFFF},
+	{57,89,1,0xFFFF},{59,89,1,0x0000},{70,89,1,0x0000},{72,89,2,0xFFFF},{76,89,1,0xFFFF},{59,90,1,0xFFFF},
+	{60,90,2,0x0000},{70,90,1,0xFFFF},{74,90,1,0x0000},{76,90,1,0xFFFF},{60,91,2,0xFFFF},{62,91,2,0x0000},
+	{64,91,2,0xFFFF},{74,91,1,0x0000},{76,91,1,0xFFFF},{62,92,2,0xFFFF},{64,92,2,0x0000},{74,92,1,0x0000},
+	{76,92,1,0xFFFF},{62,93,1,0xFFFF},{64,93,1,0x0000},{74,93,1,0x0000},{76,93,1,0xFFFF},{62,94,1,0xFFFF},
+	{64,94,1,0x0000},{74,94,1,0x0000},{76,94,1,0xFFFF},{62,95,1,0xFFFF},{64,95,1,0x0000},{74,95,1,0x0000},
+	{76,95,1,0xFFFF},{62,96,1,0xFFFF},{64,96,1,0x0000},{74,96,1,0x0000},{76,96,1,0xFFFF},{62,97,1,0xFFFF},
+	{64,97,1,0x0000},{74,97,1,0x0000},{76,97,1,0xFFFF},{62,98,1,0xFFFF},{64,98,1,0x0000},{74,98,1,0x0000},
+	{76,98,1,0xFFFF},{62,99,1,0xFFFF},{64,99,1,0x0000},{74,99,1,0x0000},{76,99,1,0xFFFF},{62,100,1,0xFFFF},
+	{64,100,1,0x0000},{74,100,1,0x0000},{76,100,1,0xFFFF},{62,101,1,0xFFFF},{64,101,1,0x0000},{74,101,1,0x0000},
+	{76,101,1,0xFFFF},{62,102,1,0xFFFF},{64,102,1,0x0000},{74,102,1,0x0000},{76,102,1,0xFFFF},{62,103,1,0xFFFF},
+	{64,103,1,0x0000},{73,103,1,0x0000},{76,103,1,0xFFFF},{62,104,1,0xFFFF},{64,104,1,0x0000},{73,104,1,0x0000},
+	{76,104,1,0xFFFF},{62,105,1,0xFFFF},{64,105,1,0x0000},{72,105,1,0x0000},{76,105,1,0xFFFF},{56,106,1,0xFFFF},
+	{57,106,1,0x0000},{62,106,1,0xFFFF},{64,106,1,0x0000},{71,106,1,0x0000},{75,106,1,0xFFFF},{57,107,1,0xFFFF},
+	{58,107,1,0x0000},{62,107,1,0xFFFF},{64,107,7,0x0000},{73,107,2,0xFFFF},{57,108,1,0xFFFF},{58,108,1,0x0000},
+	{62,108,1,0xFFFF},{64,108,7,0x0000},{72,108,1,0xFFFF},{58,109,1,0xFFFF},{59,109,1,0x0000},{62,109,1,0xFFFF},
+	{64,109,6,0x0000},{71,109,1,0xFFFF},{59,110,1,0xFFFF},{60,110,1,0x0000},{62,110,1,0xFFFF},{64,110,5,0x0000},
+	{70,110,1,0xFFFF},{59,111,1,0xFFFF},{60,111,1,0x0000},{62,111,1,0xFFFF},{64,111,1,0x0000},{69,111,1,0xFFFF},
+	{60,112,1,0xFFFF},{61,112,1,0x0000},{62,112,1,0xFFFF},{64,112,1,0x0000},{60,113,1,0xFFFF},{64,113,1,0x0000},
+	{61,114,2,0xFFFF},{63,114,1,0x0000},{61,115,2,0xFFFF},{64,115,2,0x0000},{62,116,1,0xFFFF},{64,116,1,0x0000},
+	{56,86,4,0xFFFF},{68,86,1,0xFFFF},{54,87,2,0x0000},{57,87,3,0x0000},{68,87,1,0x0000},{73,87,1,0x0000},
+	{54,88,2,0x0000},{72,88,2,0xFFFF},{75,88,2,0x0000},{54,89,1,0x0000},{56,89,1,0xFFFF},{57,89,2,0x0000},
+	{68,89,3,0xFFFF},{72,89,2,0x0000},{76,89,1,0x0000},{54,90,1,0x0000},{56,90,2,0xFFFF},{59,90,1,0x0000},
+	{64,90,4,0xFFFF},{68,90,3,0x0000},{74,90,1,0xFFFF},{76,90,1,0x0000},{54,91,1,0x0000},{56,91,2,0xFFFF},
+	{62,91,2,0xFFFF},{64,91,4,0x0000},{74,91,1,0xFFFF},{76,91,1,0x0000},{54,92,1,0x0000},{56,92,4,0xFFFF},
+	{62,92,2,0x0000},{74,92,1,0xFFFF},{76,92,1,0x0000},{54,93,1,0x0000},{56,93,2,0xFFFF},{62,93,1,0x0000},
+	{74,93,1,0xFFFF},{76,93,1,0x0000},{54,94,1,0x0000},{56,94,2,0xFFFF},{62,94,1,0x0000},{74,94,1,0xFFFF},
+	{76,94,1,0x0000},{54,95,1,0x0000},{56,95,2,0xFFFF},{62,95,1,0x0000},{74,95,1,0xFFFF},{76,95,1,0x0000},
+	{54,96,1,0x0000},{56,96,2,0xFFFF},{62,96,1,0x0000},{74,96,1,0xFFFF},{76,96,1,0x0000},{54,97,1,0x0000},
+	{56,97,2,0xFFFF},{62,97,1,0x0000},{74,97,1,0xFFFF},{76,97,1,0x0000},{54,98,1,0x0000},{56,98,2,0xFFFF},
+	{62,98,1,0x0000},{74,98,1,0xFFFF},{76,98,1,0x0000},{54,99,1,0x0000},{56,99,2,0xFFFF},{62,99,1,0x0000},
+	{74,99,1,0xFFFF},{76,99,1,0x0000},{54,100,1,0x0000},{56,100,2,0xFFFF},{62,100,1,0x0000},{74,100,1,0xFFFF},
+	{76,100,1,0x0000},{54,101,1,0x0000},{56,101,2,0xFFFF},{62,101,1,0x0000},{74,101,1,0xFFFF},{76,101,1,0x0000},
+	{54,102,1,0x0000},{56,102,2,0xFFFF},{62,102,1,0x0000},{74,102,1,0xFFFF},{76,102,1,0x0000},{55,103,1,0x0000},
+	{56,103,2,0xFFFF},{62,103,1,0x0000},{74,103,1,0xFFFF},{76,103,1,0x0000},{55,104,1,0x0000},{56,104,2,0xFFFF},
+	{62,104,1,0x0000},{74,104,1,0xFFFF},{76,104,1,0x0000},{57,105,1,0xFFFF},{62,105,1,0x0000},{74,105,1,0xFFFF},
+	{76,105,1,0x0000},{57,106,1,0xFFFF},{62,106,1,0x0000},{72,106,2,0xFFFF},{75,106,1,0x0000},{56,107,1,0xFFFF},
+	{62,107,1,0x0000},{71,107,1,0xFFFF},{73,107,2,0x0000},{56,108,1,0xFFFF},{62,108,1,0x0000},{69,108,2,0xFFFF},
+	{72,108,1,0x0000},{57,109,1,0xFFFF},{58,109,5,0x0000},{68,109,1,0xFFFF},{71,109,1,0x0000},{57,110,1,0xFFFF},
+	{59,110,4,0x0000},{66,110,2,0xFFFF},{70,110,1,0x0000},{57,111,1,0xFFFF},{59,111,4,0x0000},{64,111,2,0xFFFF},
+	{68,111,2,0x0000},{57,112,1,0xFFFF},{60,112,3,0x0000},{63,112,1,0xFFFF},{67,112,1,0x0000},{57,113,1,0xFFFF},
+	{60,113,1,0x0000},{61,113,1,0xFFFF},{66,113,1,0x0000},{57,114,1,0xFFFF},{60,114,1,0xFFFF},{61,114,5,0x0000},
+	{57,115,3,0xFFFF},{61,115,3,0x0000},{57,116,1,0xFFFF},{62,116,1,0x0000},{71,87,2,0x0000},{71,88,1,0xFFFF},
+	{73,88,2,0x0000},{68,89,4,0x0000},{73,89,1,0xFFFF},{58,90,19,0xFFFF},{57,91,7,0x0000},{74,91,1,0x0000},
+	{76,91,1,0xFFFF},{57,92,3,0x0000},{74,92,1,0x0000},{76,92,1,0xFFFF},{57,93,1,0x0000},{74,93,1,0x0000},
+	{76,93,1,0xFFFF},{57,94,1,0x0000},{74,94,1,0x0000},{76,94,1,0xFFFF},{57,95,1,0x0000},{74,95,1,0x0000},
+	{76,95,1,0xFFFF},{57,96,1,0x0000},{74,96,1,0x0000},{76,96,1,0xFFFF},{57,97,1,0x0000},{74,97,1,0x0000},
+	{76,97,1,0xFFFF},{57,98,1,0x0000},{74,98,1,0x0000},{76,98,1,0xFFFF},{57,99,1,0x0000},{74,99,1,0x0000},
+	{76,99,1,0xFFFF},{57,100,1,0x0000},{74,100,1,0x0000},{76,100,1,0xFFFF},{57,101,1,0x0000},{74,101,1,0x0000},
+	{76,101,1,0xFFFF},{57,102,1,0x0000},{74,102,1,0x0000},{76,102,1,0xFFFF},{57,103,1,0x0000},{74,103,1,0x0000},
+	{76,103,1,0xFFFF},{57,104,1,0x0000},{74,104,1,0x0000},{76,104,1,0xFFFF},{57,105,1,0x0000},{74,105,1,0x0000},
+	{76,105,1,0xFFFF},{57,106,1,0x0000},{72,106,2,0x0000},{76,106,1,0xFFFF},{57,107,1,0x0000},{71,107,1,0x0000},
+	{76,107,1,0xFFFF},{57,108,1,0x0000},{69,108,2,0x0000},{76,108,1,0xFFFF},{56,109,1,0xFFFF},{57,109,1,0x0000},
+	{68,109,1,0x0000},{76,109,1,0xFFFF},{56,110,21,0xFFFF},{57,111,1,0x0000},{64,111,2,0x0000},{57,112,7,0x0000},
+	{57,113,6,0x0000},{57,114,4,0x0000},{57,115,3,0x0000},{57,116,1,0x0000},{56,86,2,0x0000},{69,86,2,0xFFFF},
+	{56,87,1,0x0000},{57,87,1,0xFFFF},{69,87,2,0x0000},{71,87,1,0xFFFF},{71,88,1,0x0000},{55,89,1,0xFFFF},
+	{56,89,1,0x0000},{74,89,1,0x0000},{54,90,2,0xFFFF},{75,90,2,0x0000},{54,91,1,0xFFFF},{56,91,1,0x0000},
+	{74,91,1,0xFFFF},{76,91,1,0x0000},{54,92,1,0xFFFF},{56,92,1,0x0000},{74,92,1,0xFFFF},{76,92,1,0x0000},
+	{54,93,1,0xFFFF},{56,93,1,0x0000},{74,93,1,0xFFFF},{76,93,1,0x0000},{54,94,1,0xFFFF},{56,94,1,0x0000},
+	{74,94,1,0xFFFF},{76,94,1,0x0000},{54,95,1,0xFFFF},{56,95,1,0x0000},{74,95,1,0xFFFF},{76,95,1,0x0000},
+	{54,96,1,0xFFFF},{56,96,1,0x0000},{74,96,1,0xFFFF},{76,96,1,0x0000},{54,97,1,0xFFFF},{56,97,1,0x0000},
+	{74,97,1,0xFFFF},{76,97,1,0x0000},{54,98,1,0xFFFF},{56,98,1,0x0000},{74,98,1,0xFFFF},{76,98,1,0x0000},
+	{54,99,1,0xFFFF},{56,99,1,0x0000},{74,99,1,0xFFFF},{76,99,1,0x0000},{54,100,1,0xFFFF},{56,100,1,0x0000},
+	{74,100,1,0xFFFF},{76,100,1,0x0000},{54,101,1,0xFFFF},{56,101,1,0x0000},{74,101,1,0xFFFF},{76,101,1,0x0000},
+	{54,102,1,0xFFFF},{56,102,1,0x0000},{74,102,1,0xFFFF},{76,102,1,0x0000},{54,103,1,0xFFFF},{56,103,1,0x0000},
+	{74,103,1,0xFFFF},{76,103,1,0x0000},{54,104,1,0xFFFF},{56,104,1,0x0000},{74,104,1,0xFFFF},{76,104,1,0x0000},
+	{54,105,1,0xFFFF},{56,105,1,0x0000},{74,105,1,0xFFFF},{76,105,1,0x0000},{54,106,1,0xFFFF},{56,106,1,0x0000},
+	{74,106,1,0xFFFF},{76,106,1,0x0000},{54,107,1,0xFFFF},{56,107,1,0x0000},{74,107,1,0xFFFF},{76,107,1,0x0000},
+	{54,108,1,0xFFFF},{56,108,1,0x0000},{74,108,1,0xFFFF},{76,108,1,0x0000},{54,109,1,0xFFFF},{56,109,1,0x0000},
+	{74,109,1,0xFFFF},{76,109,1,0x0000},{54,110,2,0xFFFF},{75,110,2,0x0000},{58,86,1,0x0000},{71,86,2,0xFFFF},
+	{58,87,1,0xFFFF},{71,87,1,0x0000},{72,87,1,0xFFFF},{55,88,1,0xFFFF},{53,89,2,0xFFFF},{55,89,1,0x0000},
+	{72,89,1,0xFFFF},{73,89,1,0x0000},{52,90,2,0xFFFF},{73,90,2,0x0000},{52,91,1,0xFFFF},{54,91,1,0x0000},
+	{72,91,1,0xFFFF},{74,91,1,0x0000},{52,92,1,0xFFFF},{54,92,1,0x0000},{72,92,1,0xFFFF},{74,92,1,0x0000},
+	{52,93,1,0xFFFF},{54,93,1,0x0000},{72,93,1,0xFFFF},{74,93,1,0x0000},{52,94,1,0xFFFF},{54,94,1,0x0000},
+	{72,94,1,0xFFFF},{74,94,1,0x0000},{52,95,1,0xFFFF},{54,95,1,0x0000},{72,95,1,0xFFFF},{74,95,1,0x0000},
+	{52,96,1,0xFFFF},{54,96,1,0x0000},{72,96,1,0xFFFF},{74,96,1,0x0000},{52,97,1,0xFFFF},{54,97,1,0x0000},
+	{72,97,1,0xFFFF},{74,97,1,0x0000},{52,98,1,0xFFFF},{54,98,1,0x0000},{72,98,1,0xFFFF},{74,98,1,0x0000},
+	{52,99,1,0xFFFF},{54,99,1,0x0000},{72,99,1,0xFFFF},{74,99,1,0x0000},{52,100,1,0xFFFF},{54,100,1,0x0000},
+	{72,100,1,0xFFFF},{74,100,1,0x0000},{52,101,1,0xFFFF},{54,101,1,0x0000},{72,101,1,0xFFFF},{74,101,1,0x0000},
+	{52,102,1,0xFFFF},{54,102,1,0x0000},{72,102,1,0xFFFF},{74,102,1,0x0000},{52,103,1,0xFFFF},{54,103,1,0x0000},
+	{72,103,1,0xFFFF},{74,103,1,0x0000},{52,104,1,0xFFFF},{54,104,1,0x0000},{72,104,1,0xFFFF},{74,104,1,0x0000},
+	{52,105,1,0xFFFF},{54,105,1,0x0000},{72,105,1,0xFFFF},{74,105,1,0x0000},{52,106,1,0xFFFF},{54,106,1,0x0000},
+	{72,106,1,0xFFFF},{74,106,1,0x0000},{52,107,1,0xFFFF},{54,107,1,0x0000},{72,107,1,0xFFFF},{74,107,1,0x0000},
+	{52,108,1,0xFFFF},{54,108,1,0x0000},{72,108,1,0xFFFF},{74,108,1,0x0000},{52,109,1,0xFFFF},{54,109,1,0x0000},
+	{72,109,1,0xFFFF},{74,109,1,0x0000},{52,110,2,0xFFFF},{73,110,2,0x0000},{59,86,1,0x0000},{56,87,4,0xFFFF},
+	{54,88,1,0xFFFF},{53,89,1,0x0000},{57,89,4,0xFFFF},{71,89,1,0xFFFF},{52,90,2,0x0000},{55,90,6,0x0000},
+	{65,90,6,0x0000},{52,91,1,0x0000},{54,91,1,0xFFFF},{65,91,4,0xFFFF},{71,91,1,0xFFFF},{52,92,1,0x0000},
+	{54,92,1,0xFFFF},{69,92,3,0xFFFF},{52,93,1,0x0000},{54,93,1,0xFFFF},{71,93,1,0xFFFF},{52,94,1,0x0000},
+	{54,94,1,0xFFFF},{71,94,1,0xFFFF},{52,95,1,0x0000},{54,95,1,0xFFFF},{71,95,1,0xFFFF},{52,96,1,0x0000},
+	{54,96,1,0xFFFF},{71,96,1,0xFFFF},{52,97,1,0x0000},{54,97,1,0xFFFF},{71,97,1,0xFFFF},{52,98,1,0x0000},
+	{54,98,1,0xFFFF},{71,98,1,0xFFFF},{52,99,1,0x0000},{54,99,1,0xFFFF},{71,99,1,0xFFFF},{52,100,1,0x0000},
+	{54,100,1,0xFFFF},{71,100,1,0xFFFF},{52,101,1,0x0000},{54,101,1,0xFFFF},{71,101,1,0xFFFF},{52,102,1,0x0000},
+	{54,102,1,0xFFFF},{71,102,1,0xFFFF},{52,103,1,0x0000},{54,103,1,0xFFFF},{71,103,1,0xFFFF},{52,104,1,0x0000},
+	{54,104,1,0xFFFF},{71,104,1,0xFFFF},{52,105,1,0x0000},{54,105,1,0xFFFF},{71,105,1,0xFFFF},{52,106,1,0x0000},
+	{55,106,2,0xFFFF},{71,106,1,0xFFFF},{52,107,1,0x0000},{57,107,1,0xFFFF},{71,107,1,0xFFFF},{52,108,1,0x0000},
+	{58,108,2,0xFFFF},{71,108,1,0xFFFF},{72,108,1,0x0000},{52,109,1,0x0000},{60,109,1,0xFFFF},{71,109,1,0xFFFF},
+	{72,109,1,0x0000},{52,110,9,0x0000},{63,110,8,0x0000},{72,110,1,0x0000},{63,111,2,0xFFFF},{71,111,1,0xFFFF},
+	{65,112,1,0xFFFF},{71,112,1,0xFFFF},{66,113,2,0xFFFF},{71,113,1,0xFFFF},{68,114,1,0xFFFF},{71,114,1,0xFFFF},
+	{69,115,3,0xFFFF},{71,116,1,0xFFFF},{60,86,1,0x0000},{69,86,4,0x0000},{55,87,6,0xFFFF},{69,87,6,0xFFFF},
+	{52,88,2,0xFFFF},{55,88,2,0x0000},{73,88,2,0xFFFF},{52,89,1,0xFFFF},{55,89,2,0xFFFF},{58,89,3,0x0000},
+	{72,89,1,0x0000},{74,89,1,0xFFFF},{52,90,1,0xFFFF},{54,90,1,0x0000},{58,90,3,0xFFFF},{61,90,4,0x0000},
+	{69,90,2,0xFFFF},{71,90,2,0x0000},{74,90,1,0xFFFF},{52,91,1,0xFFFF},{54,91,1,0x0000},{61,91,4,0xFFFF},
+	{65,91,2,0x0000},{71,91,2,0x0000},{74,91,1,0xFFFF},{52,92,1,0xFFFF},{54,92,1,0x0000},{65,92,2,0xFFFF},
+	{69,92,4,0x0000},{74,92,1,0xFFFF},{52,93,1,0xFFFF},{54,93,1,0x0000},{66,93,1,0xFFFF},{71,93,2,0x0000},
+	{74,93,1,0xFFFF},{52,94,1,0xFFFF},{54,94,1,0x0000},{66,94,1,0xFFFF},{71,94,2,0x0000},{74,94,1,0xFFFF},
+	{52,95,1,0xFFFF},{54,95,1,0x0000},{66,95,1,0xFFFF},{71,95,2,0x0000},{74,95,1,0xFFFF},{52,96,1,0xFFFF},
+	{54,96,1,0x0000},{66,96,1,0xFFFF},{71,96,2,0x0000},{74,96,1,0xFFFF},{52,97,1,0xFFFF},{54,97,1,0x0000},
+	{66,97,1,0xFFFF},{71,97,2,0x0000},{74,97,1,0xFFFF},{52,98,1,0xFFFF},{54,98,1,0x0000},{66,98,1,0xFFFF},
+	{71,98,2,0x0000},{74,98,1,0xFFFF},{52,99,1,0xFFFF},{54,99,1,0x0000},{66,99,1,0xFFFF},{71,99,2,0x0000},
+	{74,99,1,0xFFFF},{52,100,1,0xFFFF},{54,100,1,0x0000},{66,100,1,0xFFFF},{71,100,2,0x0000},{74,100,1,0xFFFF},
+	{52,101,1,0xFFFF},{54,101,1,0x0000},{66,101,1,0xFFFF},{71,101,2,0x0000},{74,101,1,0xFFFF},{52,102,1,0xFFFF},
+	{54,102,1,0x0000},{66,102,1,0xFFFF},{71,102,2,0x0000},{74,102,1,0xFFFF},{52,103,1,0xFFFF},{54,103,1,0x0000},
+	{66,103,1,0xFFFF},{71,103,2,0x0000},{73,103,1,0xFFFF},{52,104,1,0xFFFF},{54,104,1,0x0000},{66,104,1,0xFFFF},
+	{71,104,2,0x0000},{73,104,1,0xFFFF},{52,105,1,0xFFFF},{54,105,1,0x0000},{66,105,1,0xFFFF},{71,105,1,0x0000},
+	{53,106,1,0xFFFF},{55,106,2,0x0000},{66,106,1,0xFFFF},{71,106,1,0x0000},{54,107,2,0xFFFF},{57,107,1,0x0000},
+	{66,107,1,0xFFFF},{72,107,1,0x0000},{56,108,1,0xFFFF},{58,108,2,0x0000},{66,108,1,0xFFFF},{57,109,1,0xFFFF},
+	{60,109,1,0x0000},{66,109,1,0xFFFF},{70,109,1,0xFFFF},{71,109,1,0x0000},{58,110,2,0xFFFF},{61,110,2,0x0000},
+	{66,110,1,0xFFFF},{69,110,1,0xFFFF},{71,110,1,0x0000},{60,111,1,0xFFFF},{63,111,2,0x0000},{66,111,1,0xFFFF},
+	{69,111,1,0xFFFF},{71,111,1,0x0000},{61,112,1,0xFFFF},{65,112,1,0x0000},{66,112,1,0xFFFF},{68,112,1,0xFFFF},
+	{71,112,1,0x0000},{62,113,1,0xFFFF},{67,113,1,0x0000},{68,113,1,0xFFFF},{71,113,1,0x0000},{63,114,2,0xFFFF},
+	{66,114,2,0xFFFF},{68,114,4,0x0000},{65,115,3,0xFFFF},{69,115,3,0x0000},{66,116,1,0xFFFF},{71,116,1,0x0000},
+	{59,86,2,0xFFFF},{54,87,1,0xFFFF},{59,87,2,0x0000},{52,88,2,0x0000},{56,88,2,0xFFFF},{52,89,1,0x0000},
+	{55,89,3,0x0000},{58,89,2,0xFFFF},{70,89,1,0xFFFF},{52,90,1,0x0000},{54,90,1,0xFFFF},{58,90,2,0x0000},
+	{61,90,1,0xFFFF},{68,90,1,0xFFFF},{70,90,1,0x0000},{52,91,1,0x0000},{54,91,1,0xFFFF},{61,91,1,0x0000},
+	{64,91,1,0x0000},{66,91,1,0xFFFF},{68,91,1,0x0000},{52,92,1,0x0000},{54,92,1,0xFFFF},{64,92,1,0xFFFF},
+	{66,92,1,0x0000},{52,93,1,0x0000},{54,93,1,0xFFFF},{64,93,1,0xFFFF},{66,93,1,0x0000},{52,94,1,0x0000},
+	{54,94,1,0xFFFF},{64,94,1,0xFFFF},{66,94,1,0x0000},{52,95,1,0x0000},{54,95,1,0xFFFF},{64,95,1,0xFFFF},
+	{66,95,1,0x0000},{52,96,1,0x0000},{54,96,1,0xFFFF},{64,96,1,0xFFFF},{66,96,1,0x0000},{52,97,1,0x0000},
+	{54,97,1,0xFFFF},{64,97,1,0xFFFF},{66,97,1,0x0000},{52,98,1,0x0000},{54,98,1,0xFFFF},{64,98,1,0xFFFF},
+	{66,98,1,0x0000},{52,99,1,0x0000},{54,99,1,0xFFFF},{64,99,1,0xFFFF},{66,99,1,0x0000},{52,100,1,0x0000},
+	{54,100,1,0xFFFF},{64,100,1,0xFFFF},{66,100,1,0x0000},{52,101,1,0x0000},{54,101,1,0xFFFF},{64,101,1,0xFFFF},
+	{66,101,1,0x0000},{52,102,1,0x0000},{54,102,1,0xFFFF},{64,102,1,0xFFFF},{66,102,1,0x0000},{52,103,1,0x0000},
+	{55,103,1,0xFFFF},{64,103,1,0xFFFF},{66,103,1,0x0000},{52,104,1,0x0000},{55,104,1,0xFFFF},{64,104,1,0xFFFF},
+	{66,104,1,0x0000},{52,105,1,0x0000},{56,105,1,0xFFFF},{64,105,1,0xFFFF},{66,105,1,0x0000},{53,106,1,0x0000},
+	{57,106,1,0xFFFF},{64,106,1,0xFFFF},{66,106,1,0x0000},{71,106,1,0xFFFF},{72,106,1,0x0000},{54,107,2,0x0000},
+	{58,107,1,0xFFFF},{64,107,1,0xFFFF},{66,107,1,0x0000},{70,107,1,0xFFFF},{71,107,1,0x0000},{56,108,1,0x0000},
+	{58,108,1,0xFFFF},{64,108,1,0xFFFF},{66,108,1,0x0000},{70,108,1,0xFFFF},{71,108,1,0x0000},{57,109,1,0x0000},
+	{59,109,1,0xFFFF},{64,109,1,0xFFFF},{66,109,1,0x0000},{69,109,1,0xFFFF},{70,109,1,0x0000},{58,110,2,0x0000},
+	{60,110,1,0xFFFF},{64,110,1,0xFFFF},{66,110,1,0x0000},{68,110,1,0xFFFF},{69,110,1,0x0000},{64,111,1,0xFFFF},
+	{66,111,1,0x0000},{68,111,1,0xFFFF},{69,111,1,0x0000},{64,112,1,0xFFFF},{66,112,1,0x0000},{67,112,1,0xFFFF},
+	{68,112,1,0x0000},{64,113,1,0xFFFF},{68,113,1,0x0000},{65,114,1,0xFFFF},{66,114,2,0x0000},{63,115,2,0xFFFF},
+	{66,115,2,0x0000},{64,116,1,0xFFFF},{66,116,1,0x0000},
+};
+
+static const uint16_t CubeStart[34] = {
+	0,87,210,346,418,508,598,680,816,939,1062,1198,
+	1270,1360,1450,1532,1668,1791,1914,2050,2122,2212,2302,2384,
+	2520,2643,2766,2902,2974,3064,3154,3236,3372,3495};
+
+const Anim CubeAnim = {32, CubeStart, CubeSpans};
@@ -0,0 +1,13 @@
+// CubeAnim.h
+// Runs on TM4C123
+// Generated by Host/BakeCube.c, do not edit.
+
+#ifndef _CUBEANIMH_
+#define _CUBEANIMH_
+
+#include "Anim.h"
+
+// One turn of the hidden line cube, 32 frames
+extern const Anim CubeAnim;
+
+#endif
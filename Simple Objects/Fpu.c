@@ -0,0 +1,16 @@
+// Fpu.c
+// Runs on TM4C123
+// Floating point unit setup.
+
+#include <stdint.h>
+#include "Fpu.h"
+#include "tm4c123gh6pm.h"
+
+void Fpu_Init(void){
+	NVIC_CPAC_R |= NVIC_CPAC_CP10_FULL|NVIC_CPAC_CP11_FULL;
+	NVIC_FPCC_R |= NVIC_FPCC_ASPEN|NVIC_FPCC_LSPEN; // lazy stacking
+#if defined(__GNUC__)
+	// Access takes effect once the pipeline is flushed
+	__asm volatile("dsb\n\tisb" ::: "memory");
+#endif
+}
@@ -0,0 +1,55 @@
+// Frame.h
+// Runs on TM4C123
+// Fixed timestep frame scheduler. SysTick interrupts once a millisecond
+// and every frame starts on a multiple of the frame period, however long
+// the one before took to draw, so animations keep the same speed as the
+// scene grows. The slack at the end of each frame is spent asleep in WFI
+// instead of spinning in Delay1ms.
+
+#ifndef _FRAMEH_
+#define _FRAMEH_
+
+#include <stdint.h>
+
+// Milliseconds since Frame_Init, counted by SysTick_Handler
+extern volatile uint32_t Frame_Ticks;
+
+// Frames that were still drawing when their slot ended
+extern uint32_t Frame_Overruns;
+
+// Milliseconds the last frame spent working before Frame_Done, or
+// before Frame_Wait if it did not call Frame_Done
+extern uint16_t Frame_Busy;
+
+//------------Frame_Init------------
+// Start the millisecond SysTick interrupt and the first frame.
+// Interrupts are enabled.
+// Input: busHz     bus clock frequency, 80000000 after PLL_Init(Bus80MHz)
+//        periodMs  frame period in milliseconds
+// Output: none
+void Frame_Init(uint32_t busHz, uint16_t periodMs);
+
+//------------Frame_Done------------
+// Mark the end of the frame's own work. Whatever runs between here and
+// Frame_Wait is left out of Frame_Busy, so background jobs can use up the
+// slack without looking like load to the quality controller.
+// Input: none
+// Output: none
+void Frame_Done(void);
+
+//------------Frame_Left------------
+// Time left before the next frame is due.
+// Input: none
+// Output: whole milliseconds left, 0 once the frame has overrun
+uint16_t Frame_Left(void);
+
+//------------Frame_Wait------------
+// End the current frame and sleep until the next one is due. A frame
+// that overran is counted in Frame_Overruns and the next one starts on
+// the following period boundary, so the schedule never drifts.
+// Input: none
+// Output: frame periods since the last frame started, more than 1 after
+//         an overrun so animations can step ahead to catch up
+uint16_t Frame_Wait(void);
+
+#endif
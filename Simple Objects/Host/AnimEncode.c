@@ -0,0 +1,172 @@
+// AnimEncode.c
+// Runs on a PC
+// Encoder for the AnimClip byte stream played by Anim_PlayClip.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <ctype.h>
+#include "ST7735.h"
+#include "Anim.h"
+#include "AnimEncode.h"
+
+#define W ST7735_TFTWIDTH
+#define H ST7735_TFTHEIGHT
+
+// Unchanged pixels worth resending to keep one window open, a window
+// costs 11 bytes and each pixel 2
+#define MAXGAP  5
+// Shortest same color stretch split out of a literal as its own fill,
+// it saves 2 bytes of flash per pixel but costs a window
+#define MINFILL 8
+// Pixels in one run
+#define MAXRUN  128
+
+static void put(AnimEncoder *e, uint8_t b){
+	if(e->len >= ANIMENCODE_MAX){
+		e->full = 1;
+		return;
+	}
+	e->data[e->len++] = b;
+}
+
+// Run header and the first color, high byte first like the SPI bus
+static void putRun(AnimEncoder *e, int x, int y, uint8_t n, uint16_t color){
+	put(e, x);
+	put(e, y);
+	put(e, n);
+	put(e, color >> 8);
+	put(e, color);
+}
+
+// Same color pixels of row r from x on, at most to x1
+static int sameRun(const uint16_t *r, int x, int x1){
+	int k = x;
+	while(k < x1 && r[k + 1] == r[x])
+		k++;
+	return k - x + 1;
+}
+
+// Literal run of pixels x0 to x1-1 of row y, or a fill if they all match
+static void putLiteral(AnimEncoder *e, const uint16_t *r, int y, int x0, int x1, uint32_t *spi){
+	int k;
+	*spi += 11 + 2*(x1 - x0);
+	if(sameRun(r, x0, x1 - 1) == x1 - x0){
+		putRun(e, x0, y, x1 - x0 - 1, r[x0]);
+		return;
+	}
+	putRun(e, x0, y, ANIM_LITERAL | (x1 - x0 - 1), r[x0]);
+	for(k = x0 + 1; k < x1; k++){
+		put(e, r[k] >> 8);
+		put(e, r[k]);
+	}
+}
+
+// Pack pixels x0 to x1 of row y as fill and literal runs. Long stretches
+// of one color become fills, everything between them one literal.
+static void packSegment(AnimEncoder *e, const uint16_t *r, int y, int x0, int x1, uint32_t *spi){
+	int x = x0, lit = -1, n;
+	while(x <= x1){
+		n = sameRun(r, x, x1);
+		if(n >= MINFILL || (lit < 0 && x + n - 1 == x1)){
+			if(lit >= 0)
+				putLiteral(e, r, y, lit, x, spi);
+			lit = -1;
+			if(n > MAXRUN)
+				n = MAXRUN;
+			putRun(e, x, y, n - 1, r[x]);
+			*spi += 11 + 2*n;
+			x += n;
+			continue;
+		}
+		if(lit < 0)
+			lit = x;
+		while(n--){
+			x++;
+			if(x - lit == MAXRUN){
+				putLiteral(e, r, y, lit, x, spi);
+				lit = n ? x : -1;
+			}
+		}
+	}
+	if(lit >= 0)
+		putLiteral(e, r, y, lit, x, spi);
+}
+
+// Append the runs that turn frame a into frame b and the entry end mark
+static void encodeEntry(AnimEncoder *e, const AnimFrame a, const AnimFrame b, uint32_t *spi){
+	int x, y, end, gap;
+	for(y = 0; y < H; y++){
+		x = 0;
+		while(x < W){
+			if(a[y][x] == b[y][x]){
+				x++;
+				continue;
+			}
+			// Take in later changes while the unchanged gaps stay short
+			end = x;
+			for(gap = 1; end + gap < W && gap <= MAXGAP + 1; gap++){
+				if(a[y][end + gap] != b[y][end + gap]){
+					end += gap;
+					gap = 0;
+				}
+			}
+			packSegment(e, b[y], y, x, end, spi);
+			x = end + 1;
+		}
+	}
+	put(e, ANIM_END);
+}
+
+int AnimEncode_Clip(AnimEncoder *e, const AnimFrame *frames, uint16_t n, uint16_t bg){
+	static AnimFrame Blank;
+	uint32_t spi = 0;
+	int x, y, k;
+	for(y = 0; y < H; y++){
+		for(x = 0; x < W; x++){
+			Blank[y][x] = bg;
+		}
+	}
+	e->len = 0;
+	e->full = 0;
+	e->numFrames = n;
+	encodeEntry(e, Blank, frames[0], &spi);
+	e->loop = e->len;
+	e->spiBytes = 0;
+	for(k = 1; k <= n; k++){
+		encodeEntry(e, frames[k - 1], frames[k % n], &e->spiBytes);
+	}
+	put(e, ANIM_LOOP);
+	return !e->full;
+}
+
+int AnimEncode_Write(const AnimEncoder *e, const char *name, const char *what){
+	char file[256], guard[64];
+	FILE *f;
+	uint32_t i;
+
+	snprintf(file, sizeof(file), "%s.h", name);
+	if((f = fopen(file, "w")) == 0)
+		return 0;
+	fprintf(f, "// %s.h\n// Runs on TM4C123\n// Generated by the host encoder, do not edit.\n\n", name);
+	for(i = 0; name[i] && i < sizeof(guard) - 1; i++){
+		guard[i] = toupper((unsigned char)name[i]);
+	}
+	guard[i] = 0;
+	fprintf(f, "#ifndef _%sH_\n#define _%sH_\n\n#include \"Anim.h\"\n\n", guard, guard);
+	fprintf(f, "// %s, %d frames\nextern const AnimClip %s;\n\n#endif\n", what, e->numFrames, name);
+	fclose(f);
+
+	snprintf(file, sizeof(file), "%s.c", name);
+	if((f = fopen(file, "w")) == 0)
+		return 0;
+	fprintf(f, "// %s.c\n// Runs on TM4C123\n// Generated by the host encoder, do not edit.\n\n", name);
+	fprintf(f, "#include <stdint.h>\n#include \"Anim.h\"\n#include \"%s.h\"\n\n", name);
+	fprintf(f, "static const uint8_t %sData[%lu] = {", name, (unsigned long)e->len);
+	for(i = 0; i < e->len; i++){
+		fprintf(f, "%s%d", i == 0 ? "\n\t" : (i % 24) ? "," : ",\n\t", e->data[i]);
+	}
+	fprintf(f, "\n};\n\nconst AnimClip %s = {%d, %lu, %sData};\n", name, e->numFrames,
+	        (unsigned long)e->loop, name);
+	fclose(f);
+	return 1;
+}
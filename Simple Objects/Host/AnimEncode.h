@@ -0,0 +1,45 @@
+// AnimEncode.h
+// Runs on a PC
+// Encoder for the AnimClip byte stream played by Anim_PlayClip. Frames
+// are taken from the simulated panel, compared with the frame before,
+// and the changed pixels of each row are packed as fill or literal runs.
+
+#ifndef _ANIMENCODEH_
+#define _ANIMENCODEH_
+
+#include <stdint.h>
+#include "ST7735.h"
+
+// Largest clip the encoder will build
+#define ANIMENCODE_MAX 0x40000
+
+typedef uint16_t AnimFrame[ST7735_TFTHEIGHT][ST7735_TFTWIDTH];
+
+typedef struct {
+	uint8_t data[ANIMENCODE_MAX];
+	uint32_t len;
+	uint32_t loop;          // offset of entry 1
+	uint16_t numFrames;
+	uint32_t spiBytes;      // bytes the entries 1 to numFrames put on the bus
+	uint8_t full;           // set when the clip ran out of room
+} AnimEncoder;
+
+//------------AnimEncode_Clip------------
+// Encode a looping animation: entry 0 draws frames[0] over bg, entries
+// 1 to n step through the frames and back to frames[0].
+// Input: e       encoder to fill
+//        frames  the n frames of one loop
+//        n       number of frames
+//        bg      color the screen is cleared to before entry 0
+// Output: 1 on success, 0 if the clip did not fit
+int AnimEncode_Clip(AnimEncoder *e, const AnimFrame *frames, uint16_t n, uint16_t bg);
+
+//------------AnimEncode_Write------------
+// Write an encoded clip as name.c and name.h, declaring const AnimClip name.
+// Input: e     encoded clip
+//        name  C identifier and file name stem
+//        what  one line description for the header
+// Output: 1 on success, 0 if a file could not be written
+int AnimEncode_Write(const AnimEncoder *e, const char *name, const char *what);
+
+#endif
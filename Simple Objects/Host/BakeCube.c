@@ -0,0 +1,149 @@
+// BakeCube.c
+// Runs on a PC
+// Bakes one full turn of the hidden line cube into CubeAnim.c and
+// CubeAnim.h for Anim_Play. Every frame is rendered into the simulated
+// panel, then compared with the frame before it, and the pixels that
+// changed are written out as horizontal spans of one color. A span is
+// stretched over a few unchanged pixels of the same color when that is
+// cheaper than opening another address window.
+// Build and run from the Simple Objects folder:
+//   gcc -O2 -I. -o bakecube Host/BakeCube.c Host/HostLCD.c Raster.c Mesh.c Camera.c Trig.c
+//   ./bakecube
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "ST7735.h"
+#include "Mesh.h"
+#include "Camera.h"
+#include "Trig.h"
+#include "Anim.h"
+#include "HostLCD.h"
+
+// Same cube, camera and turn rate as the Demo mode of ST7735TestMain.c
+#define DIMYR  5
+#define FZ     12
+#define SPIN   (TRIG_STEPS/32)
+#define FRAMES (TRIG_STEPS/SPIN)
+#define COLOR  0xFFFF
+
+// Longest run of unchanged pixels worth resending inside a span, a new
+// window costs 11 bytes and each pixel 2
+#define MAXGAP 5
+
+#define W ST7735_TFTWIDTH
+#define H ST7735_TFTHEIGHT
+
+static const uint8_t CubeFaces[6][4] = {{0,1,2,3},{7,6,5,4},{0,4,5,1},
+                                        {1,5,6,2},{2,6,7,3},{3,7,4,0}};
+static const MeshEdge CubeEdges[12] = {
+	{0,1,0,2},{1,2,0,3},{2,3,0,4},{3,0,0,5},
+	{4,5,1,2},{5,6,1,3},{6,7,1,4},{7,4,1,5},
+	{0,4,2,5},{1,5,2,3},{2,6,3,4},{3,7,4,5}
+};
+static const Mesh CubeMesh = {8, 6, 12, CubeFaces, CubeEdges, 0};
+
+static Camera View;
+static uint16_t Frames[FRAMES][H][W];
+static uint16_t Blank[H][W];
+
+static void drawCube(uint16_t angle, uint16_t color){
+	int16_t sx[8], sy[8];
+	uint32_t front[MESH_MASKWORDS];
+	uint8_t k;
+	for(k = 0; k < 4; k++){
+		uint16_t j = TRIG_WRAP(angle + k*TRIG_QUARTER);
+		int16_t x = TRIG_MAKESIN(j, 7);
+		int16_t z = (16 + TRIG_MAKECOS(j, 5)) >> 1;
+		Camera_Project(&View, x, DIMYR, z, &sx[k], &sy[k]);
+		Camera_Project(&View, x, -DIMYR, z, &sx[k+4], &sy[k+4]);
+	}
+	Mesh_FrontFaces(&CubeMesh, sx, sy, front);
+	Mesh_DrawWire(&CubeMesh, sx, sy, front, color, MESH_FRONTEDGES);
+}
+
+// Write the spans that turn frame a into frame b, return their SPI bytes
+static unsigned long diff(FILE *f, uint16_t (*a)[W], uint16_t (*b)[W], unsigned *count){
+	unsigned long bytes = 0;
+	int x, y, end, gap;
+	for(y = 0; y < H; y++){
+		x = 0;
+		while(x < W){
+			if(a[y][x] == b[y][x]){
+				x++;
+				continue;
+			}
+			// Grow the span while the color holds and gaps stay short
+			end = x;
+			gap = 0;
+			while(end + 1 + gap < W && b[y][end + 1 + gap] == b[y][x] && gap <= MAXGAP){
+				if(a[y][end + 1 + gap] != b[y][end + 1 + gap]){
+					end += gap + 1;
+					gap = 0;
+				}
+				else{
+					gap++;
+				}
+			}
+			fprintf(f, "%s{%d,%d,%d,0x%04X},", (*count % 6) ? "" : "\n\t", x, y, end - x + 1, b[y][x]);
+			bytes += 11 + 2*(end - x + 1);
+			(*count)++;
+			x = end + 1;
+		}
+	}
+	return bytes;
+}
+
+int main(void){
+	FILE *c, *h;
+	unsigned start[FRAMES + 2];
+	unsigned long baked = 0, live;
+	unsigned count = 0;
+	int k;
+
+	Camera_Init(&View, 0, -10, 0, FZ, 64, 80);
+	for(k = 0; k < FRAMES; k++){
+		HostLCD_Reset();
+		drawCube(k*SPIN, COLOR);
+		memcpy(Frames[k], HostLCD_Frame, sizeof(HostLCD_Frame));
+	}
+	// What the same turn costs when it is rendered live, erase then draw
+	HostLCD_Reset();
+	for(k = 0; k < FRAMES; k++){
+		drawCube((k ? k - 1 : FRAMES - 1)*SPIN, 0x0000);
+		drawCube(k*SPIN, COLOR);
+	}
+	live = HostLCD_Bytes;
+
+	c = fopen("CubeAnim.c", "w");
+	h = fopen("CubeAnim.h", "w");
+	if(c == 0 || h == 0){
+		fprintf(stderr, "could not create CubeAnim.c or CubeAnim.h\n");
+		return 1;
+	}
+	fprintf(h, "// CubeAnim.h\n// Runs on TM4C123\n// Generated by Host/BakeCube.c, do not edit.\n\n"
+	           "#ifndef _CUBEANIMH_\n#define _CUBEANIMH_\n\n#include \"Anim.h\"\n\n"
+	           "// One turn of the hidden line cube, %d frames\nextern const Anim CubeAnim;\n\n#endif\n", FRAMES);
+	fprintf(c, "// CubeAnim.c\n// Runs on TM4C123\n// Generated by Host/BakeCube.c, do not edit.\n\n"
+	           "#include <stdint.h>\n#include \"Anim.h\"\n#include \"CubeAnim.h\"\n\n"
+	           "static const AnimSpan CubeSpans[] = {");
+	start[0] = 0;
+	diff(c, Blank, Frames[0], &count);
+	for(k = 1; k <= FRAMES; k++){
+		start[k] = count;
+		baked += diff(c, Frames[k - 1], Frames[k % FRAMES], &count);
+	}
+	start[FRAMES + 1] = count;
+	fprintf(c, "\n};\n\nstatic const uint16_t CubeStart[%d] = {", FRAMES + 2);
+	for(k = 0; k < FRAMES + 2; k++){
+		fprintf(c, "%s%u", k == 0 ? "\n\t" : (k % 12) ? "," : ",\n\t", start[k]);
+	}
+	fprintf(c, "};\n\nconst Anim CubeAnim = {%d, CubeStart, CubeSpans};\n", FRAMES);
+	fclose(c);
+	fclose(h);
+
+	printf("%d frames, %u spans, %u bytes of flash\n", FRAMES, count,
+	       (unsigned)(count*sizeof(AnimSpan) + (FRAMES + 2)*sizeof(uint16_t)));
+	printf("SPI bytes per turn: live %lu, baked %lu\n", live, baked);
+	return 0;
+}
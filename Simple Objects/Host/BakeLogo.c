@@ -0,0 +1,127 @@
+// BakeLogo.c
+// Runs on a PC
+// Bakes one turn of the shaded solid cube into LogoClip.c and LogoClip.h
+// for Anim_PlayClip, then plays the clip back on the simulated panel to
+// check every decoded frame against the rendered one. The shaded faces
+// give the encoder a mix of fill and literal runs.
+// Build and run from the Simple Objects folder:
+//   gcc -O2 -I. -o bakelogo Host/BakeLogo.c Host/AnimEncode.c Host/HostLCD.c Anim.c Raster.c Mesh.c Camera.c Trig.c
+//   ./bakelogo
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "ST7735.h"
+#include "Raster.h"
+#include "Mesh.h"
+#include "Camera.h"
+#include "Trig.h"
+#include "Anim.h"
+#include "HostLCD.h"
+#include "AnimEncode.h"
+
+// Same cube, camera and turn rate as the Solid mode of ST7735TestMain.c
+#define DIMYR  5
+#define FZ     12
+#define SPIN   (TRIG_STEPS/32)
+#define FRAMES (TRIG_STEPS/SPIN)
+
+static const uint8_t CubeFaces[6][4] = {{0,1,2,3},{7,6,5,4},{0,4,5,1},
+                                        {1,5,6,2},{2,6,7,3},{3,7,4,0}};
+static const MeshEdge CubeEdges[12] = {
+	{0,1,0,2},{1,2,0,3},{2,3,0,4},{3,0,0,5},
+	{4,5,1,2},{5,6,1,3},{6,7,1,4},{7,4,1,5},
+	{0,4,2,5},{1,5,2,3},{2,6,3,4},{3,7,4,5}
+};
+static const Mesh CubeMesh = {8, 6, 12, CubeFaces, CubeEdges, 0};
+
+static Camera View;
+static AnimFrame Frames[FRAMES];
+static AnimEncoder Clip, Still;
+// Frames 0, 1, 1: the repeated frame gives an entry with no runs
+static AnimFrame Repeat[3];
+
+static void drawCube(uint16_t angle, uint8_t erase){
+	int16_t v[8][3], sx[8], sy[8];
+	uint16_t colors[6];
+	uint32_t front[MESH_MASKWORDS];
+	uint8_t k, f;
+	for(k = 0; k < 4; k++){
+		uint16_t j = TRIG_WRAP(angle + k*TRIG_QUARTER);
+		v[k][0] = v[k+4][0] = TRIG_MAKESIN(j, 7);
+		v[k][1] = DIMYR;
+		v[k+4][1] = -DIMYR;
+		v[k][2] = v[k+4][2] = (16 + TRIG_MAKECOS(j, 5)) >> 1;
+	}
+	for(k = 0; k < 8; k++){
+		Camera_Project(&View, v[k][0], v[k][1], v[k][2], &sx[k], &sy[k]);
+	}
+	Mesh_FrontFaces(&CubeMesh, sx, sy, front);
+	for(f = 0; f < 6; f++){
+		const uint8_t *q = CubeFaces[f];
+		int16_t *p0 = v[q[0]], *p1 = v[q[1]], *p2 = v[q[2]];
+		int16_t ux = p1[0]-p0[0], uy = p1[1]-p0[1], uz = p1[2]-p0[2];
+		int16_t wx = p2[0]-p0[0], wy = p2[1]-p0[1], wz = p2[2]-p0[2];
+		colors[f] = erase ? 0x0000 : Raster_Shade(uy*wz - uz*wy, uz*wx - ux*wz, ux*wy - uy*wx, 31);
+	}
+	Mesh_DrawSolid(&CubeMesh, sx, sy, front, colors);
+}
+
+// Play two loops of an encoded clip, return how many decoded frames
+// differ from the ones it was made from
+static int check(const AnimEncoder *e, const AnimFrame *frames, int n){
+	const AnimClip clip = {e->numFrames, e->loop, e->data};
+	const uint8_t *p;
+	int k, bad = 0;
+	HostLCD_Reset();
+	p = Anim_PlayClip(&clip, 0);
+	for(k = 1; k <= 2*n; k++){
+		p = Anim_PlayClip(&clip, p);
+		if(memcmp(HostLCD_Frame, frames[k % n], sizeof(HostLCD_Frame)))
+			bad++;
+	}
+	return bad;
+}
+
+int main(void){
+	uint32_t live;
+	int k, bad = 0;
+
+	Camera_Init(&View, 0, -10, 0, FZ, 64, 80);
+	for(k = 0; k < FRAMES; k++){
+		HostLCD_Reset();
+		drawCube(k*SPIN, 0);
+		memcpy(Frames[k], HostLCD_Frame, sizeof(HostLCD_Frame));
+	}
+	// What the same turn costs when it is rendered live, erase then draw
+	HostLCD_Reset();
+	for(k = 0; k < FRAMES; k++){
+		drawCube((k ? k - 1 : FRAMES - 1)*SPIN, 1);
+		drawCube(k*SPIN, 0);
+	}
+	live = HostLCD_Bytes;
+
+	if(!AnimEncode_Clip(&Clip, Frames, FRAMES, 0x0000)){
+		fprintf(stderr, "clip larger than %d bytes\n", ANIMENCODE_MAX);
+		return 1;
+	}
+	if(!AnimEncode_Write(&Clip, "LogoClip", "One turn of the shaded solid cube")){
+		fprintf(stderr, "could not create LogoClip.c or LogoClip.h\n");
+		return 1;
+	}
+
+	// Two loops through the decoder must reproduce every frame, also
+	// for a clip that holds a frame still
+	bad = check(&Clip, Frames, FRAMES);
+	memcpy(Repeat[0], Frames[0], sizeof(AnimFrame));
+	memcpy(Repeat[1], Frames[1], sizeof(AnimFrame));
+	memcpy(Repeat[2], Frames[1], sizeof(AnimFrame));
+	AnimEncode_Clip(&Still, Repeat, 3, 0x0000);
+	bad += check(&Still, Repeat, 3);
+
+	printf("%d frames, clip %lu bytes of flash, full frames %lu\n", FRAMES,
+	       (unsigned long)Clip.len, (unsigned long)FRAMES*sizeof(AnimFrame));
+	printf("SPI bytes per turn: live %lu, clip %lu\n", (unsigned long)live, (unsigned long)Clip.spiBytes);
+	printf("decoded frames that differ: %d\n", bad);
+	return bad != 0;
+}
@@ -0,0 +1,98 @@
+// BenchDepth.c
+// Runs on a PC
+// Measures the per-pixel cost of the band depth test. The same random
+// faces are drawn twice over the whole screen, band by band: once through
+// Band_Render with the depth test and once as plain spans over the same
+// Raster_Extents rows. Both stream every band to the simulated panel, so
+// the difference is the depth test.
+// Build from the Simple Objects folder:
+//   gcc -O2 -I. -o benchdepth Host/BenchDepth.c Host/HostLCD.c Band.c Raster.c
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "ST7735.h"
+#include "Raster.h"
+#include "Band.h"
+
+#define FACES  BAND_MAXFACES
+#define ROUNDS 2000
+
+static int16_t Xs[FACES][4], Ys[FACES][4];
+static uint32_t Pixels;
+
+static void countSpan(int16_t x, int16_t y, int16_t w, uint16_t color){
+	(void)x; (void)y; (void)color;
+	Pixels += w;
+}
+
+// Band_FillFace without the depth test
+static void fillFlat(int i, int16_t top){
+	int16_t l[BAND_ROWS], r[BAND_ROWS];
+	int16_t y;
+	Raster_Extents(Xs[i], Ys[i], 4, top, top + BAND_ROWS - 1, l, r);
+	for(y = 0; y < BAND_ROWS; y++){
+		int16_t x0 = l[y] < 0 ? 0 : l[y];
+		int16_t x1 = r[y] >= BAND_W ? BAND_W - 1 : r[y];
+		if(x0 <= x1)
+			Band_Span(x0, top + y, x1 - x0 + 1, 0xFFFF);
+	}
+}
+
+static double now(void){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+int main(void){
+	uint16_t ds[4];
+	double t0, tDepth, tFlat;
+	int i, r, top;
+
+	srand(1);
+	Band_ClearFaces();
+	for(i = 0; i < FACES; i++){
+		int16_t cx = rand() % 128, cy = rand() % 160;
+		int16_t w = 8 + rand() % 40, h = 8 + rand() % 40, s = rand() % 12;
+		Xs[i][0] = cx - w; Ys[i][0] = cy - h + s;
+		Xs[i][1] = cx + w; Ys[i][1] = cy - h;
+		Xs[i][2] = cx + w; Ys[i][2] = cy + h - s;
+		Xs[i][3] = cx - w; Ys[i][3] = cy + h;
+		ds[0] = Band_Depth(5 + rand() % 20);
+		ds[1] = Band_Depth(5 + rand() % 20);
+		ds[2] = Band_Depth(5 + rand() % 20);
+		ds[3] = ds[0] + ds[2] - ds[1];
+		Band_AddFace(Xs[i], Ys[i], ds, 4, 0xFFFF);
+	}
+
+	Raster_SetSpanOutput(countSpan);
+	for(i = 0; i < FACES; i++){
+		Raster_FillConvex(Xs[i], Ys[i], 4, 0xFFFF);
+	}
+
+	t0 = now();
+	for(r = 0; r < ROUNDS; r++){
+		for(top = 0; top < ST7735_TFTHEIGHT; top += BAND_ROWS){
+			Band_Begin(top, 0);
+			for(i = 0; i < FACES; i++){
+				fillFlat(i, top);
+			}
+			Band_Flush(0, BAND_W - 1);
+		}
+	}
+	tFlat = now() - t0;
+
+	t0 = now();
+	for(r = 0; r < ROUNDS; r++){
+		Band_Render(0, ST7735_TFTHEIGHT - 1, 0);
+	}
+	tDepth = now() - t0;
+
+	printf("%d faces, %lu pixels per frame, %d frames\n", FACES, (unsigned long)Pixels, ROUNDS);
+	printf("plain span fill   %6.2f ns/pixel\n", tFlat*1e9/ROUNDS/Pixels);
+	printf("depth tested fill %6.2f ns/pixel\n", tDepth*1e9/ROUNDS/Pixels);
+	printf("depth test cost   %6.2f ns/pixel\n", (tDepth - tFlat)*1e9/ROUNDS/Pixels);
+	return 0;
+}
@@ -0,0 +1,164 @@
+// BenchFloat.c
+// Runs on a PC
+// Compares the float stages against the integer ones they can replace.
+// For projection and rotation it times both over 512 random points and
+// counts the results that differ and by how much. It then renders a full
+// turn of the wire cube of the Demo mode through each projection and
+// counts the pixels that differ, which is what the panel would show.
+// Host timings only rank the two paths; the FloatBench mode of
+// ST7735TestMain.c measures them on the TM4C123 with the FPU on.
+// Build from the Simple Objects folder:
+//   gcc -O2 -I. -o benchfloat Host/BenchFloat.c Host/HostLCD.c Camera.c Xform.c Mesh.c Raster.c Trig.c
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "ST7735.h"
+#include "Mesh.h"
+#include "Camera.h"
+#include "Trig.h"
+#include "Xform.h"
+#include "HostLCD.h"
+
+#define MAXN   512
+#define ROUNDS 20000
+
+// Same cube and camera as the Demo mode
+#define DIMYR  5
+#define FZ     12
+#define SPIN   (TRIG_STEPS/32)
+#define FRAMES (TRIG_STEPS/SPIN)
+
+typedef int16_t (*ProjectFunc)(const Camera *c, int16_t x, int16_t y, int16_t z,
+                               int16_t *sx, int16_t *sy);
+
+static const uint8_t CubeFaces[6][4] = {{0,1,2,3},{7,6,5,4},{0,4,5,1},
+                                        {1,5,6,2},{2,6,7,3},{3,7,4,0}};
+static const MeshEdge CubeEdges[12] = {
+	{0,1,0,2},{1,2,0,3},{2,3,0,4},{3,0,0,5},
+	{4,5,1,2},{5,6,1,3},{6,7,1,4},{7,4,1,5},
+	{0,4,2,5},{1,5,2,3},{2,6,3,4},{3,7,4,5}
+};
+static const Mesh CubeMesh = {8, 6, 12, CubeFaces, CubeEdges, 0};
+
+static int16_t X[MAXN], Y[MAXN], Z[MAXN];
+static int16_t OX[2][MAXN], OY[2][MAXN], OZ[2][MAXN];
+static uint16_t Image[FRAMES][ST7735_TFTHEIGHT][ST7735_TFTWIDTH];
+static volatile int16_t Sink;
+
+static double now(void){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+// Count the entries of a and b that differ and their largest difference
+static int compare(const int16_t *a, const int16_t *b, int n, int *worst){
+	int i, d, bad = 0;
+	for(i = 0; i < n; i++){
+		d = a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+		if(d){
+			bad++;
+			if(d > *worst)
+				*worst = d;
+		}
+	}
+	return bad;
+}
+
+static double timeProject(ProjectFunc fn, const Camera *c, int k){
+	double t0 = now();
+	int i, r;
+	for(r = 0; r < ROUNDS/10; r++){
+		for(i = 0; i < MAXN; i++){
+			OZ[k][i] = fn(c, X[i], Y[i], Z[i], &OX[k][i], &OY[k][i]);
+		}
+		Sink = OX[k][MAXN - 1];
+	}
+	return (now() - t0)*1e9/(ROUNDS/10)/MAXN;
+}
+
+static double timeXform(int k){
+	double t0 = now();
+	Xform xf;
+	int r;
+	for(r = 0; r < ROUNDS; r++){
+		Xform_Yaw(&xf, r, 10, 20, 30);
+		if(k)
+			Xform_BatchFloat(&xf, X, Y, Z, OX[k], OY[k], OZ[k], MAXN);
+		else
+			Xform_BatchC(&xf, X, Y, Z, OX[k], OY[k], OZ[k], MAXN);
+		Sink = OX[k][MAXN - 1];
+	}
+	return (now() - t0)*1e9/ROUNDS/MAXN;
+}
+
+static void drawCube(ProjectFunc fn, const Camera *c, uint16_t angle){
+	int16_t sx[8], sy[8];
+	uint32_t front[MESH_MASKWORDS];
+	uint8_t k;
+	for(k = 0; k < 4; k++){
+		uint16_t j = TRIG_WRAP(angle + k*TRIG_QUARTER);
+		int16_t x = TRIG_MAKESIN(j, 7);
+		int16_t z = (16 + TRIG_MAKECOS(j, 5)) >> 1;
+		fn(c, x, DIMYR, z, &sx[k], &sy[k]);
+		fn(c, x, -DIMYR, z, &sx[k+4], &sy[k+4]);
+	}
+	Mesh_FrontFaces(&CubeMesh, sx, sy, front);
+	Mesh_DrawWire(&CubeMesh, sx, sy, front, 0xFFFF, MESH_FRONTEDGES);
+}
+
+int main(void){
+	Camera view, yawed;
+	double tInt, tFloat;
+	int i, k, bad, worst, pixels, frames;
+
+	srand(1);
+	for(i = 0; i < MAXN; i++){
+		X[i] = rand() % 255 - 127;
+		Y[i] = rand() % 255 - 127;
+		Z[i] = rand() % 240 + 16;
+	}
+	Camera_Init(&yawed, 5, -10, -20, 60, 64, 80);
+	yawed.yaw = 8;
+	Camera_Begin(&yawed);
+
+	printf("stage       int ns/pt  float ns/pt  differ  max error\n");
+	tInt = timeProject(Camera_Project, &yawed, 0);
+	tFloat = timeProject(Camera_ProjectFloat, &yawed, 1);
+	worst = 0;
+	bad = compare(OX[0], OX[1], MAXN, &worst) + compare(OY[0], OY[1], MAXN, &worst);
+	printf("project   %11.2f  %11.2f  %6d  %9d\n", tInt, tFloat, bad, worst);
+	tInt = timeXform(0);
+	tFloat = timeXform(1);
+	worst = 0;
+	bad = compare(OX[0], OX[1], MAXN, &worst) + compare(OY[0], OY[1], MAXN, &worst)
+	    + compare(OZ[0], OZ[1], MAXN, &worst);
+	printf("rotate    %11.2f  %11.2f  %6d  %9d\n", tInt, tFloat, bad, worst);
+
+	// The same turn through both projections
+	Camera_Init(&view, 0, -10, 0, FZ, 64, 80);
+	for(k = 0; k < FRAMES; k++){
+		HostLCD_Reset();
+		drawCube(Camera_Project, &view, k*SPIN);
+		memcpy(Image[k], HostLCD_Frame, sizeof(HostLCD_Frame));
+	}
+	pixels = frames = 0;
+	for(k = 0; k < FRAMES; k++){
+		int y, x, before = pixels;
+		HostLCD_Reset();
+		drawCube(Camera_ProjectFloat, &view, k*SPIN);
+		for(y = 0; y < ST7735_TFTHEIGHT; y++){
+			for(x = 0; x < ST7735_TFTWIDTH; x++){
+				if(HostLCD_Frame[y][x] != Image[k][y][x])
+					pixels++;
+			}
+		}
+		if(pixels != before)
+			frames++;
+	}
+	printf("cube turn: %d of %d frames differ, %d pixels\n", frames, FRAMES, pixels);
+	return 0;
+}
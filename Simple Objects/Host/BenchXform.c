@@ -0,0 +1,87 @@
+// BenchXform.c
+// Runs on a PC
+// Times the batched structure of arrays transform against the per
+// vertex loop it replaced in Scene.c, which read int8_t model vertices
+// one at a time, at 8, 64 and 512 vertices. The host has no DSP
+// extension so Xform_Batch runs its C loop here; the XformBench mode of
+// ST7735TestMain.c times both kernels on the TM4C123 with SysTick.
+// Build from the Simple Objects folder:
+//   gcc -O2 -I. -o benchxform Host/BenchXform.c Xform.c Trig.c
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "Trig.h"
+#include "Xform.h"
+
+#define MAXN   512
+#define ROUNDS 20000
+
+static int8_t Verts[MAXN][3];
+static int16_t X[MAXN], Y[MAXN], Z[MAXN];
+static int16_t OX[MAXN], OY[MAXN], OZ[MAXN];
+static volatile int16_t Sink;
+
+// The old transform: turn about y by a Q7 sine and move, per vertex
+static void perVertex(uint16_t angle, int16_t tx, int16_t ty, int16_t tz, uint16_t n){
+	int16_t sn = TRIG_SIN(angle), cs = TRIG_COS(angle);
+	uint16_t k;
+	for(k = 0; k < n; k++){
+		int16_t mx = Verts[k][0], mz = Verts[k][2];
+		OX[k] = tx + ((mx*cs - mz*sn) >> 7);
+		OY[k] = ty + Verts[k][1];
+		OZ[k] = tz + ((mx*sn + mz*cs) >> 7);
+	}
+}
+
+static double now(void){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+int main(void){
+	static const uint16_t sizes[3] = {8, 64, 512};
+	Xform xf;
+	double t0, tOld, tNew;
+	int i, r, s, bad = 0;
+
+	srand(1);
+	for(i = 0; i < MAXN; i++){
+		Verts[i][0] = X[i] = rand() % 255 - 127;
+		Verts[i][1] = Y[i] = rand() % 255 - 127;
+		Verts[i][2] = Z[i] = rand() % 255 - 127;
+	}
+	printf("verts  per vertex ns/vert  batched ns/vert\n");
+	for(s = 0; s < 3; s++){
+		uint16_t n = sizes[s];
+		t0 = now();
+		for(r = 0; r < ROUNDS; r++){
+			perVertex(r, 10, 20, 30, n);
+			Sink = OX[n - 1];
+		}
+		tOld = now() - t0;
+		t0 = now();
+		for(r = 0; r < ROUNDS; r++){
+			Xform_Yaw(&xf, r, 10, 20, 30);
+			Xform_Batch(&xf, X, Y, Z, OX, OY, OZ, n);
+			Sink = OX[n - 1];
+		}
+		tNew = now() - t0;
+		printf("%5d  %18.2f  %15.2f\n", n, tOld*1e9/ROUNDS/n, tNew*1e9/ROUNDS/n);
+	}
+	// Both must agree exactly
+	for(r = 0; r < TRIG_STEPS; r++){
+		int16_t ax[MAXN], ay[MAXN], az[MAXN];
+		Xform_Yaw(&xf, r, 10, 20, 30);
+		Xform_Batch(&xf, X, Y, Z, ax, ay, az, MAXN);
+		perVertex(r, 10, 20, 30, MAXN);
+		for(i = 0; i < MAXN; i++){
+			if(ax[i] != OX[i] || ay[i] != OY[i] || az[i] != OZ[i])
+				bad++;
+		}
+	}
+	printf("vertices that differ: %d\n", bad);
+	return bad != 0;
+}
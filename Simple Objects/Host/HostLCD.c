@@ -0,0 +1,105 @@
+// HostLCD.c
+// Runs on a PC
+// Stand-in for the ST7735 driver so the rendering code can be built and
+// timed on the host. Link it in place of ST7735.c and PLL.c.
+
+#include <stdio.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "HostLCD.h"
+
+uint16_t HostLCD_Frame[ST7735_TFTHEIGHT][ST7735_TFTWIDTH];
+uint32_t HostLCD_Bytes;
+uint32_t HostLCD_Windows;
+
+static int16_t WinX0, WinX1, WinY1;
+static int16_t CurX, CurY;
+
+void HostLCD_Reset(void){
+	ST7735_FillScreen(0);
+	HostLCD_Bytes = 0;
+	HostLCD_Windows = 0;
+}
+
+int HostLCD_Save(const char *name){
+	FILE *f = fopen(name, "wb");
+	int x, y;
+	if(f == 0)
+		return 0;
+	fprintf(f, "P6 %d %d 255\n", ST7735_TFTWIDTH, ST7735_TFTHEIGHT);
+	for(y = 0; y < ST7735_TFTHEIGHT; y++){
+		for(x = 0; x < ST7735_TFTWIDTH; x++){
+			uint16_t c = HostLCD_Frame[y][x];
+			fputc((c >> 11) << 3, f);
+			fputc(((c >> 5) & 0x3F) << 2, f);
+			fputc((c & 0x1F) << 3, f);
+		}
+	}
+	fclose(f);
+	return 1;
+}
+
+void ST7735_InitB(void){
+	HostLCD_Reset();
+}
+
+void ST7735_InitR(enum initRFlags option){
+	(void)option;
+	HostLCD_Reset();
+}
+
+void setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1){
+	WinX0 = x0; WinX1 = x1; WinY1 = y1;
+	CurX = x0; CurY = y0;
+	HostLCD_Bytes += 11;
+	HostLCD_Windows++;
+}
+
+void pushColor(uint16_t color){
+	HostLCD_Bytes += 2;
+	if(CurX < ST7735_TFTWIDTH && CurY < ST7735_TFTHEIGHT && CurY <= WinY1)
+		HostLCD_Frame[CurY][CurX] = color;
+	if(++CurX > WinX1){
+		CurX = WinX0;
+		CurY++;
+	}
+}
+
+void ST7735_DrawPixel(int16_t x, int16_t y, uint16_t color){
+	if((x < 0) || (x >= ST7735_TFTWIDTH) || (y < 0) || (y >= ST7735_TFTHEIGHT)) return;
+	setAddrWindow(x, y, x, y);
+	pushColor(color);
+}
+
+void ST7735_DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color){
+	if((x >= ST7735_TFTWIDTH) || (y >= ST7735_TFTHEIGHT)) return;
+	if((y+h-1) >= ST7735_TFTHEIGHT) h = ST7735_TFTHEIGHT-y;
+	setAddrWindow(x, y, x, y+h-1);
+	while(h-- > 0)
+		pushColor(color);
+}
+
+void ST7735_DrawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color){
+	if((x >= ST7735_TFTWIDTH) || (y >= ST7735_TFTHEIGHT)) return;
+	if((x+w-1) >= ST7735_TFTWIDTH) w = ST7735_TFTWIDTH-x;
+	setAddrWindow(x, y, x+w-1, y);
+	while(w-- > 0)
+		pushColor(color);
+}
+
+void ST7735_FillScreen(uint16_t color){
+	int x, y;
+	for(y = 0; y < ST7735_TFTHEIGHT; y++){
+		for(x = 0; x < ST7735_TFTWIDTH; x++){
+			HostLCD_Frame[y][x] = color;
+		}
+	}
+}
+
+void Delay1ms(uint32_t n){
+	(void)n;
+}
+
+void PLL_Init(uint32_t freq){
+	(void)freq;
+}
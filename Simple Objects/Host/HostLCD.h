@@ -0,0 +1,34 @@
+// HostLCD.h
+// Runs on a PC
+// Stand-in for the ST7735 driver so the rendering code can be built and
+// timed on the host. Pixels land in an in-memory frame and every byte
+// that would have crossed the SPI bus is counted.
+
+#ifndef _HOSTLCDH_
+#define _HOSTLCDH_
+
+#include <stdint.h>
+#include "ST7735.h"
+
+// Simulated panel memory, row major
+extern uint16_t HostLCD_Frame[ST7735_TFTHEIGHT][ST7735_TFTWIDTH];
+
+// Bytes that would have been sent over SSI0 since the last reset
+extern uint32_t HostLCD_Bytes;
+
+// Number of setAddrWindow calls since the last reset
+extern uint32_t HostLCD_Windows;
+
+//------------HostLCD_Reset------------
+// Clear the frame to black and zero the traffic counters.
+// Input: none
+// Output: none
+void HostLCD_Reset(void);
+
+//------------HostLCD_Save------------
+// Write the frame as a binary PPM image.
+// Input: name  file to create
+// Output: 1 on success, 0 if the file could not be written
+int HostLCD_Save(const char *name);
+
+#endif
@@ -0,0 +1,490 @@
+// LogoClip.c
+// Runs on TM4C123
+// Generated by the host encoder, do not edit.
+
+#include <stdint.h>
+#include "Anim.h"
+#include "LogoClip.h"
+
+static const uint8_t LogoClipData[11452] = {
+	64,86,0,33,4,54,87,0,181,150,55,87,18,33,4,74,87,0,181,150,54,88,2,181,
+	150,57,88,14,33,4,72,88,2,181,150,54,89,4,181,150,59,89,10,33,4,70,89,4,
+	181,150,54,90,148,181,150,181,150,181,150,181,150,181,150,181,150,181,150,33,4,33,4,33,
+	4,33,4,33,4,33,4,33,4,181,150,181,150,181,150,181,150,181,150,181,150,181,150,54,
+	91,8,181,150,63,91,2,33,4,66,91,8,181,150,54,92,20,181,150,54,93,20,181,150,
+	54,94,20,181,150,54,95,20,181,150,54,96,20,181,150,54,97,20,181,150,54,98,20,181,
+	150,54,99,20,181,150,54,100,20,181,150,54,101,20,181,150,54,102,20,181,150,55,103,18,
+	181,150,55,104,18,181,150,56,105,16,181,150,57,106,14,181,150,58,107,12,181,150,58,108,
+	12,181,150,59,109,10,181,150,60,110,8,181,150,60,111,8,181,150,61,112,6,181,150,62,
+	113,4,181,150,63,114,2,181,150,63,115,2,181,150,64,116,0,181,150,255,64,86,129,0,
+	0,33,4,72,87,2,0,0,72,88,132,33,4,33,4,33,4,33,4,206,89,58,89,0,
+	33,4,70,89,134,33,4,33,4,33,4,206,89,206,89,206,89,206,89,60,90,0,33,4,
+	68,90,0,33,4,69,90,7,206,89,61,91,4,33,4,66,91,10,206,89,63,92,13,206,
+	89,63,93,13,206,89,63,94,13,206,89,63,95,13,206,89,63,96,13,206,89,63,97,13,
+	206,89,63,98,13,206,89,63,99,13,206,89,63,100,13,206,89,63,101,13,206,89,63,102,
+	13,206,89,63,103,13,206,89,63,104,13,206,89,63,105,13,206,89,56,106,0,181,150,63,
+	106,12,206,89,57,107,5,181,150,63,107,10,206,89,57,108,5,181,150,63,108,9,206,89,
+	58,109,4,181,150,63,109,8,206,89,59,110,3,181,150,63,110,7,206,89,59,111,137,181,
+	150,181,150,181,150,181,150,206,89,206,89,206,89,206,89,206,89,206,89,60,112,135,181,150,
+	181,150,181,150,206,89,206,89,206,89,206,89,206,89,60,113,134,181,150,181,150,181,150,206,
+	89,206,89,206,89,206,89,61,114,132,181,150,181,150,206,89,206,89,206,89,61,115,132,181,
+	150,181,150,206,89,0,0,0,0,62,116,130,181,150,0,0,0,0,255,56,86,0,123,207,
+	57,86,10,33,4,54,87,130,0,0,0,0,123,207,54,88,130,0,0,0,0,123,207,74,
+	88,130,214,154,0,0,0,0,54,89,131,0,0,0,0,123,207,33,4,70,89,134,214,154,
+	214,154,214,154,214,154,214,154,0,0,0,0,54,90,133,0,0,0,0,123,207,123,207,33,
+	4,33,4,66,90,8,214,154,75,90,1,0,0,54,91,134,0,0,0,0,123,207,123,207,
+	33,4,33,4,33,4,61,91,13,214,154,75,91,1,0,0,54,92,131,0,0,0,0,123,
+	207,123,207,58,92,16,214,154,75,92,1,0,0,54,93,131,0,0,0,0,123,207,123,207,
+	58,93,16,214,154,75,93,1,0,0,54,94,131,0,0,0,0,123,207,123,207,58,94,16,
+	214,154,75,94,1,0,0,54,95,131,0,0,0,0,123,207,123,207,58,95,16,214,154,75,
+	95,1,0,0,54,96,131,0,0,0,0,123,207,123,207,58,96,16,214,154,75,96,1,0,
+	0,54,97,131,0,0,0,0,123,207,123,207,58,97,16,214,154,75,97,1,0,0,54,98,
+	131,0,0,0,0,123,207,123,207,58,98,16,214,154,75,98,1,0,0,54,99,131,0,0,
+	0,0,123,207,123,207,58,99,16,214,154,75,99,1,0,0,54,100,131,0,0,0,0,123,
+	207,123,207,58,100,16,214,154,75,100,1,0,0,54,101,131,0,0,0,0,123,207,123,207,
+	58,101,16,214,154,75,101,1,0,0,54,102,131,0,0,0,0,123,207,123,207,58,102,16,
+	214,154,75,102,1,0,0,55,103,130,0,0,123,207,123,207,58,103,16,214,154,75,103,1,
+	0,0,55,104,130,0,0,123,207,123,207,58,104,16,214,154,75,104,1,0,0,56,105,1,
+	123,207,58,105,16,214,154,75,105,1,0,0,56,106,1,123,207,58,106,14,214,154,73,106,
+	2,0,0,56,107,1,123,207,58,107,13,214,154,72,107,1,0,0,57,108,0,123,207,58,
+	108,11,214,154,70,108,2,0,0,57,109,0,123,207,58,109,10,214,154,69,109,2,0,0,
+	57,110,0,123,207,58,110,8,214,154,67,110,3,0,0,57,111,0,123,207,58,111,7,214,
+	154,66,111,2,0,0,57,112,138,123,207,214,154,214,154,214,154,214,154,214,154,214,154,0,
+	0,0,0,0,0,0,0,57,113,137,123,207,214,154,214,154,214,154,214,154,214,154,0,0,
+	0,0,0,0,0,0,57,114,136,123,207,214,154,214,154,214,154,0,0,0,0,0,0,0,
+	0,0,0,57,115,134,123,207,214,154,214,154,0,0,0,0,0,0,0,0,57,116,133,123,
+	207,0,0,0,0,0,0,0,0,0,0,255,56,86,0,33,4,68,86,0,33,4,56,87,
+	0,33,4,71,87,0,0,0,56,88,0,33,4,73,88,1,0,0,56,89,0,33,4,70,
+	89,4,33,4,56,90,20,255,223,56,91,20,255,223,56,92,20,255,223,56,93,20,255,223,
+	56,94,20,255,223,56,95,20,255,223,56,96,20,255,223,56,97,20,255,223,56,98,20,255,
+	223,56,99,20,255,223,56,100,20,255,223,56,101,20,255,223,56,102,20,255,223,56,103,20,
+	255,223,56,104,20,255,223,56,105,20,255,223,56,106,20,255,223,56,107,20,255,223,56,108,
+	20,255,223,56,109,20,255,223,56,110,20,255,223,57,111,8,0,0,57,112,6,0,0,57,
+	113,5,0,0,57,114,3,0,0,57,115,2,0,0,57,116,0,0,0,255,56,86,1,0,
+	0,69,86,1,33,4,56,87,0,0,0,71,87,0,33,4,55,89,0,33,4,74,89,0,
+	0,0,54,90,1,255,223,75,90,1,0,0,54,91,1,255,223,75,91,1,0,0,54,92,
+	1,255,223,75,92,1,0,0,54,93,1,255,223,75,93,1,0,0,54,94,1,255,223,75,
+	94,1,0,0,54,95,1,255,223,75,95,1,0,0,54,96,1,255,223,75,96,1,0,0,
+	54,97,1,255,223,75,97,1,0,0,54,98,1,255,223,75,98,1,0,0,54,99,1,255,
+	223,75,99,1,0,0,54,100,1,255,223,75,100,1,0,0,54,101,1,255,223,75,101,1,
+	0,0,54,102,1,255,223,75,102,1,0,0,54,103,1,255,223,75,103,1,0,0,54,104,
+	1,255,223,75,104,1,0,0,54,105,1,255,223,75,105,1,0,0,54,106,1,255,223,75,
+	106,1,0,0,54,107,1,255,223,75,107,1,0,0,54,108,1,255,223,75,108,1,0,0,
+	54,109,1,255,223,75,109,1,0,0,54,110,1,255,223,75,110,1,0,0,255,58,86,1,
+	0,0,71,86,1,33,4,57,87,0,0,0,72,87,0,33,4,54,89,0,33,4,73,89,
+	0,0,0,52,90,1,255,223,73,90,1,0,0,52,91,1,255,223,73,91,1,0,0,52,
+	92,1,255,223,73,92,1,0,0,52,93,1,255,223,73,93,1,0,0,52,94,1,255,223,
+	73,94,1,0,0,52,95,1,255,223,73,95,1,0,0,52,96,1,255,223,73,96,1,0,
+	0,52,97,1,255,223,73,97,1,0,0,52,98,1,255,223,73,98,1,0,0,52,99,1,
+	255,223,73,99,1,0,0,52,100,1,255,223,73,100,1,0,0,52,101,1,255,223,73,101,
+	1,0,0,52,102,1,255,223,73,102,1,0,0,52,103,1,255,223,73,103,1,0,0,52,
+	104,1,255,223,73,104,1,0,0,52,105,1,255,223,73,105,1,0,0,52,106,1,255,223,
+	73,106,1,0,0,52,107,1,255,223,73,107,1,0,0,52,108,1,255,223,73,108,1,0,
+	0,52,109,1,255,223,73,109,1,0,0,52,110,1,255,223,73,110,1,0,0,255,60,86,
+	0,0,0,72,86,0,123,207,72,87,0,123,207,54,88,129,214,154,33,4,72,88,0,123,
+	207,54,89,4,214,154,72,89,0,123,207,52,90,1,0,0,54,90,9,214,154,64,90,136,
+	33,4,33,4,33,4,33,4,33,4,33,4,33,4,123,207,123,207,52,91,1,0,0,54,
+	91,13,214,154,68,91,132,33,4,33,4,33,4,123,207,123,207,52,92,1,0,0,54,92,
+	17,214,154,72,92,0,123,207,52,93,1,0,0,54,93,17,214,154,72,93,0,123,207,52,
+	94,1,0,0,54,94,17,214,154,72,94,0,123,207,52,95,1,0,0,54,95,17,214,154,
+	72,95,0,123,207,52,96,1,0,0,54,96,17,214,154,72,96,0,123,207,52,97,1,0,
+	0,54,97,17,214,154,72,97,0,123,207,52,98,1,0,0,54,98,17,214,154,72,98,0,
+	123,207,52,99,1,0,0,54,99,17,214,154,72,99,0,123,207,52,100,1,0,0,54,100,
+	17,214,154,72,100,0,123,207,52,101,1,0,0,54,101,17,214,154,72,101,0,123,207,52,
+	102,1,0,0,54,102,17,214,154,72,102,0,123,207,52,103,1,0,0,54,103,17,214,154,
+	72,103,0,123,207,52,104,1,0,0,54,104,17,214,154,72,104,0,123,207,52,105,1,0,
+	0,54,105,17,214,154,72,105,0,123,207,52,106,3,0,0,56,106,15,214,154,72,106,0,
+	123,207,52,107,4,0,0,57,107,14,214,154,72,107,0,123,207,52,108,6,0,0,59,108,
+	12,214,154,72,108,0,123,207,52,109,7,0,0,60,109,11,214,154,72,109,0,0,0,52,
+	110,9,0,0,62,110,9,214,154,72,110,0,0,0,63,111,8,214,154,65,112,6,214,154,
+	66,113,5,214,154,68,114,3,214,154,69,115,2,214,154,71,116,0,214,154,255,61,86,130,
+	0,0,0,0,33,4,64,86,8,0,0,72,87,130,33,4,33,4,181,150,52,88,130,206,
+	89,33,4,33,4,72,88,2,181,150,52,89,134,206,89,206,89,206,89,206,89,206,89,33,
+	4,33,4,71,89,3,181,150,52,90,7,206,89,60,90,8,33,4,69,90,5,181,150,52,
+	91,11,206,89,64,91,138,33,4,33,4,33,4,33,4,181,150,181,150,181,150,181,150,181,
+	150,181,150,181,150,52,92,14,206,89,67,92,7,181,150,52,93,14,206,89,67,93,7,181,
+	150,52,94,14,206,89,67,94,7,181,150,52,95,14,206,89,67,95,7,181,150,52,96,14,
+	206,89,67,96,7,181,150,52,97,14,206,89,67,97,7,181,150,52,98,14,206,89,67,98,
+	7,181,150,52,99,14,206,89,67,99,7,181,150,52,100,14,206,89,67,100,7,181,150,52,
+	101,14,206,89,67,101,7,181,150,52,102,14,206,89,67,102,7,181,150,52,103,14,206,89,
+	67,103,6,181,150,52,104,14,206,89,67,104,6,181,150,52,105,14,206,89,67,105,5,181,
+	150,53,106,13,206,89,67,106,5,181,150,55,107,11,206,89,67,107,133,181,150,181,150,181,
+	150,181,150,181,150,0,0,56,108,10,206,89,67,108,133,181,150,181,150,181,150,181,150,181,
+	150,0,0,57,109,9,206,89,67,109,132,181,150,181,150,181,150,181,150,0,0,58,110,8,
+	206,89,67,110,132,181,150,181,150,181,150,0,0,0,0,60,111,139,206,89,206,89,206,89,
+	206,89,206,89,206,89,206,89,181,150,181,150,181,150,0,0,0,0,61,112,138,206,89,206,
+	89,206,89,206,89,206,89,206,89,181,150,181,150,0,0,0,0,0,0,62,113,137,206,89,
+	206,89,206,89,206,89,206,89,181,150,181,150,0,0,0,0,0,0,63,114,136,206,89,206,
+	89,206,89,206,89,181,150,0,0,0,0,0,0,0,0,65,115,134,206,89,206,89,181,150,
+	0,0,0,0,0,0,0,0,66,116,133,206,89,0,0,0,0,0,0,0,0,0,0,255,
+	63,86,129,0,0,33,4,54,87,131,181,150,33,4,33,4,33,4,52,88,132,0,0,0,
+	0,181,150,181,150,181,150,52,89,134,0,0,0,0,181,150,181,150,181,150,181,150,181,150,
+	70,89,0,181,150,52,90,136,0,0,0,0,181,150,181,150,181,150,181,150,181,150,181,150,
+	181,150,68,90,0,181,150,52,91,1,0,0,54,91,8,181,150,63,91,132,33,4,33,4,
+	33,4,181,150,181,150,52,92,1,0,0,54,92,12,181,150,52,93,1,0,0,54,93,12,
+	181,150,52,94,1,0,0,54,94,12,181,150,52,95,1,0,0,54,95,12,181,150,52,96,
+	1,0,0,54,96,12,181,150,52,97,1,0,0,54,97,12,181,150,52,98,1,0,0,54,
+	98,12,181,150,52,99,1,0,0,54,99,12,181,150,52,100,1,0,0,54,100,12,181,150,
+	52,101,1,0,0,54,101,12,181,150,52,102,1,0,0,54,102,12,181,150,52,103,2,0,
+	0,55,103,11,181,150,52,104,2,0,0,55,104,11,181,150,52,105,3,0,0,56,105,10,
+	181,150,53,106,3,0,0,57,106,14,181,150,72,106,0,0,0,55,107,2,0,0,58,107,
+	12,181,150,71,107,0,0,0,56,108,1,0,0,58,108,12,181,150,71,108,0,0,0,57,
+	109,1,0,0,59,109,10,181,150,70,109,0,0,0,58,110,1,0,0,60,110,8,181,150,
+	69,110,0,0,0,60,111,8,181,150,69,111,0,0,0,61,112,135,181,150,181,150,181,150,
+	181,150,181,150,181,150,181,150,0,0,62,113,134,181,150,181,150,181,150,181,150,181,150,0,
+	0,0,0,63,114,132,181,150,181,150,181,150,0,0,0,0,63,115,132,181,150,181,150,181,
+	150,0,0,0,0,64,116,130,181,150,0,0,0,0,255,64,86,129,0,0,33,4,72,87,
+	2,0,0,72,88,132,33,4,33,4,33,4,33,4,206,89,58,89,0,33,4,70,89,134,
+	33,4,33,4,33,4,206,89,206,89,206,89,206,89,60,90,0,33,4,68,90,0,33,4,
+	69,90,7,206,89,61,91,4,33,4,66,91,10,206,89,63,92,13,206,89,63,93,13,206,
+	89,63,94,13,206,89,63,95,13,206,89,63,96,13,206,89,63,97,13,206,89,63,98,13,
+	206,89,63,99,13,206,89,63,100,13,206,89,63,101,13,206,89,63,102,13,206,89,63,103,
+	13,206,89,63,104,13,206,89,63,105,13,206,89,56,106,0,181,150,63,106,12,206,89,57,
+	107,5,181,150,63,107,10,206,89,57,108,5,181,150,63,108,9,206,89,58,109,4,181,150,
+	63,109,8,206,89,59,110,3,181,150,63,110,7,206,89,59,111,137,181,150,181,150,181,150,
+	181,150,206,89,206,89,206,89,206,89,206,89,206,89,60,112,135,181,150,181,150,181,150,206,
+	89,206,89,206,89,206,89,206,89,60,113,134,181,150,181,150,181,150,206,89,206,89,206,89,
+	206,89,61,114,132,181,150,181,150,206,89,206,89,206,89,61,115,132,181,150,181,150,206,89,
+	0,0,0,0,62,116,130,181,150,0,0,0,0,255,56,86,0,123,207,57,86,10,33,4,
+	54,87,130,0,0,0,0,123,207,54,88,130,0,0,0,0,123,207,74,88,130,214,154,0,
+	0,0,0,54,89,131,0,0,0,0,123,207,33,4,70,89,134,214,154,214,154,214,154,214,
+	154,214,154,0,0,0,0,54,90,133,0,0,0,0,123,207,123,207,33,4,33,4,66,90,
+	8,214,154,75,90,1,0,0,54,91,134,0,0,0,0,123,207,123,207,33,4,33,4,33,
+	4,61,91,13,214,154,75,91,1,0,0,54,92,131,0,0,0,0,123,207,123,207,58,92,
+	16,214,154,75,92,1,0,0,54,93,131,0,0,0,0,123,207,123,207,58,93,16,214,154,
+	75,93,1,0,0,54,94,131,0,0,0,0,123,207,123,207,58,94,16,214,154,75,94,1,
+	0,0,54,95,131,0,0,0,0,123,207,123,207,58,95,16,214,154,75,95,1,0,0,54,
+	96,131,0,0,0,0,123,207,123,207,58,96,16,214,154,75,96,1,0,0,54,97,131,0,
+	0,0,0,123,207,123,207,58,97,16,214,154,75,97,1,0,0,54,98,131,0,0,0,0,
+	123,207,123,207,58,98,16,214,154,75,98,1,0,0,54,99,131,0,0,0,0,123,207,123,
+	207,58,99,16,214,154,75,99,1,0,0,54,100,131,0,0,0,0,123,207,123,207,58,100,
+	16,214,154,75,100,1,0,0,54,101,131,0,0,0,0,123,207,123,207,58,101,16,214,154,
+	75,101,1,0,0,54,102,131,0,0,0,0,123,207,123,207,58,102,16,214,154,75,102,1,
+	0,0,55,103,130,0,0,123,207,123,207,58,103,16,214,154,75,103,1,0,0,55,104,130,
+	0,0,123,207,123,207,58,104,16,214,154,75,104,1,0,0,56,105,1,123,207,58,105,16,
+	214,154,75,105,1,0,0,56,106,1,123,207,58,106,14,214,154,73,106,2,0,0,56,107,
+	1,123,207,58,107,13,214,154,72,107,1,0,0,57,108,0,123,207,58,108,11,214,154,70,
+	108,2,0,0,57,109,0,123,207,58,109,10,214,154,69,109,2,0,0,57,110,0,123,207,
+	58,110,8,214,154,67,110,3,0,0,57,111,0,123,207,58,111,7,214,154,66,111,2,0,
+	0,57,112,138,123,207,214,154,214,154,214,154,214,154,214,154,214,154,0,0,0,0,0,0,
+	0,0,57,113,137,123,207,214,154,214,154,214,154,214,154,214,154,0,0,0,0,0,0,0,
+	0,57,114,136,123,207,214,154,214,154,214,154,0,0,0,0,0,0,0,0,0,0,57,115,
+	134,123,207,214,154,214,154,0,0,0,0,0,0,0,0,57,116,133,123,207,0,0,0,0,
+	0,0,0,0,0,0,255,56,86,0,33,4,68,86,0,33,4,56,87,0,33,4,71,87,
+	0,0,0,56,88,0,33,4,73,88,1,0,0,56,89,0,33,4,70,89,4,33,4,56,
+	90,20,255,223,56,91,20,255,223,56,92,20,255,223,56,93,20,255,223,56,94,20,255,223,
+	56,95,20,255,223,56,96,20,255,223,56,97,20,255,223,56,98,20,255,223,56,99,20,255,
+	223,56,100,20,255,223,56,101,20,255,223,56,102,20,255,223,56,103,20,255,223,56,104,20,
+	255,223,56,105,20,255,223,56,106,20,255,223,56,107,20,255,223,56,108,20,255,223,56,109,
+	20,255,223,56,110,20,255,223,57,111,8,0,0,57,112,6,0,0,57,113,5,0,0,57,
+	114,3,0,0,57,115,2,0,0,57,116,0,0,0,255,56,86,1,0,0,69,86,1,33,
+	4,56,87,0,0,0,71,87,0,33,4,55,89,0,33,4,74,89,0,0,0,54,90,1,
+	255,223,75,90,1,0,0,54,91,1,255,223,75,91,1,0,0,54,92,1,255,223,75,92,
+	1,0,0,54,93,1,255,223,75,93,1,0,0,54,94,1,255,223,75,94,1,0,0,54,
+	95,1,255,223,75,95,1,0,0,54,96,1,255,223,75,96,1,0,0,54,97,1,255,223,
+	75,97,1,0,0,54,98,1,255,223,75,98,1,0,0,54,99,1,255,223,75,99,1,0,
+	0,54,100,1,255,223,75,100,1,0,0,54,101,1,255,223,75,101,1,0,0,54,102,1,
+	255,223,75,102,1,0,0,54,103,1,255,223,75,103,1,0,0,54,104,1,255,223,75,104,
+	1,0,0,54,105,1,255,223,75,105,1,0,0,54,106,1,255,223,75,106,1,0,0,54,
+	107,1,255,223,75,107,1,0,0,54,108,1,255,223,75,108,1,0,0,54,109,1,255,223,
+	75,109,1,0,0,54,110,1,255,223,75,110,1,0,0,255,58,86,1,0,0,71,86,1,
+	33,4,57,87,0,0,0,72,87,0,33,4,54,89,0,33,4,73,89,0,0,0,52,90,
+	1,255,223,73,90,1,0,0,52,91,1,255,223,73,91,1,0,0,52,92,1,255,223,73,
+	92,1,0,0,52,93,1,255,223,73,93,1,0,0,52,94,1,255,223,73,94,1,0,0,
+	52,95,1,255,223,73,95,1,0,0,52,96,1,255,223,73,96,1,0,0,52,97,1,255,
+	223,73,97,1,0,0,52,98,1,255,223,73,98,1,0,0,52,99,1,255,223,73,99,1,
+	0,0,52,100,1,255,223,73,100,1,0,0,52,101,1,255,223,73,101,1,0,0,52,102,
+	1,255,223,73,102,1,0,0,52,103,1,255,223,73,103,1,0,0,52,104,1,255,223,73,
+	104,1,0,0,52,105,1,255,223,73,105,1,0,0,52,106,1,255,223,73,106,1,0,0,
+	52,107,1,255,223,73,107,1,0,0,52,108,1,255,223,73,108,1,0,0,52,109,1,255,
+	223,73,109,1,0,0,52,110,1,255,223,73,110,1,0,0,255,60,86,0,0,0,72,86,
+	0,123,207,72,87,0,123,207,54,88,129,214,154,33,4,72,88,0,123,207,54,89,4,214,
+	154,72,89,0,123,207,52,90,1,0,0,54,90,9,214,154,64,90,136,33,4,33,4,33,
+	4,33,4,33,4,33,4,33,4,123,207,123,207,52,91,1,0,0,54,91,13,214,154,68,
+	91,132,33,4,33,4,33,4,123,207,123,207,52,92,1,0,0,54,92,16,214,154,71,92,
+	1,123,207,52,93,1,0,0,54,93,16,214,154,71,93,1,123,207,52,94,1,0,0,54,
+	94,16,214,154,71,94,1,123,207,52,95,1,0,0,54,95,16,214,154,71,95,1,123,207,
+	52,96,1,0,0,54,96,16,214,154,71,96,1,123,207,52,97,1,0,0,54,97,16,214,
+	154,71,97,1,123,207,52,98,1,0,0,54,98,16,214,154,71,98,1,123,207,52,99,1,
+	0,0,54,99,16,214,154,71,99,1,123,207,52,100,1,0,0,54,100,16,214,154,71,100,
+	1,123,207,52,101,1,0,0,54,101,16,214,154,71,101,1,123,207,52,102,1,0,0,54,
+	102,16,214,154,71,102,1,123,207,52,103,1,0,0,54,103,16,214,154,71,103,1,123,207,
+	52,104,1,0,0,54,104,16,214,154,71,104,1,123,207,52,105,1,0,0,54,105,16,214,
+	154,71,105,1,123,207,52,106,3,0,0,56,106,14,214,154,71,106,1,123,207,52,107,4,
+	0,0,57,107,13,214,154,71,107,1,123,207,52,108,6,0,0,59,108,11,214,154,71,108,
+	1,123,207,52,109,7,0,0,60,109,10,214,154,71,109,129,123,207,0,0,52,110,9,0,
+	0,62,110,8,214,154,71,110,129,123,207,0,0,63,111,7,214,154,71,111,0,123,207,65,
+	112,134,214,154,214,154,214,154,214,154,214,154,214,154,123,207,66,113,133,214,154,214,154,214,
+	154,214,154,214,154,123,207,68,114,131,214,154,214,154,214,154,123,207,69,115,130,214,154,214,
+	154,123,207,71,116,0,123,207,255,61,86,130,0,0,0,0,33,4,64,86,8,0,0,72,
+	87,130,33,4,33,4,181,150,52,88,130,206,89,33,4,33,4,72,88,2,181,150,52,89,
+	134,206,89,206,89,206,89,206,89,206,89,33,4,33,4,71,89,3,181,150,52,90,7,206,
+	89,60,90,8,33,4,69,90,5,181,150,52,91,11,206,89,64,91,138,33,4,33,4,33,
+	4,33,4,181,150,181,150,181,150,181,150,181,150,181,150,181,150,52,92,13,206,89,66,92,
+	8,181,150,52,93,13,206,89,66,93,8,181,150,52,94,13,206,89,66,94,8,181,150,52,
+	95,13,206,89,66,95,8,181,150,52,96,13,206,89,66,96,8,181,150,52,97,13,206,89,
+	66,97,8,181,150,52,98,13,206,89,66,98,8,181,150,52,99,13,206,89,66,99,8,181,
+	150,52,100,13,206,89,66,100,8,181,150,52,101,13,206,89,66,101,8,181,150,52,102,13,
+	206,89,66,102,8,181,150,52,103,13,206,89,66,103,7,181,150,52,104,13,206,89,66,104,
+	7,181,150,52,105,13,206,89,66,105,6,181,150,53,106,12,206,89,66,106,6,181,150,55,
+	107,10,206,89,66,107,134,181,150,181,150,181,150,181,150,181,150,181,150,0,0,56,108,9,
+	206,89,66,108,134,181,150,181,150,181,150,181,150,181,150,181,150,0,0,57,109,8,206,89,
+	66,109,133,181,150,181,150,181,150,181,150,181,150,0,0,58,110,7,206,89,66,110,133,181,
+	150,181,150,181,150,181,150,0,0,0,0,60,111,139,206,89,206,89,206,89,206,89,206,89,
+	206,89,181,150,181,150,181,150,181,150,0,0,0,0,61,112,138,206,89,206,89,206,89,206,
+	89,206,89,181,150,181,150,181,150,0,0,0,0,0,0,62,113,137,206,89,206,89,206,89,
+	206,89,181,150,181,150,181,150,0,0,0,0,0,0,63,114,136,206,89,206,89,206,89,181,
+	150,181,150,0,0,0,0,0,0,0,0,65,115,134,206,89,181,150,181,150,0,0,0,0,
+	0,0,0,0,66,116,133,181,150,0,0,0,0,0,0,0,0,0,0,255,63,86,129,0,
+	0,33,4,54,87,131,181,150,33,4,33,4,33,4,52,88,132,0,0,0,0,181,150,181,
+	150,181,150,52,89,134,0,0,0,0,181,150,181,150,181,150,181,150,181,150,70,89,0,181,
+	150,52,90,136,0,0,0,0,181,150,181,150,181,150,181,150,181,150,181,150,181,150,68,90,
+	0,181,150,52,91,1,0,0,54,91,8,181,150,63,91,132,33,4,33,4,33,4,181,150,
+	181,150,52,92,1,0,0,54,92,11,181,150,52,93,1,0,0,54,93,11,181,150,52,94,
+	1,0,0,54,94,11,181,150,52,95,1,0,0,54,95,11,181,150,52,96,1,0,0,54,
+	96,11,181,150,52,97,1,0,0,54,97,11,181,150,52,98,1,0,0,54,98,11,181,150,
+	52,99,1,0,0,54,99,11,181,150,52,100,1,0,0,54,100,11,181,150,52,101,1,0,
+	0,54,101,11,181,150,52,102,1,0,0,54,102,11,181,150,52,103,2,0,0,55,103,10,
+	181,150,52,104,2,0,0,55,104,10,181,150,52,105,3,0,0,56,105,9,181,150,53,106,
+	3,0,0,57,106,8,181,150,72,106,0,0,0,55,107,2,0,0,58,107,12,181,150,71,
+	107,0,0,0,56,108,1,0,0,58,108,12,181,150,71,108,0,0,0,57,109,1,0,0,
+	59,109,10,181,150,70,109,0,0,0,58,110,1,0,0,60,110,8,181,150,69,110,0,0,
+	0,60,111,8,181,150,69,111,0,0,0,61,112,135,181,150,181,150,181,150,181,150,181,150,
+	181,150,181,150,0,0,62,113,134,181,150,181,150,181,150,181,150,181,150,0,0,0,0,63,
+	114,132,181,150,181,150,181,150,0,0,0,0,63,115,132,181,150,181,150,181,150,0,0,0,
+	0,64,116,130,181,150,0,0,0,0,255,64,86,129,0,0,33,4,72,87,2,0,0,72,
+	88,132,33,4,33,4,33,4,33,4,206,89,58,89,0,33,4,70,89,134,33,4,33,4,
+	33,4,206,89,206,89,206,89,206,89,60,90,0,33,4,68,90,0,33,4,69,90,7,206,
+	89,61,91,4,33,4,66,91,10,206,89,62,92,14,206,89,62,93,14,206,89,62,94,14,
+	206,89,62,95,14,206,89,62,96,14,206,89,62,97,14,206,89,62,98,14,206,89,62,99,
+	14,206,89,62,100,14,206,89,62,101,14,206,89,62,102,14,206,89,62,103,14,206,89,62,
+	104,14,206,89,62,105,14,206,89,56,106,5,181,150,62,106,13,206,89,57,107,4,181,150,
+	62,107,11,206,89,57,108,4,181,150,62,108,10,206,89,58,109,3,181,150,62,109,9,206,
+	89,59,110,2,181,150,62,110,8,206,89,59,111,137,181,150,181,150,181,150,206,89,206,89,
+	206,89,206,89,206,89,206,89,206,89,60,112,135,181,150,181,150,206,89,206,89,206,89,206,
+	89,206,89,206,89,60,113,134,181,150,181,150,206,89,206,89,206,89,206,89,206,89,61,114,
+	132,181,150,206,89,206,89,206,89,206,89,61,115,132,181,150,206,89,206,89,0,0,0,0,
+	62,116,130,206,89,0,0,0,0,255,56,86,0,123,207,57,86,10,33,4,54,87,130,0,
+	0,0,0,123,207,54,88,130,0,0,0,0,123,207,74,88,130,214,154,0,0,0,0,54,
+	89,131,0,0,0,0,123,207,33,4,70,89,134,214,154,214,154,214,154,214,154,214,154,0,
+	0,0,0,54,90,133,0,0,0,0,123,207,123,207,33,4,33,4,66,90,8,214,154,75,
+	90,1,0,0,54,91,134,0,0,0,0,123,207,123,207,33,4,33,4,33,4,61,91,13,
+	214,154,75,91,1,0,0,54,92,130,0,0,0,0,123,207,57,92,17,214,154,75,92,1,
+	0,0,54,93,130,0,0,0,0,123,207,57,93,17,214,154,75,93,1,0,0,54,94,130,
+	0,0,0,0,123,207,57,94,17,214,154,75,94,1,0,0,54,95,130,0,0,0,0,123,
+	207,57,95,17,214,154,75,95,1,0,0,54,96,130,0,0,0,0,123,207,57,96,17,214,
+	154,75,96,1,0,0,54,97,130,0,0,0,0,123,207,57,97,17,214,154,75,97,1,0,
+	0,54,98,130,0,0,0,0,123,207,57,98,17,214,154,75,98,1,0,0,54,99,130,0,
+	0,0,0,123,207,57,99,17,214,154,75,99,1,0,0,54,100,130,0,0,0,0,123,207,
+	57,100,17,214,154,75,100,1,0,0,54,101,130,0,0,0,0,123,207,57,101,17,214,154,
+	75,101,1,0,0,54,102,130,0,0,0,0,123,207,57,102,17,214,154,75,102,1,0,0,
+	55,103,129,0,0,123,207,57,103,17,214,154,75,103,1,0,0,55,104,129,0,0,123,207,
+	57,104,17,214,154,75,104,1,0,0,56,105,0,123,207,57,105,17,214,154,75,105,1,0,
+	0,56,106,0,123,207,57,106,15,214,154,73,106,2,0,0,56,107,0,123,207,57,107,14,
+	214,154,72,107,1,0,0,57,108,12,214,154,70,108,2,0,0,57,109,11,214,154,69,109,
+	2,0,0,57,110,9,214,154,67,110,3,0,0,57,111,8,214,154,66,111,2,0,0,57,
+	112,138,214,154,214,154,214,154,214,154,214,154,214,154,214,154,0,0,0,0,0,0,0,0,
+	57,113,137,214,154,214,154,214,154,214,154,214,154,214,154,0,0,0,0,0,0,0,0,57,
+	114,136,214,154,214,154,214,154,214,154,0,0,0,0,0,0,0,0,0,0,57,115,134,214,
+	154,214,154,214,154,0,0,0,0,0,0,0,0,57,116,133,214,154,0,0,0,0,0,0,
+	0,0,0,0,255,56,86,0,33,4,68,86,0,33,4,56,87,0,33,4,71,87,0,0,
+	0,56,88,0,33,4,73,88,1,0,0,56,89,0,33,4,70,89,4,33,4,56,90,20,
+	255,223,56,91,20,255,223,56,92,20,255,223,56,93,20,255,223,56,94,20,255,223,56,95,
+	20,255,223,56,96,20,255,223,56,97,20,255,223,56,98,20,255,223,56,99,20,255,223,56,
+	100,20,255,223,56,101,20,255,223,56,102,20,255,223,56,103,20,255,223,56,104,20,255,223,
+	56,105,20,255,223,56,106,20,255,223,56,107,20,255,223,56,108,20,255,223,56,109,20,255,
+	223,56,110,20,255,223,57,111,8,0,0,57,112,6,0,0,57,113,5,0,0,57,114,3,
+	0,0,57,115,2,0,0,57,116,0,0,0,255,56,86,1,0,0,69,86,1,33,4,56,
+	87,0,0,0,71,87,0,33,4,55,89,0,33,4,74,89,0,0,0,54,90,1,255,223,
+	75,90,1,0,0,54,91,1,255,223,75,91,1,0,0,54,92,1,255,223,75,92,1,0,
+	0,54,93,1,255,223,75,93,1,0,0,54,94,1,255,223,75,94,1,0,0,54,95,1,
+	255,223,75,95,1,0,0,54,96,1,255,223,75,96,1,0,0,54,97,1,255,223,75,97,
+	1,0,0,54,98,1,255,223,75,98,1,0,0,54,99,1,255,223,75,99,1,0,0,54,
+	100,1,255,223,75,100,1,0,0,54,101,1,255,223,75,101,1,0,0,54,102,1,255,223,
+	75,102,1,0,0,54,103,1,255,223,75,103,1,0,0,54,104,1,255,223,75,104,1,0,
+	0,54,105,1,255,223,75,105,1,0,0,54,106,1,255,223,75,106,1,0,0,54,107,1,
+	255,223,75,107,1,0,0,54,108,1,255,223,75,108,1,0,0,54,109,1,255,223,75,109,
+	1,0,0,54,110,1,255,223,75,110,1,0,0,255,58,86,1,0,0,71,86,1,33,4,
+	57,87,0,0,0,72,87,0,33,4,54,89,0,33,4,73,89,0,0,0,52,90,1,255,
+	223,73,90,1,0,0,52,91,1,255,223,73,91,1,0,0,52,92,1,255,223,73,92,1,
+	0,0,52,93,1,255,223,73,93,1,0,0,52,94,1,255,223,73,94,1,0,0,52,95,
+	1,255,223,73,95,1,0,0,52,96,1,255,223,73,96,1,0,0,52,97,1,255,223,73,
+	97,1,0,0,52,98,1,255,223,73,98,1,0,0,52,99,1,255,223,73,99,1,0,0,
+	52,100,1,255,223,73,100,1,0,0,52,101,1,255,223,73,101,1,0,0,52,102,1,255,
+	223,73,102,1,0,0,52,103,1,255,223,73,103,1,0,0,52,104,1,255,223,73,104,1,
+	0,0,52,105,1,255,223,73,105,1,0,0,52,106,1,255,223,73,106,1,0,0,52,107,
+	1,255,223,73,107,1,0,0,52,108,1,255,223,73,108,1,0,0,52,109,1,255,223,73,
+	109,1,0,0,52,110,1,255,223,73,110,1,0,0,255,60,86,0,0,0,72,86,0,123,
+	207,72,87,0,123,207,54,88,129,214,154,33,4,72,88,0,123,207,54,89,4,214,154,72,
+	89,0,123,207,52,90,1,0,0,54,90,9,214,154,64,90,136,33,4,33,4,33,4,33,
+	4,33,4,33,4,33,4,123,207,123,207,52,91,1,0,0,54,91,13,214,154,68,91,132,
+	33,4,33,4,33,4,123,207,123,207,52,92,1,0,0,54,92,17,214,154,72,92,0,123,
+	207,52,93,1,0,0,54,93,17,214,154,72,93,0,123,207,52,94,1,0,0,54,94,17,
+	214,154,72,94,0,123,207,52,95,1,0,0,54,95,17,214,154,72,95,0,123,207,52,96,
+	1,0,0,54,96,17,214,154,72,96,0,123,207,52,97,1,0,0,54,97,17,214,154,72,
+	97,0,123,207,52,98,1,0,0,54,98,17,214,154,72,98,0,123,207,52,99,1,0,0,
+	54,99,17,214,154,72,99,0,123,207,52,100,1,0,0,54,100,17,214,154,72,100,0,123,
+	207,52,101,1,0,0,54,101,17,214,154,72,101,0,123,207,52,102,1,0,0,54,102,17,
+	214,154,72,102,0,123,207,52,103,1,0,0,54,103,17,214,154,72,103,0,123,207,52,104,
+	1,0,0,54,104,17,214,154,72,104,0,123,207,52,105,1,0,0,54,105,17,214,154,72,
+	105,0,123,207,52,106,3,0,0,56,106,15,214,154,72,106,0,123,207,52,107,4,0,0,
+	57,107,14,214,154,72,107,0,123,207,52,108,6,0,0,59,108,12,214,154,72,108,0,123,
+	207,52,109,7,0,0,60,109,11,214,154,72,109,0,0,0,52,110,9,0,0,62,110,9,
+	214,154,72,110,0,0,0,63,111,8,214,154,65,112,6,214,154,66,113,5,214,154,68,114,
+	3,214,154,69,115,2,214,154,71,116,0,214,154,255,61,86,130,0,0,0,0,33,4,64,
+	86,8,0,0,72,87,130,33,4,33,4,181,150,52,88,130,206,89,33,4,33,4,72,88,
+	2,181,150,52,89,134,206,89,206,89,206,89,206,89,206,89,33,4,33,4,71,89,3,181,
+	150,52,90,7,206,89,60,90,8,33,4,69,90,5,181,150,52,91,11,206,89,64,91,138,
+	33,4,33,4,33,4,33,4,181,150,181,150,181,150,181,150,181,150,181,150,181,150,52,92,
+	14,206,89,67,92,7,181,150,52,93,14,206,89,67,93,7,181,150,52,94,14,206,89,67,
+	94,7,181,150,52,95,14,206,89,67,95,7,181,150,52,96,14,206,89,67,96,7,181,150,
+	52,97,14,206,89,67,97,7,181,150,52,98,14,206,89,67,98,7,181,150,52,99,14,206,
+	89,67,99,7,181,150,52,100,14,206,89,67,100,7,181,150,52,101,14,206,89,67,101,7,
+	181,150,52,102,14,206,89,67,102,7,181,150,52,103,14,206,89,67,103,6,181,150,52,104,
+	14,206,89,67,104,6,181,150,52,105,14,206,89,67,105,5,181,150,53,106,13,206,89,67,
+	106,5,181,150,55,107,11,206,89,67,107,133,181,150,181,150,181,150,181,150,181,150,0,0,
+	56,108,10,206,89,67,108,133,181,150,181,150,181,150,181,150,181,150,0,0,57,109,9,206,
+	89,67,109,132,181,150,181,150,181,150,181,150,0,0,58,110,8,206,89,67,110,132,181,150,
+	181,150,181,150,0,0,0,0,60,111,139,206,89,206,89,206,89,206,89,206,89,206,89,206,
+	89,181,150,181,150,181,150,0,0,0,0,61,112,138,206,89,206,89,206,89,206,89,206,89,
+	206,89,181,150,181,150,0,0,0,0,0,0,62,113,137,206,89,206,89,206,89,206,89,206,
+	89,181,150,181,150,0,0,0,0,0,0,63,114,136,206,89,206,89,206,89,206,89,181,150,
+	0,0,0,0,0,0,0,0,65,115,134,206,89,206,89,181,150,0,0,0,0,0,0,0,
+	0,66,116,133,206,89,0,0,0,0,0,0,0,0,0,0,255,63,86,129,0,0,33,4,
+	54,87,131,181,150,33,4,33,4,33,4,52,88,132,0,0,0,0,181,150,181,150,181,150,
+	52,89,134,0,0,0,0,181,150,181,150,181,150,181,150,181,150,70,89,0,181,150,52,90,
+	136,0,0,0,0,181,150,181,150,181,150,181,150,181,150,181,150,181,150,68,90,0,181,150,
+	52,91,1,0,0,54,91,8,181,150,63,91,132,33,4,33,4,33,4,181,150,181,150,52,
+	92,1,0,0,54,92,12,181,150,52,93,1,0,0,54,93,12,181,150,52,94,1,0,0,
+	54,94,12,181,150,52,95,1,0,0,54,95,12,181,150,52,96,1,0,0,54,96,12,181,
+	150,52,97,1,0,0,54,97,12,181,150,52,98,1,0,0,54,98,12,181,150,52,99,1,
+	0,0,54,99,12,181,150,52,100,1,0,0,54,100,12,181,150,52,101,1,0,0,54,101,
+	12,181,150,52,102,1,0,0,54,102,12,181,150,52,103,2,0,0,55,103,11,181,150,52,
+	104,2,0,0,55,104,11,181,150,52,105,3,0,0,56,105,10,181,150,53,106,3,0,0,
+	57,106,14,181,150,72,106,0,0,0,55,107,2,0,0,58,107,12,181,150,71,107,0,0,
+	0,56,108,1,0,0,58,108,12,181,150,71,108,0,0,0,57,109,1,0,0,59,109,10,
+	181,150,70,109,0,0,0,58,110,1,0,0,60,110,8,181,150,69,110,0,0,0,60,111,
+	8,181,150,69,111,0,0,0,61,112,135,181,150,181,150,181,150,181,150,181,150,181,150,181,
+	150,0,0,62,113,134,181,150,181,150,181,150,181,150,181,150,0,0,0,0,63,114,132,181,
+	150,181,150,181,150,0,0,0,0,63,115,132,181,150,181,150,181,150,0,0,0,0,64,116,
+	130,181,150,0,0,0,0,255,64,86,129,0,0,33,4,72,87,2,0,0,72,88,132,33,
+	4,33,4,33,4,33,4,206,89,58,89,0,33,4,70,89,134,33,4,33,4,33,4,206,
+	89,206,89,206,89,206,89,60,90,0,33,4,68,90,0,33,4,69,90,7,206,89,61,91,
+	4,33,4,66,91,10,206,89,63,92,13,206,89,63,93,13,206,89,63,94,13,206,89,63,
+	95,13,206,89,63,96,13,206,89,63,97,13,206,89,63,98,13,206,89,63,99,13,206,89,
+	63,100,13,206,89,63,101,13,206,89,63,102,13,206,89,63,103,13,206,89,63,104,13,206,
+	89,63,105,13,206,89,56,106,0,181,150,63,106,12,206,89,57,107,5,181,150,63,107,10,
+	206,89,57,108,5,181,150,63,108,9,206,89,58,109,4,181,150,63,109,8,206,89,59,110,
+	3,181,150,63,110,7,206,89,59,111,137,181,150,181,150,181,150,181,150,206,89,206,89,206,
+	89,206,89,206,89,206,89,60,112,135,181,150,181,150,181,150,206,89,206,89,206,89,206,89,
+	206,89,60,113,134,181,150,181,150,181,150,206,89,206,89,206,89,206,89,61,114,132,181,150,
+	181,150,206,89,206,89,206,89,61,115,132,181,150,181,150,206,89,0,0,0,0,62,116,130,
+	181,150,0,0,0,0,255,56,86,0,123,207,57,86,10,33,4,54,87,130,0,0,0,0,
+	123,207,54,88,130,0,0,0,0,123,207,74,88,130,214,154,0,0,0,0,54,89,131,0,
+	0,0,0,123,207,33,4,70,89,134,214,154,214,154,214,154,214,154,214,154,0,0,0,0,
+	54,90,133,0,0,0,0,123,207,123,207,33,4,33,4,66,90,8,214,154,75,90,1,0,
+	0,54,91,134,0,0,0,0,123,207,123,207,33,4,33,4,33,4,61,91,13,214,154,75,
+	91,1,0,0,54,92,131,0,0,0,0,123,207,123,207,58,92,16,214,154,75,92,1,0,
+	0,54,93,131,0,0,0,0,123,207,123,207,58,93,16,214,154,75,93,1,0,0,54,94,
+	131,0,0,0,0,123,207,123,207,58,94,16,214,154,75,94,1,0,0,54,95,131,0,0,
+	0,0,123,207,123,207,58,95,16,214,154,75,95,1,0,0,54,96,131,0,0,0,0,123,
+	207,123,207,58,96,16,214,154,75,96,1,0,0,54,97,131,0,0,0,0,123,207,123,207,
+	58,97,16,214,154,75,97,1,0,0,54,98,131,0,0,0,0,123,207,123,207,58,98,16,
+	214,154,75,98,1,0,0,54,99,131,0,0,0,0,123,207,123,207,58,99,16,214,154,75,
+	99,1,0,0,54,100,131,0,0,0,0,123,207,123,207,58,100,16,214,154,75,100,1,0,
+	0,54,101,131,0,0,0,0,123,207,123,207,58,101,16,214,154,75,101,1,0,0,54,102,
+	131,0,0,0,0,123,207,123,207,58,102,16,214,154,75,102,1,0,0,55,103,130,0,0,
+	123,207,123,207,58,103,16,214,154,75,103,1,0,0,55,104,130,0,0,123,207,123,207,58,
+	104,16,214,154,75,104,1,0,0,56,105,1,123,207,58,105,16,214,154,75,105,1,0,0,
+	56,106,1,123,207,58,106,14,214,154,73,106,2,0,0,56,107,1,123,207,58,107,13,214,
+	154,72,107,1,0,0,57,108,0,123,207,58,108,11,214,154,70,108,2,0,0,57,109,0,
+	123,207,58,109,10,214,154,69,109,2,0,0,57,110,0,123,207,58,110,8,214,154,67,110,
+	3,0,0,57,111,0,123,207,58,111,7,214,154,66,111,2,0,0,57,112,138,123,207,214,
+	154,214,154,214,154,214,154,214,154,214,154,0,0,0,0,0,0,0,0,57,113,137,123,207,
+	214,154,214,154,214,154,214,154,214,154,0,0,0,0,0,0,0,0,57,114,136,123,207,214,
+	154,214,154,214,154,0,0,0,0,0,0,0,0,0,0,57,115,134,123,207,214,154,214,154,
+	0,0,0,0,0,0,0,0,57,116,133,123,207,0,0,0,0,0,0,0,0,0,0,255,
+	56,86,0,33,4,68,86,0,33,4,56,87,0,33,4,71,87,0,0,0,56,88,0,33,
+	4,73,88,1,0,0,56,89,0,33,4,70,89,4,33,4,56,90,20,255,223,56,91,20,
+	255,223,56,92,20,255,223,56,93,20,255,223,56,94,20,255,223,56,95,20,255,223,56,96,
+	20,255,223,56,97,20,255,223,56,98,20,255,223,56,99,20,255,223,56,100,20,255,223,56,
+	101,20,255,223,56,102,20,255,223,56,103,20,255,223,56,104,20,255,223,56,105,20,255,223,
+	56,106,20,255,223,56,107,20,255,223,56,108,20,255,223,56,109,20,255,223,56,110,20,255,
+	223,57,111,8,0,0,57,112,6,0,0,57,113,5,0,0,57,114,3,0,0,57,115,2,
+	0,0,57,116,0,0,0,255,56,86,1,0,0,69,86,1,33,4,56,87,0,0,0,71,
+	87,0,33,4,55,89,0,33,4,74,89,0,0,0,54,90,1,255,223,75,90,1,0,0,
+	54,91,1,255,223,75,91,1,0,0,54,92,1,255,223,75,92,1,0,0,54,93,1,255,
+	223,75,93,1,0,0,54,94,1,255,223,75,94,1,0,0,54,95,1,255,223,75,95,1,
+	0,0,54,96,1,255,223,75,96,1,0,0,54,97,1,255,223,75,97,1,0,0,54,98,
+	1,255,223,75,98,1,0,0,54,99,1,255,223,75,99,1,0,0,54,100,1,255,223,75,
+	100,1,0,0,54,101,1,255,223,75,101,1,0,0,54,102,1,255,223,75,102,1,0,0,
+	54,103,1,255,223,75,103,1,0,0,54,104,1,255,223,75,104,1,0,0,54,105,1,255,
+	223,75,105,1,0,0,54,106,1,255,223,75,106,1,0,0,54,107,1,255,223,75,107,1,
+	0,0,54,108,1,255,223,75,108,1,0,0,54,109,1,255,223,75,109,1,0,0,54,110,
+	1,255,223,75,110,1,0,0,255,58,86,1,0,0,71,86,1,33,4,57,87,0,0,0,
+	72,87,0,33,4,54,89,0,33,4,73,89,0,0,0,52,90,1,255,223,73,90,1,0,
+	0,52,91,1,255,223,73,91,1,0,0,52,92,1,255,223,73,92,1,0,0,52,93,1,
+	255,223,73,93,1,0,0,52,94,1,255,223,73,94,1,0,0,52,95,1,255,223,73,95,
+	1,0,0,52,96,1,255,223,73,96,1,0,0,52,97,1,255,223,73,97,1,0,0,52,
+	98,1,255,223,73,98,1,0,0,52,99,1,255,223,73,99,1,0,0,52,100,1,255,223,
+	73,100,1,0,0,52,101,1,255,223,73,101,1,0,0,52,102,1,255,223,73,102,1,0,
+	0,52,103,1,255,223,73,103,1,0,0,52,104,1,255,223,73,104,1,0,0,52,105,1,
+	255,223,73,105,1,0,0,52,106,1,255,223,73,106,1,0,0,52,107,1,255,223,73,107,
+	1,0,0,52,108,1,255,223,73,108,1,0,0,52,109,1,255,223,73,109,1,0,0,52,
+	110,1,255,223,73,110,1,0,0,255,60,86,0,0,0,72,86,0,123,207,72,87,0,123,
+	207,54,88,129,214,154,33,4,72,88,0,123,207,54,89,4,214,154,72,89,0,123,207,52,
+	90,1,0,0,54,90,9,214,154,64,90,136,33,4,33,4,33,4,33,4,33,4,33,4,
+	33,4,123,207,123,207,52,91,1,0,0,54,91,13,214,154,68,91,132,33,4,33,4,33,
+	4,123,207,123,207,52,92,1,0,0,54,92,17,214,154,72,92,0,123,207,52,93,1,0,
+	0,54,93,17,214,154,72,93,0,123,207,52,94,1,0,0,54,94,17,214,154,72,94,0,
+	123,207,52,95,1,0,0,54,95,17,214,154,72,95,0,123,207,52,96,1,0,0,54,96,
+	17,214,154,72,96,0,123,207,52,97,1,0,0,54,97,17,214,154,72,97,0,123,207,52,
+	98,1,0,0,54,98,17,214,154,72,98,0,123,207,52,99,1,0,0,54,99,17,214,154,
+	72,99,0,123,207,52,100,1,0,0,54,100,17,214,154,72,100,0,123,207,52,101,1,0,
+	0,54,101,17,214,154,72,101,0,123,207,52,102,1,0,0,54,102,17,214,154,72,102,0,
+	123,207,52,103,1,0,0,54,103,17,214,154,72,103,0,123,207,52,104,1,0,0,54,104,
+	17,214,154,72,104,0,123,207,52,105,1,0,0,54,105,17,214,154,72,105,0,123,207,52,
+	106,3,0,0,56,106,15,214,154,72,106,0,123,207,52,107,4,0,0,57,107,14,214,154,
+	72,107,0,123,207,52,108,6,0,0,59,108,12,214,154,72,108,0,123,207,52,109,7,0,
+	0,60,109,11,214,154,72,109,0,0,0,52,110,9,0,0,62,110,9,214,154,72,110,0,
+	0,0,63,111,8,214,154,65,112,6,214,154,66,113,5,214,154,68,114,3,214,154,69,115,
+	2,214,154,71,116,0,214,154,255,61,86,130,0,0,0,0,33,4,64,86,8,0,0,72,
+	87,130,33,4,33,4,181,150,52,88,130,206,89,33,4,33,4,72,88,2,181,150,52,89,
+	134,206,89,206,89,206,89,206,89,206,89,33,4,33,4,71,89,3,181,150,52,90,7,206,
+	89,60,90,8,33,4,69,90,5,181,150,52,91,11,206,89,64,91,138,33,4,33,4,33,
+	4,33,4,181,150,181,150,181,150,181,150,181,150,181,150,181,150,52,92,14,206,89,67,92,
+	7,181,150,52,93,14,206,89,67,93,7,181,150,52,94,14,206,89,67,94,7,181,150,52,
+	95,14,206,89,67,95,7,181,150,52,96,14,206,89,67,96,7,181,150,52,97,14,206,89,
+	67,97,7,181,150,52,98,14,206,89,67,98,7,181,150,52,99,14,206,89,67,99,7,181,
+	150,52,100,14,206,89,67,100,7,181,150,52,101,14,206,89,67,101,7,181,150,52,102,14,
+	206,89,67,102,7,181,150,52,103,14,206,89,67,103,6,181,150,52,104,14,206,89,67,104,
+	6,181,150,52,105,14,206,89,67,105,5,181,150,53,106,13,206,89,67,106,5,181,150,55,
+	107,11,206,89,67,107,133,181,150,181,150,181,150,181,150,181,150,0,0,56,108,10,206,89,
+	67,108,133,181,150,181,150,181,150,181,150,181,150,0,0,57,109,9,206,89,67,109,132,181,
+	150,181,150,181,150,181,150,0,0,58,110,8,206,89,67,110,132,181,150,181,150,181,150,0,
+	0,0,0,60,111,139,206,89,206,89,206,89,206,89,206,89,206,89,206,89,181,150,181,150,
+	181,150,0,0,0,0,61,112,138,206,89,206,89,206,89,206,89,206,89,206,89,181,150,181,
+	150,0,0,0,0,0,0,62,113,137,206,89,206,89,206,89,206,89,206,89,181,150,181,150,
+	0,0,0,0,0,0,63,114,136,206,89,206,89,206,89,206,89,181,150,0,0,0,0,0,
+	0,0,0,65,115,134,206,89,206,89,181,150,0,0,0,0,0,0,0,0,66,116,133,206,
+	89,0,0,0,0,0,0,0,0,0,0,255,63,86,129,0,0,33,4,54,87,131,181,150,
+	33,4,33,4,33,4,52,88,132,0,0,0,0,181,150,181,150,181,150,52,89,134,0,0,
+	0,0,181,150,181,150,181,150,181,150,181,150,70,89,0,181,150,52,90,136,0,0,0,0,
+	181,150,181,150,181,150,181,150,181,150,181,150,181,150,68,90,0,181,150,52,91,1,0,0,
+	54,91,8,181,150,63,91,132,33,4,33,4,33,4,181,150,181,150,52,92,1,0,0,54,
+	92,12,181,150,52,93,1,0,0,54,93,12,181,150,52,94,1,0,0,54,94,12,181,150,
+	52,95,1,0,0,54,95,12,181,150,52,96,1,0,0,54,96,12,181,150,52,97,1,0,
+	0,54,97,12,181,150,52,98,1,0,0,54,98,12,181,150,52,99,1,0,0,54,99,12,
+	181,150,52,100,1,0,0,54,100,12,181,150,52,101,1,0,0,54,101,12,181,150,52,102,
+	1,0,0,54,102,12,181,150,52,103,2,0,0,55,103,11,181,150,52,104,2,0,0,55,
+	104,11,181,150,52,105,3,0,0,56,105,10,181,150,53,106,3,0,0,57,106,14,181,150,
+	72,106,0,0,0,55,107,2,0,0,58,107,12,181,150,71,107,0,0,0,56,108,1,0,
+	0,58,108,12,181,150,71,108,0,0,0,57,109,1,0,0,59,109,10,181,150,70,109,0,
+	0,0,58,110,1,0,0,60,110,8,181,150,69,110,0,0,0,60,111,8,181,150,69,111,
+	0,0,0,61,112,135,181,150,181,150,181,150,181,150,181,150,181,150,181,150,0,0,62,113,
+	134,181,150,181,150,181,150,181,150,181,150,0,0,0,0,63,114,132,181,150,181,150,181,150,
+	0,0,0,0,63,115,132,181,150,181,150,181,150,0,0,0,0,64,116,130,181,150,0,0,
+	0,0,255,254
+};
+
+const AnimClip LogoClip = {32, 236, LogoClipData};
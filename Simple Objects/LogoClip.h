@@ -0,0 +1,13 @@
+// LogoClip.h
+// Runs on TM4C123
+// Generated by the host encoder, do not edit.
+
+#ifndef _LOGOCLIPH_
+#define _LOGOCLIPH_
+
+#include "Anim.h"
+
+// One turn of the shaded solid cube, 32 frames
+extern const AnimClip LogoClip;
+
+#endif
@@ -0,0 +1,148 @@
+// Mesh.c
+// Runs on TM4C123
+// Back-face culling and hidden-line removal for closed meshes.
+
+#include <stdint.h>
+#include "Mesh.h"
+#include "Raster.h"
+#include "Trig.h"
+
+// Twice the signed area of a projected face. Screen y grows downward,
+// so a face wound counter clockwise from outside comes out negative.
+static int32_t faceArea(const uint8_t *q, const int16_t *sx, const int16_t *sy){
+	int32_t area = 0;
+	uint8_t i;
+	for(i = 0; i < 4; i++){
+		uint8_t j = (i + 1) & 3;
+		area += (int32_t)sx[q[i]] * sy[q[j]] - (int32_t)sx[q[j]] * sy[q[i]];
+	}
+	return area;
+}
+
+void Mesh_FrontFaces(const Mesh *m, const int16_t *sx, const int16_t *sy, uint32_t *front){
+	uint8_t f;
+	for(f = 0; f < MESH_MASKWORDS; f++){
+		front[f] = 0;
+	}
+	for(f = 0; f < m->numFaces; f++){
+		if(faceArea(m->faces[f], sx, sy) < 0)
+			front[f >> 5] |= 1UL << (f & 31);
+	}
+}
+
+void Mesh_DrawWire(const Mesh *m, const int16_t *sx, const int16_t *sy,
+                   const uint32_t *front, uint16_t color, uint8_t mode){
+	uint8_t e;
+	for(e = 0; e < m->numEdges; e++){
+		const MeshEdge *edge = &m->edges[e];
+		if(mode == MESH_FRONTEDGES &&
+		   !MESH_ISFRONT(front, edge->f0) && !MESH_ISFRONT(front, edge->f1))
+			continue;
+		Raster_Line(sx[edge->a], sy[edge->a], sx[edge->b], sy[edge->b], color);
+	}
+}
+
+void Mesh_DrawSolid(const Mesh *m, const int16_t *sx, const int16_t *sy,
+                    const uint32_t *front, const uint16_t *colors){
+	int16_t xs[4], ys[4];
+	uint8_t f, i, n;
+	for(f = 0; f < m->numFaces; f++){
+		const uint8_t *q = m->faces[f];
+		if(!MESH_ISFRONT(front, f))
+			continue;
+		n = (q[3] == q[2]) ? 3 : 4;
+		for(i = 0; i < n; i++){
+			xs[i] = sx[q[i]];
+			ys[i] = sy[q[i]];
+		}
+		Raster_FillConvex(xs, ys, n, colors[f]);
+	}
+}
+
+// amp*sin(pi*num/den) for any num, folded onto TRIG_BHASKARA's half turn
+static int16_t isin(int16_t num, int16_t den, int16_t amp){
+	int32_t t;
+	t = num % (2*den);
+	if(t < 0) t += 2*den;
+	if(t >= den)
+		return -TRIG_BHASKARA(t - den, den, amp);
+	return TRIG_BHASKARA(t, den, amp);
+}
+
+void Mesh_MakeSphere(Mesh *m, int8_t (*verts)[3], uint8_t (*faces)[4], MeshEdge *edges,
+                     uint8_t rings, uint8_t segs, int8_t radius){
+	uint8_t south = 1 + (rings - 1)*segs;
+	uint8_t k, j, j1, e = 0;
+
+	// Vertex 0 is the top pole, then rings top to bottom, then the bottom pole
+	verts[0][0] = 0; verts[0][1] = radius; verts[0][2] = 0;
+	verts[south][0] = 0; verts[south][1] = -radius; verts[south][2] = 0;
+	for(k = 1; k < rings; k++){
+		int16_t y = isin(2*k + rings, 2*rings, radius);
+		int16_t rho = isin(k, rings, radius);
+		for(j = 0; j < segs; j++){
+			uint8_t v = 1 + (k - 1)*segs + j;
+			verts[v][0] = isin(4*j + segs, 2*segs, rho);
+			verts[v][1] = y;
+			verts[v][2] = isin(2*j, segs, rho);
+		}
+	}
+
+	// Face k*segs + j lies in band k, between rings k and k+1
+	for(k = 0; k < rings; k++){
+		for(j = 0; j < segs; j++){
+			uint8_t *q = faces[k*segs + j];
+			j1 = (j + 1 == segs) ? 0 : j + 1;
+			if(k == 0){
+				q[0] = 0; q[1] = 1 + j1; q[2] = q[3] = 1 + j;
+			}
+			else if(k == rings - 1){
+				q[0] = 1 + (k - 1)*segs + j;
+				q[1] = 1 + (k - 1)*segs + j1;
+				q[2] = q[3] = south;
+			}
+			else{
+				q[0] = 1 + (k - 1)*segs + j;
+				q[1] = 1 + (k - 1)*segs + j1;
+				q[2] = 1 + k*segs + j1;
+				q[3] = 1 + k*segs + j;
+			}
+		}
+	}
+
+	for(k = 0; k < rings; k++){
+		for(j = 0; j < segs; j++){
+			j1 = (j + 1 == segs) ? 0 : j + 1;
+			// Along ring k, between bands k-1 and k
+			if(k > 0){
+				edges[e].a = 1 + (k - 1)*segs + j;
+				edges[e].b = 1 + (k - 1)*segs + j1;
+				edges[e].f0 = (k - 1)*segs + j;
+				edges[e].f1 = k*segs + j;
+				e++;
+			}
+			// Down band k, between its faces j-1 and j
+			edges[e].a = (k == 0) ? 0 : 1 + (k - 1)*segs + j;
+			edges[e].b = (k == rings - 1) ? south : 1 + k*segs + j;
+			edges[e].f0 = k*segs + (j == 0 ? segs - 1 : j - 1);
+			edges[e].f1 = k*segs + j;
+			e++;
+		}
+	}
+
+	m->numVerts = south + 1;
+	m->numFaces = rings*segs;
+	m->numEdges = e;
+	m->faces = (const uint8_t (*)[4])faces;
+	m->edges = edges;
+	m->verts = (const int8_t (*)[3])verts;
+}
+
+uint8_t Mesh_SelectLOD(const MeshLOD *lod, int16_t radius){
+	uint8_t i;
+	for(i = 0; i + 1 < lod->numLevels; i++){
+		if(radius >= lod->minRadius[i])
+			return i;
+	}
+	return lod->numLevels - 1;
+}
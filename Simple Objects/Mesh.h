@@ -0,0 +1,108 @@
+// Mesh.h
+// Runs on TM4C123
+// Face aware meshes for closed solids. Knowing which faces share each
+// edge lets the renderer cull faces that point away from the viewer and
+// skip the edges that lie entirely behind the object. A mesh may come in
+// several resolutions, with the renderer picking one by projected size.
+
+#ifndef _MESHH_
+#define _MESHH_
+
+#include <stdint.h>
+
+// Most faces a mesh may have, one bit each in the front face mask
+#define MESH_MAXFACES 64
+#define MESH_MASKWORDS (MESH_MAXFACES/32)
+#define MESH_ISFRONT(front, f) (((front)[(f) >> 5] >> ((f) & 31)) & 1)
+
+// Most resolutions one MeshLOD may hold
+#define MESH_MAXLOD 4
+
+// Storage needed by Mesh_MakeSphere
+#define MESH_SPHEREVERTS(rings, segs) (2 + ((rings) - 1)*(segs))
+#define MESH_SPHEREFACES(rings, segs) ((rings)*(segs))
+#define MESH_SPHEREEDGES(rings, segs) ((2*(rings) - 1)*(segs))
+
+// Wireframe modes for Mesh_DrawWire
+#define MESH_ALLEDGES   0   // see-through, every edge is drawn
+#define MESH_FRONTEDGES 1   // hidden lines removed, edges of front faces only
+
+// An edge between vertices a and b, shared by faces f0 and f1
+typedef struct {
+	uint8_t a, b;
+	uint8_t f0, f1;
+} MeshEdge;
+
+// Faces list their corners counter clockwise as seen from outside the
+// solid. A triangle repeats its last corner. verts holds model space
+// positions, or is 0 when the caller generates positions every frame.
+typedef struct {
+	uint8_t numVerts;
+	uint8_t numFaces;
+	uint8_t numEdges;
+	const uint8_t (*faces)[4];
+	const MeshEdge *edges;
+	const int8_t (*verts)[3];
+} Mesh;
+
+// The same object at several resolutions, finest first. Level i is used
+// while the object's projected radius is at least minRadius[i] pixels.
+typedef struct {
+	uint8_t numLevels;
+	const Mesh *levels[MESH_MAXLOD];
+	uint8_t minRadius[MESH_MAXLOD];
+} MeshLOD;
+
+//------------Mesh_FrontFaces------------
+// Find the faces that point toward the viewer from the signed area of
+// each projected face.
+// Input: m       mesh
+//        sx, sy  projected screen coordinates, one per vertex
+//        front   MESH_MASKWORDS words, bit f set if face f is front facing
+// Output: none
+void Mesh_FrontFaces(const Mesh *m, const int16_t *sx, const int16_t *sy, uint32_t *front);
+
+//------------Mesh_DrawWire------------
+// Draw the edges of a mesh.
+// Input: m       mesh
+//        sx, sy  projected screen coordinates, one per vertex
+//        front   masks from Mesh_FrontFaces
+//        color   16-bit color
+//        mode    MESH_ALLEDGES or MESH_FRONTEDGES
+// Output: none
+void Mesh_DrawWire(const Mesh *m, const int16_t *sx, const int16_t *sy,
+                   const uint32_t *front, uint16_t color, uint8_t mode);
+
+//------------Mesh_DrawSolid------------
+// Fill the front facing faces of a convex mesh. Back faces are culled,
+// so no depth sorting is needed.
+// Input: m       mesh
+//        sx, sy  projected screen coordinates, one per vertex
+//        front   masks from Mesh_FrontFaces
+//        colors  16-bit color of each face
+// Output: none
+void Mesh_DrawSolid(const Mesh *m, const int16_t *sx, const int16_t *sy,
+                    const uint32_t *front, const uint16_t *colors);
+
+//------------Mesh_MakeSphere------------
+// Build a latitude/longitude sphere into caller supplied storage sized
+// with the MESH_SPHERE macros. The caps are triangles, the rest quads.
+// Input: m        mesh to fill in
+//        verts    MESH_SPHEREVERTS(rings, segs) positions
+//        faces    MESH_SPHEREFACES(rings, segs) faces, at most MESH_MAXFACES
+//        edges    MESH_SPHEREEDGES(rings, segs) edges
+//        rings    bands from pole to pole, at least 2
+//        segs     segments around the equator, at least 3
+//        radius   model space radius, at most 127
+// Output: none
+void Mesh_MakeSphere(Mesh *m, int8_t (*verts)[3], uint8_t (*faces)[4], MeshEdge *edges,
+                     uint8_t rings, uint8_t segs, int8_t radius);
+
+//------------Mesh_SelectLOD------------
+// Pick the resolution to draw for an object of a given on screen size.
+// Input: lod     available resolutions
+//        radius  projected radius of the object in pixels
+// Output: index into lod->levels
+uint8_t Mesh_SelectLOD(const MeshLOD *lod, int16_t radius);
+
+#endif
@@ -0,0 +1,48 @@
+// Quality.c
+// Runs on TM4C123
+// Adaptive quality controller driven by frame time.
+
+#include <stdint.h>
+#include "Quality.h"
+
+uint8_t Quality_Level;
+
+static uint8_t MaxLevel;
+static uint16_t Budget;       // ms
+static int32_t Average;       // running average of busy time, 1/16 ms
+static uint8_t Calm;          // frames in a row under the low water mark
+
+void Quality_Init(uint16_t budgetMs, uint8_t maxLevel){
+	Budget = budgetMs;
+	MaxLevel = maxLevel;
+	Quality_Level = maxLevel;
+	Average = 0;
+	Calm = 0;
+}
+
+uint8_t Quality_Update(uint16_t busyMs){
+	int32_t high = (int32_t)Budget*14;     // 7/8 of the budget in 1/16 ms
+	int32_t low = (int32_t)Budget*8;       // 1/2 of the budget
+
+	// Average over about four frames
+	Average += (((int32_t)busyMs << 4) - Average)/4;
+	if(busyMs >= Budget || Average > high){
+		if(Quality_Level > 0){
+			Quality_Level--;
+			// Start the average over at the budget's midpoint so one slow
+			// frame does not pull several levels off
+			Average = (high + low)/2;
+		}
+		Calm = 0;
+	}
+	else if(Average < low){
+		if(++Calm >= QUALITY_HOLD && Quality_Level < MaxLevel){
+			Quality_Level++;
+			Calm = 0;
+		}
+	}
+	else{
+		Calm = 0;
+	}
+	return Quality_Level;
+}
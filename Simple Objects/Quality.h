@@ -0,0 +1,37 @@
+// Quality.h
+// Runs on TM4C123
+// Adaptive quality controller. Each frame it is told how long the frame
+// took to draw, keeps a running average, and steps a detail level down
+// as soon as frames come close to the frame budget and back up after a
+// run of frames that finish with time to spare. The caller maps the
+// level onto its own knobs, such as mesh LOD, view distance, noise
+// octaves or how the screen is erased, so a busy MCU degrades the
+// picture instead of dropping frames.
+
+#ifndef _QUALITYH_
+#define _QUALITYH_
+
+#include <stdint.h>
+
+// Frames in a row under the low water mark before the level goes up
+#define QUALITY_HOLD 8
+
+// Current detail level, 0 is the cheapest
+extern uint8_t Quality_Level;
+
+//------------Quality_Init------------
+// Start the controller at the highest level.
+// Input: budgetMs  time a frame may take, usually the frame period
+//        maxLevel  highest detail level
+// Output: none
+void Quality_Init(uint16_t budgetMs, uint8_t maxLevel);
+
+//------------Quality_Update------------
+// Feed in the time the last frame took and pick the next level.
+// Drops a level when the average passes 7/8 of the budget or a single
+// frame overruns it, rises a level after QUALITY_HOLD frames under 1/2.
+// Input: busyMs  time the last frame spent drawing, such as Frame_Busy
+// Output: detail level for the next frame
+uint8_t Quality_Update(uint16_t busyMs);
+
+#endif
@@ -0,0 +1,289 @@
+// Raster.c
+// Runs on TM4C123
+// Screen space scanline rasterizer for filled, flat shaded polygons.
+// Edges are walked once with a 16.16 fixed point DDA to find the left
+// and right extent of every row, then each row goes out as one span.
+
+#include <stdint.h>
+#include "ST7735.h"
+#include "Raster.h"
+
+#define RASTER_W ST7735_TFTWIDTH
+#define RASTER_H ST7735_TFTHEIGHT
+
+static SpanFunc Span = ST7735_DrawFastHLine;
+static LineFunc Line = 0;
+
+// Left and right extent of the polygon being filled, one entry per row
+static int16_t SpanL[RASTER_H];
+static int16_t SpanR[RASTER_H];
+
+void Raster_SetSpanOutput(SpanFunc fn){
+	Span = fn ? fn : ST7735_DrawFastHLine;
+}
+
+void Raster_SetLineOutput(LineFunc fn){
+	Line = fn;
+}
+
+// Walk one edge and widen the extents of the rows it crosses between
+// top and bottom. l and r are indexed from row top.
+static void walkEdge(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                     int16_t top, int16_t bottom, int16_t *l, int16_t *r){
+	int32_t fx, step;
+	int16_t y, x;
+
+	if(y0 > y1){
+		int16_t t;
+		t = x0; x0 = x1; x1 = t;
+		t = y0; y0 = y1; y1 = t;
+	}
+	if(y1 < top || y0 > bottom)
+		return;
+	if(y0 == y1){
+		y = y0 - top;
+		if(x0 < l[y]) l[y] = x0;
+		if(x1 < l[y]) l[y] = x1;
+		if(x0 > r[y]) r[y] = x0;
+		if(x1 > r[y]) r[y] = x1;
+		return;
+	}
+	step = ((int32_t)(x1 - x0) << 16) / (y1 - y0);
+	fx = ((int32_t)x0 << 16) + 0x8000;
+	if(y0 < top){
+		fx += step * (top - y0);
+		y0 = top;
+	}
+	if(y1 > bottom)
+		y1 = bottom;
+	for(y = y0 - top; y <= y1 - top; y++){
+		x = fx >> 16;
+		if(x < l[y]) l[y] = x;
+		if(x > r[y]) r[y] = x;
+		fx += step;
+	}
+}
+
+void Raster_Extents(const int16_t *xs, const int16_t *ys, uint8_t n,
+                    int16_t top, int16_t bottom, int16_t *l, int16_t *r){
+	int16_t y;
+	uint8_t i;
+
+	for(y = 0; y <= bottom - top; y++){
+		l[y] = 0x7FFF;
+		r[y] = -0x7FFF;
+	}
+	for(i = 0; i < n; i++){
+		uint8_t j = (i + 1 == n) ? 0 : i + 1;
+		walkEdge(xs[i], ys[i], xs[j], ys[j], top, bottom, l, r);
+	}
+}
+
+void Raster_FillConvex(const int16_t *xs, const int16_t *ys, uint8_t n, uint16_t color){
+	int16_t ymin = ys[0], ymax = ys[0];
+	int16_t y, l, r;
+	uint8_t i;
+
+	if(n < 3 || n > RASTER_MAXVERTS)
+		return;
+	for(i = 1; i < n; i++){
+		if(ys[i] < ymin) ymin = ys[i];
+		if(ys[i] > ymax) ymax = ys[i];
+	}
+	if(ymax < 0 || ymin >= RASTER_H)
+		return;
+	if(ymin < 0) ymin = 0;
+	if(ymax >= RASTER_H) ymax = RASTER_H - 1;
+
+	Raster_Extents(xs, ys, n, ymin, ymax, SpanL, SpanR);
+	for(y = ymin; y <= ymax; y++){
+		l = SpanL[y - ymin];
+		r = SpanR[y - ymin];
+		if(l < 0) l = 0;
+		if(r >= RASTER_W) r = RASTER_W - 1;
+		if(l <= r)
+			Span(l, y, r - l + 1, color);
+	}
+}
+
+void Raster_FillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         int16_t x2, int16_t y2, uint16_t color){
+	int16_t xs[3], ys[3];
+	xs[0] = x0; ys[0] = y0;
+	xs[1] = x1; ys[1] = y1;
+	xs[2] = x2; ys[2] = y2;
+	Raster_FillConvex(xs, ys, 3, color);
+}
+
+void Raster_FillQuad(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                     int16_t x2, int16_t y2, int16_t x3, int16_t y3, uint16_t color){
+	int16_t xs[4], ys[4];
+	xs[0] = x0; ys[0] = y0;
+	xs[1] = x1; ys[1] = y1;
+	xs[2] = x2; ys[2] = y2;
+	xs[3] = x3; ys[3] = y3;
+	Raster_FillConvex(xs, ys, 4, color);
+}
+
+// Send the run [x0, x1] on row y, clipped to the screen
+static void lineRun(int16_t x0, int16_t x1, int16_t y, uint16_t color){
+	if(x0 > x1){
+		int16_t t = x0; x0 = x1; x1 = t;
+	}
+	if(y < 0 || y >= RASTER_H || x1 < 0 || x0 >= RASTER_W)
+		return;
+	if(x0 < 0) x0 = 0;
+	if(x1 >= RASTER_W) x1 = RASTER_W - 1;
+	Span(x0, y, x1 - x0 + 1, color);
+}
+
+void Raster_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	int16_t dx, dy, incx, incy, balance, start;
+
+	if(Line){
+		Line(x0, y0, x1, y1, color);
+		return;
+	}
+	if(x1 >= x0){
+		dx = x1 - x0;
+		incx = 1;
+	}
+	else{
+		dx = x0 - x1;
+		incx = -1;
+	}
+	if(y1 >= y0){
+		dy = y1 - y0;
+		incy = 1;
+	}
+	else{
+		dy = y0 - y1;
+		incy = -1;
+	}
+
+	if(dx >= dy){
+		dy <<= 1;
+		balance = dy - dx;
+		dx <<= 1;
+		start = x0;
+		while(x0 != x1){
+			if(balance >= 0){
+				lineRun(start, x0, y0, color);
+				y0 += incy;
+				balance -= dx;
+				start = x0 + incx;
+			}
+			balance += dy;
+			x0 += incx;
+		}
+		lineRun(start, x0, y0, color);
+	}
+	else{
+		dx <<= 1;
+		balance = dx - dy;
+		dy <<= 1;
+		while(y0 != y1){
+			lineRun(x0, x0, y0, color);
+			if(balance >= 0){
+				x0 += incx;
+				balance -= dy;
+			}
+			balance += dx;
+			y0 += incy;
+		}
+		lineRun(x0, x0, y0, color);
+	}
+}
+
+// Emit the quadrant run x0..x1 at row offset y, mirrored about the center.
+// A filled ellipse sends the whole row between the mirrored runs.
+static void ellipseRow(int16_t cx, int16_t cy, int16_t x0, int16_t x1, int16_t y,
+                       uint16_t color, uint8_t fill){
+	if(fill){
+		lineRun(cx - x1, cx + x1, cy + y, color);
+		if(y)
+			lineRun(cx - x1, cx + x1, cy - y, color);
+		return;
+	}
+	lineRun(cx + x0, cx + x1, cy + y, color);
+	if(x0 || x1)
+		lineRun(cx - x1, cx - x0, cy + y, color);
+	if(y){
+		lineRun(cx + x0, cx + x1, cy - y, color);
+		if(x0 || x1)
+			lineRun(cx - x1, cx - x0, cy - y, color);
+	}
+}
+
+// Midpoint ellipse. Region 1 steps x and drops y now and then, so each
+// row is a run of pixels. Region 2 steps y every time, one pixel per row.
+static void ellipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color, uint8_t fill){
+	int32_t rx2, ry2, px, py, p;
+	int16_t x = 0, y = ry, start = 0;
+
+	if(rx < 0) rx = -rx;
+	if(ry < 0) ry = -ry;
+	if(rx == 0 || ry == 0){
+		Raster_Line(cx - rx, cy - ry, cx + rx, cy + ry, color);
+		return;
+	}
+	rx2 = (int32_t)rx * rx;
+	ry2 = (int32_t)ry * ry;
+	px = 0;
+	py = 2 * rx2 * y;
+
+	p = ry2 - rx2 * ry + rx2 / 4;
+	while(px < py){
+		x++;
+		px += 2 * ry2;
+		if(p < 0){
+			p += ry2 + px;
+		}
+		else{
+			ellipseRow(cx, cy, start, x - 1, y, color, fill);
+			start = x;
+			y--;
+			py -= 2 * rx2;
+			p += ry2 + px - py;
+		}
+	}
+
+	p = ry2 * ((int32_t)x * x + x) + ry2 / 4 + rx2 * ((int32_t)(y - 1) * (y - 1)) - rx2 * ry2;
+	while(y >= 0){
+		ellipseRow(cx, cy, start, x, y, color, fill);
+		y--;
+		py -= 2 * rx2;
+		if(p > 0){
+			p += rx2 - py;
+		}
+		else{
+			x++;
+			px += 2 * ry2;
+			p += rx2 - py + px;
+		}
+		start = x;
+	}
+}
+
+void Raster_Ellipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color){
+	ellipse(cx, cy, rx, ry, color, 0);
+}
+
+void Raster_FillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color){
+	ellipse(cx, cy, rx, ry, color, 1);
+}
+
+uint16_t Raster_Shade(int32_t nx, int32_t ny, int32_t nz, uint8_t level){
+	int32_t sum;
+	uint16_t g;
+
+	if(nx < 0) nx = -nx;
+	if(ny < 0) ny = -ny;
+	if(nz < 0) nz = -nz;
+	sum = nx + ny + nz;
+	if(sum == 0)
+		return 0;
+	// Keep a floor so faces seen edge on stay visible against black
+	g = 4 + (level - 4) * nz / sum;
+	return (g << 11) | (g << 6) | g;
+}
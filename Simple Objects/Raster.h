@@ -0,0 +1,108 @@
+// Raster.h
+// Runs on TM4C123
+// Screen space scanline rasterizer for filled, flat shaded polygons.
+// Each covered row of a polygon is sent as one horizontal span, so a
+// filled face costs about 2 bytes/pixel of SPI traffic instead of the
+// 13 bytes/pixel of per-pixel setAddrWindow/pushColor drawing.
+
+#ifndef _RASTERH_
+#define _RASTERH_
+
+#include <stdint.h>
+
+// Largest polygon accepted by Raster_FillConvex
+#define RASTER_MAXVERTS 8
+
+// Receives one horizontal span: w pixels starting at (x, y)
+// Spans are already clipped to the 128 by 160 screen
+typedef void (*SpanFunc)(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+// Draws one whole line from (x0, y0) to (x1, y1) in place of Raster_Line
+typedef void (*LineFunc)(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+//------------Raster_SetSpanOutput------------
+// Select where finished spans are sent.
+// Input: fn  span receiver, 0 restores ST7735_DrawFastHLine
+// Output: none
+void Raster_SetSpanOutput(SpanFunc fn);
+
+//------------Raster_SetLineOutput------------
+// Hand every Raster_Line to another line drawer, such as Band_LineAA,
+// instead of breaking it into spans.
+// Input: fn  line drawer, 0 restores the span based Bresenham lines
+// Output: none
+void Raster_SetLineOutput(LineFunc fn);
+
+//------------Raster_FillConvex------------
+// Fill a convex polygon given in screen coordinates, one span per row.
+// Vertices may be in either winding order and may lie off screen.
+// Input: xs    x coordinates of the n vertices
+//        ys    y coordinates of the n vertices
+//        n     number of vertices, 3 to RASTER_MAXVERTS
+//        color 16-bit color
+// Output: none
+void Raster_FillConvex(const int16_t *xs, const int16_t *ys, uint8_t n, uint16_t color);
+
+//------------Raster_Extents------------
+// Find the left and right x of each row a convex polygon covers, without
+// drawing it. Rows outside the polygon come back with l > r. Used by
+// renderers that need the row extents but shade the pixels themselves.
+// Input: xs, ys  the n vertices
+//        n       number of vertices
+//        top     first row wanted
+//        bottom  last row wanted
+//        l, r    receive bottom-top+1 extents, entry 0 is row top
+// Output: none
+void Raster_Extents(const int16_t *xs, const int16_t *ys, uint8_t n,
+                    int16_t top, int16_t bottom, int16_t *l, int16_t *r);
+
+//------------Raster_FillTriangle------------
+// Fill a triangle given in screen coordinates.
+// Input: three vertices and a 16-bit color
+// Output: none
+void Raster_FillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         int16_t x2, int16_t y2, uint16_t color);
+
+//------------Raster_FillQuad------------
+// Fill a convex quadrilateral given in screen coordinates.
+// Emits one span per row rather than two triangles' worth.
+// Input: four vertices in order around the quad and a 16-bit color
+// Output: none
+void Raster_FillQuad(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                     int16_t x2, int16_t y2, int16_t x3, int16_t y3, uint16_t color);
+
+//------------Raster_Line------------
+// Draw a line between two screen points with Bresenham's algorithm.
+// Pixels that fall on the same row are merged into one span, so shallow
+// lines cost far less than one address window per pixel.
+// Input: two end points and a 16-bit color
+// Output: none
+void Raster_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+//------------Raster_Ellipse------------
+// Draw an axis aligned ellipse outline with the midpoint algorithm.
+// Points are mirrored into all four quadrants and neighbouring pixels on
+// a row go out as one span.
+// Input: cx, cy  center in screen coordinates
+//        rx, ry  horizontal and vertical radii in pixels
+//        color   16-bit color
+// Output: none
+void Raster_Ellipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color);
+
+//------------Raster_FillEllipse------------
+// Fill an axis aligned ellipse, one span per row.
+// Input: cx, cy  center in screen coordinates
+//        rx, ry  horizontal and vertical radii in pixels
+//        color   16-bit color
+// Output: none
+void Raster_FillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color);
+
+//------------Raster_Shade------------
+// Flat shade a face from its normal. Brightness follows how directly the
+// face points at the viewer, |nz|/(|nx|+|ny|+|nz|), so no square root.
+// Input: nx, ny, nz  face normal, any scale
+//        level       brightest gray level, 4 to 31
+// Output: 16-bit gray color
+uint16_t Raster_Shade(int32_t nx, int32_t ny, int32_t nz, uint8_t level);
+
+#endif
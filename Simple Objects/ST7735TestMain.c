@@ -21,114 +21,132 @@
 #include <stdio.h>
 #include <stdint.h>
 #include "ST7735.h"
+#include "Raster.h"
+#include "Mesh.h"
+#include "Band.h"
+#include "Scene.h"
+#include "Camera.h"
+#include "Trig.h"
+#include "Anim.h"
+#include "CubeAnim.h"
+#include "LogoClip.h"
+#include "Frame.h"
+#include "Quality.h"
+#include "Xform.h"
+#include "Fpu.h"
 #include "PLL.h"
 #include "tm4c123gh6pm.h"
 
 #define Sphere 0
 #define Cube 0
 #define Demo 1
+#define Solid 0
+#define ZScene 0
+#define LodSphere 0
+#define Crowd 0
+#define Baked 0
+#define Logo 0
+#define XformBench 0
+#define FloatBench 0
 #if Sphere == 1
 	#define DIMX 	12
 	#define DIMY 	14
 	#define FZS		15
+	#define SHADED	0
+	#define FRAMEMS	150
 #elif Cube == 1
 	#define DIMYR 	5
 	#define DIMZ 	5
 	#define FZ 		12
+	#define FRAMEMS	250
 #elif Demo == 1
 	#define DIMYR 	5
 	#define DIMZ 	5
 	#define FZ 		12
+	#define HIDDENLINE	0
+	#define ANTIALIAS	0
+	#define FRAMEMS	350
+#elif Solid == 1
+	#define DIMYR 	5
+	#define FZ 		12
+	#define FRAMEMS	350
+#elif ZScene == 1
+	#define DIMYR 	5
+	#define FZ 		12
+	#define NUMCUBES	3
+	#define FRAMEMS	350
+#elif LodSphere == 1
+	#define FZ 		60
+	#define SPHERER	16
+	#define FRAMEMS	150
+	#define LEVELS	4
+#elif Crowd == 1
+	#define DIMYR 	5
+	#define FZ 		48
+	#define NUMCUBES	20
+	#define FRAMEMS	350
+#elif Baked == 1 || Logo == 1
+	#define FRAMEMS	350
+#elif XformBench == 1
+	#define FRAMEMS	100
+	#define BENCHMAX	512
+#elif FloatBench == 1
+	#define FZ 		60
+	#define FRAMEMS	100
+	#define BENCHMAX	512
 #endif
 
-// Optimizations make the arrays powers of 2
-// Use only bitwise anding so no need for modulus
+// The wave arrays are built by the compiler with a power of 2 number of
+// steps per turn, so angles wrap with a bitwise and and no modulus
 
-#if Cube == 1
-const static int8_t wave[] = {0,2,4,6,7,7,7,6,4,2,0,-2,-4,-6,-7,-7,-7,-6,-4,-2};
-// Only needed for z rotations
-const static uint8_t zwave[] = {10,10,10,9,8,8,7,6,5,5,5,5,5,6,7,8,8,9,10,10};	
-#elif Demo == 1
-const static int8_t wave[] = {0,2,4,6,7,7,7,6,4,2,0,-2,-4,-6,-7,-7,-7,-6,-4,-2};
-// Only needed for z rotations
-const static uint8_t zwave[] = {10,10,10,9,8,8,7,6,5,5,5,5,5,6,7,8,8,9,10,10};	
+#if Cube == 1 || Demo == 1 || Solid == 1 || ZScene == 1 || LodSphere == 1 || Crowd == 1 || XformBench == 1 || FloatBench == 1
+#define WAVE(i)  TRIG_MAKESIN(i, 7)
+// Swings between 5 and 10, only needed for z rotations
+#define ZWAVE(i) ((16 + TRIG_MAKECOS(i, 5)) >> 1)
+const static int8_t wave[TRIG_STEPS] = {TRIG_TABLE(WAVE)};
+const static uint8_t zwave[TRIG_STEPS] = {TRIG_TABLE(ZWAVE)};
+// Angle steps turned per frame, the old 20 entry arrays moved 1/20 turn
+#define SPIN (TRIG_STEPS/32)
 #endif
 
+// One camera projects everything, set up for the demo in main
+Camera View;
+
 #if Sphere == 1
-void drawOctant(int x0, int y0, int z0, uint16_t color){
-	
-	int8_t x = 64 + ((x0+5)*FZS/(z0));
-	int8_t y = 80 + ((y0+20)*FZS/(z0));
-	
-	setAddrWindow(x,y,x,y);
-	pushColor(color);
-}	
-// Initial attempt and 3D modification of midpoint circle algorithm
-void drawcircle(int x1, int y1, int z1, int radius, uint16_t color, uint8_t plane)
-{
-		int8_t x0 = x1;//(x1*FZ/(z1));
-		int8_t y0 = y1;//((y1+10)*FZ/(z1));
-		int8_t z0 = z1;
-    int x = radius-1;
-    int y = 0;
-    int dx = 1;
-    int dy = 1;
-    int err = dx - (radius << 1);
-
-    while (x >= y)
-    {
-				if(plane == 0){
-					drawOctant(x0+x, y0+y, z0, color);
-					drawOctant(x0+x, y0-y, z0, color);
-					drawOctant(x0-x, y0+y, z0, color);
-					drawOctant(x0-x, y0-y, z0, color);
-					drawOctant(x0+y, y0+x, z0, color);
-					drawOctant(x0+y, y0-x, z0, color);
-					drawOctant(x0-y, y0+x, z0, color);
-					drawOctant(x0-y, y0-x, z0, color);
-				}
-				else if (plane == 1){
-					drawOctant(x0, y0+y, z0+(x/4), color);
-					drawOctant(x0, y0-y, z0+(x/4), color);
-					drawOctant(x0, y0+y, z0-(x/4), color);
-					drawOctant(x0, y0-y, z0-(x/4), color);
-					drawOctant(x0, y0+x, z0+(y/4), color);
-					drawOctant(x0, y0-x, z0+(y/4), color);
-					drawOctant(x0, y0+x, z0-(y/4), color);
-					drawOctant(x0, y0-x, z0-(y/4), color);
-				}
-				else{
-					drawOctant(x0+y, y0, z0+(x/4), color);
-					drawOctant(x0-y, y0, z0+(x/4), color);
-					drawOctant(x0+y, y0, z0-(x/4), color);
-					drawOctant(x0-y, y0, z0-(x/4), color);
-					drawOctant(x0+x, y0, z0+(y/4), color);
-					drawOctant(x0-x, y0, z0+(y/4), color);
-					drawOctant(x0+x, y0, z0-(y/4), color);
-					drawOctant(x0-x, y0, z0-(y/4), color);
-				}
-        if (err <= 0)
-        {
-            y++;
-            err += dy;
-            dy += 2;
-        }
-        
-        if (err > 0)
-        {
-            x--;
-            dx += 2;
-            err += dx - (radius << 1);
-        }
-    }
+// Project the centre and radius once and draw the outline and two great
+// circles as screen space ellipses. A great circle tipped in depth by
+// +/-tilt spreads by |offset from the view centre|*tilt/z across the
+// screen, which is the squash drawOctant produced one point at a time.
+void drawSphere(int x0, int y0, int z0, int radius, int ring, uint16_t color){
+	int16_t cx, cy;
+	int16_t z = Camera_Project(&View, x0, y0, z0, &cx, &cy);
+	int16_t r = Camera_Scale(&View, radius, z);
+	int16_t rr = Camera_Scale(&View, ring, z);
+	int16_t tilt = ring/4;
+#if SHADED == 1
+	int8_t k;
+	if(color == 0x0000){
+		Raster_FillEllipse(cx, cy, r, r, color);
+		return;
+	}
+	// Nested discs pulled toward a light at the upper left
+	for(k = 0; k < 4; k++){
+		int16_t rk = r*(4-k)/4;
+		int16_t off = (r - rk)/2;
+		Raster_FillEllipse(cx - off, cy - off, rk, rk, Raster_Shade(0, 0, 1, 10 + 7*k));
+	}
+#else
+	Raster_Ellipse(cx, cy, r, r, color);
+	Raster_Ellipse(cx, cy, (cx-View.cx)*tilt/z, rr, color);
+	Raster_Ellipse(cx, cy, rr, (cy-View.cy)*tilt/z, color);
+#endif
 }
 #elif Cube == 1 
 // Slightly modified Bresenham's algorithm
 void makeLine(int8_t x, int8_t y, int8_t z, int8_t x1, int8_t y1, int8_t z1, uint16_t color) {			
-	int8_t cx = 64 + (x*FZ/(z));
-	int8_t cy = 80 + ((y+10)*FZ/(z));
-	int8_t cx1 = 64 + (x1*FZ/(z1));
-	int8_t cy1 = 80 + ((y1+10)*FZ/(z1));
+	int16_t cx, cy, cx1, cy1;
+	Camera_Project(&View, x, y, z, &cx, &cy);
+	Camera_Project(&View, x1, y1, z1, &cx1, &cy1);
 	
 	int8_t	dx, dy;
 	int8_t	incx, incy;
@@ -192,10 +210,9 @@ void makeLine(int8_t x, int8_t y, int8_t z, int8_t x1, int8_t y1, int8_t z1, uin
 #elif Demo == 1
 // Slightly modified Bresenham's algorithm
 void makeLine(int8_t x, int8_t y, int8_t z, int8_t x1, int8_t y1, int8_t z1, uint16_t color) {			
-	int16_t cx = 64 + (x*FZ/(z));
-	int16_t cy = 80 + ((y+10)*FZ/(z));
-	int16_t cx1 = 64 + (x1*FZ/(z1));
-	int16_t cy1 = 80 + ((y1+10)*FZ/(z1));
+	int16_t cx, cy, cx1, cy1;
+	Camera_Project(&View, x, y, z, &cx, &cy);
+	Camera_Project(&View, x1, y1, z1, &cx1, &cy1);
 	
 	int8_t	dx, dy;
 	int8_t	incx, incy;
@@ -260,6 +277,54 @@ void makeLine(int8_t x, int8_t y, int8_t z, int8_t x1, int8_t y1, int8_t z1, uin
 
 
 
+#if Demo == 1 || Solid == 1 || ZScene == 1 || Crowd == 1
+// The plain Demo draws its edges one by one and needs no mesh
+#if Demo == 0 || HIDDENLINE == 1 || ANTIALIAS == 1
+// Corners 0-3 go around the top face, 4-7 around the bottom face
+const static uint8_t CubeFaces[6][4] = {{0,1,2,3},{7,6,5,4},{0,4,5,1},
+                                        {1,5,6,2},{2,6,7,3},{3,7,4,0}};
+const static MeshEdge CubeEdges[12] = {
+	{0,1,0,2},{1,2,0,3},{2,3,0,4},{3,0,0,5},	// top
+	{4,5,1,2},{5,6,1,3},{6,7,1,4},{7,4,1,5},	// bottom
+	{0,4,2,5},{1,5,2,3},{2,6,3,4},{3,7,4,5}	// connectors
+};
+#endif
+#if Solid == 1 || ZScene == 1 || HIDDENLINE == 1 || ANTIALIAS == 1
+const static Mesh CubeMesh = {8, 6, 12, CubeFaces, CubeEdges, 0};
+#endif
+int16_t sx[8], sy[8];
+
+void cubeVerts(int16_t i, int8_t x, int8_t y, int8_t v[8][3]){
+	uint8_t k;
+	for(k = 0; k < 4; k++){
+		uint16_t j = TRIG_WRAP(i + k*TRIG_QUARTER);
+		v[k][0] = v[k+4][0] = x + wave[j];
+		v[k][1] = y + DIMYR;
+		v[k+4][1] = y - DIMYR;
+		v[k][2] = v[k+4][2] = zwave[j];
+	}
+}
+// Project once per corner instead of once per line end
+void projectVerts(int8_t v[8][3]){
+	uint8_t k;
+	for(k = 0; k < 8; k++){
+		Camera_Project(&View, v[k][0], v[k][1], v[k][2], &sx[k], &sy[k]);
+	}
+}
+#endif
+
+#if Demo == 1 || Solid == 1
+// Move a bouncing coordinate on by steps frames, turning back whenever
+// the next move would leave lo to hi
+void bounce(int8_t *p, int8_t *d, int8_t lo, int8_t hi, uint16_t steps){
+	while(steps--){
+		if(*p + *d < lo || *p + *d > hi)
+			*d = -*d;
+		*p += *d;
+	}
+}
+#endif
+
 #if Cube == 1
 /***** Fun little rotation in xy plane ******
 void makeBox(int8_t i, uint16_t color){
@@ -291,20 +356,22 @@ void makeBox(int8_t i, uint16_t color){
 	
 }*/
 /***** Fun little rotation in xz plane ******/
-void makeBox(int8_t i, uint16_t color){
-	uint8_t z = zwave[i];
-	uint8_t z1 = zwave[(i+5)%20];
-	uint8_t z2 = zwave[(i+10)%20];
-	uint8_t z3 = zwave[(i+15)%20];
-	
-	int8_t a = wave[i];
-	int8_t b = wave[(i+10)%20];
-	
-	int8_t c = wave[(i+5)%20];
-	int8_t d = wave[(i+15)%20];
+void makeBox(int16_t i, uint16_t color){
+	uint8_t z, z1, z2, z3;
+	int8_t a, b, c, d;
 	
 	if(i < 0 && color == 0x0000)
 		return;
+	z = zwave[i];
+	z1 = zwave[TRIG_WRAP(i+TRIG_QUARTER)];
+	z2 = zwave[TRIG_WRAP(i+TRIG_HALF)];
+	z3 = zwave[TRIG_WRAP(i+3*TRIG_QUARTER)];
+	
+	a = wave[i];
+	b = wave[TRIG_WRAP(i+TRIG_HALF)];
+	
+	c = wave[TRIG_WRAP(i+TRIG_QUARTER)];
+	d = wave[TRIG_WRAP(i+3*TRIG_QUARTER)];
 	// Try to make this a loop
 	//uint8_t j = 0;
 	//for(j = 0; j < 20; j +=5){
@@ -331,23 +398,20 @@ void makeBox(int8_t i, uint16_t color){
 	makeLine(d, DIMYR, z3, d, -DIMYR, z3, color);
 }
 void runCube(void) {
-	int8_t i;
-	int8_t last = -1;
+	int16_t i = 0;
+	int16_t last = -1;
+	uint16_t steps;
 	while(1) {
-		for(i = 0; i < 20; i++) {
-			makeBox(last, 0x0000);
-			makeBox(i, 0xFFFF);
-			Delay1ms(250);
-			last = i;
-		}
-		last = 19;
+		makeBox(last, 0x0000);
+		makeBox(i, 0xFFFF);
+		steps = Frame_Wait();
+		last = i;
+		i = TRIG_WRAP(i + SPIN*steps);
 	}
 }
 #elif Sphere == 1
 void makeSphere(int8_t x, int8_t y, uint16_t color){
-	drawcircle(x, y, 15, 20, color, 0);
-	drawcircle(x, y, 15, 18, color, 1);
-	drawcircle(x, y, 15, 18, color, 2);
+	drawSphere(x, y, 15, 20, 18, color);
 }
 void runSphere(void)	{
 	int i, j, k = -1;
@@ -359,7 +423,7 @@ void runSphere(void)	{
 				makeSphere(lasti*k, lastj, 0x0000);
 			}
 			makeSphere(i*k, j, 0xFFFF);
-			Delay1ms(150);
+			Frame_Wait();
 			lasti = i;
 			lastj = j;
 		}
@@ -368,23 +432,25 @@ void runSphere(void)	{
 	}
 }
 #elif Demo == 1
-void makeBox(int8_t i, int8_t x, int8_t y, uint16_t color){
-	uint8_t z = zwave[i];
-	uint8_t z1 = zwave[(i+5)%20];
-	uint8_t z2 = zwave[(i+10)%20];
-	uint8_t z3 = zwave[(i+15)%20];
-	
-	int8_t a = x + wave[i];
-	int8_t b = x + wave[(i+10)%20];
-	
-	int8_t c = x + wave[(i+5)%20];
-	int8_t d = x + wave[(i+15)%20];
+void makeBox(int16_t i, int8_t x, int8_t y, uint16_t color){
+	uint8_t z, z1, z2, z3;
+	int8_t a, b, c, d;
 	
 	int8_t y1 = y + DIMYR;
 	int8_t y2 = y - DIMYR;
 	
 	if(i < 0 && color == 0x0000)
 		return;
+	z = zwave[i];
+	z1 = zwave[TRIG_WRAP(i+TRIG_QUARTER)];
+	z2 = zwave[TRIG_WRAP(i+TRIG_HALF)];
+	z3 = zwave[TRIG_WRAP(i+3*TRIG_QUARTER)];
+	
+	a = x + wave[i];
+	b = x + wave[TRIG_WRAP(i+TRIG_HALF)];
+	
+	c = x + wave[TRIG_WRAP(i+TRIG_QUARTER)];
+	d = x + wave[TRIG_WRAP(i+3*TRIG_QUARTER)];
 	// Try to make this a loop
 	//Top Face
 	makeLine(a, y1, z,  c, y1, z1, color);
@@ -402,39 +468,442 @@ void makeBox(int8_t i, int8_t x, int8_t y, uint16_t color){
 	makeLine(b, y1, z2, b, y2, z2, color);
 	makeLine(d, y1, z3, d, y2, z3, color);
 }
+#if HIDDENLINE == 1
+// Same box as makeBox, drawn through the mesh so edges behind the cube are skipped
+void makeWireBox(int16_t i, int8_t x, int8_t y, uint16_t color){
+	int8_t v[8][3];
+	uint32_t front[MESH_MASKWORDS];
+
+	if(i < 0 && color == 0x0000)
+		return;
+	cubeVerts(i, x, y, v);
+	projectVerts(v);
+	Mesh_FrontFaces(&CubeMesh, sx, sy, front);
+	Mesh_DrawWire(&CubeMesh, sx, sy, front, color, MESH_FRONTEDGES);
+}
+#endif
+#if ANTIALIAS == 1
+// Screen box the cube covered last frame, redrawn with the new one so
+// the bands clear what it left behind
+int16_t lastTop = 0x7FFF, lastBottom = -0x7FFF, lastLeft = 0x7FFF, lastRight = -0x7FFF;
+
+// Hidden line box with Wu lines blended into the band buffer. The box
+// around this frame's and last frame's cube is rendered band by band
+// and streamed in one window per band, so there is no erase pass.
+void makeAABox(int16_t i, int8_t x, int8_t y){
+	int8_t v[8][3];
+	uint32_t front[MESH_MASKWORDS];
+	int16_t top, bottom, left, right, t;
+	uint8_t k;
+
+	cubeVerts(i, x, y, v);
+	projectVerts(v);
+	Mesh_FrontFaces(&CubeMesh, sx, sy, front);
+	top = bottom = sy[0];
+	left = right = sx[0];
+	for(k = 1; k < 8; k++){
+		if(sy[k] < top) top = sy[k];
+		if(sy[k] > bottom) bottom = sy[k];
+		if(sx[k] < left) left = sx[k];
+		if(sx[k] > right) right = sx[k];
+	}
+	// Wu lines spill one pixel past the end points across their length
+	top--; bottom++; left--; right++;
+	t = top < lastTop ? top : lastTop;
+	lastTop = top;
+	top = t;
+	t = bottom > lastBottom ? bottom : lastBottom;
+	lastBottom = bottom;
+	bottom = t;
+	t = left < lastLeft ? left : lastLeft;
+	lastLeft = left;
+	left = t;
+	t = right > lastRight ? right : lastRight;
+	lastRight = right;
+	right = t;
+	if(top < 0) top = 0;
+	if(bottom >= ST7735_TFTHEIGHT) bottom = ST7735_TFTHEIGHT - 1;
+	Raster_SetLineOutput(Band_LineAA);
+	for(t = top; t <= bottom; t += BAND_ROWS){
+		Band_Begin(t, 0x0000);
+		Mesh_DrawWire(&CubeMesh, sx, sy, front, 0xFFFF, MESH_FRONTEDGES);
+		Band_Flush(left, right);
+	}
+	Raster_SetLineOutput(0);
+}
+#endif
 void runCube(void) {
-	int8_t i = 0;
-	int8_t last = -1;
-	int8_t lastx = 0, dx = 2;
-	int8_t lasty = 0, dy = 2;
+	int16_t i = 0;
+#if ANTIALIAS == 0
+	// Where the cube was drawn last frame, for the erase pass
+	int16_t last = -1;
+	int8_t lastx = 0, lasty = 0;
+#endif
+	int8_t x = 2, dx = 2;
+	int8_t y = 2, dy = 2;
+	uint16_t steps;
 	
 		while(1) {
-			for(i = 0; i < 20; i++) {
-				makeBox(last, lastx, lasty, 0x0000);
-				makeBox(i, lastx + dx, lasty + dy, 0xFFFF);
-				Delay1ms(350);
-				last = i;
-				lastx = lastx + dx;
-				lasty = lasty + dy;
-				if(lastx + dx < -25 || lastx + dx > 25)
-					dx = -dx;
-				if(lasty + dy < -37 || lasty + dy > 17)
-					dy = -dy;
+		#if ANTIALIAS == 1
+			makeAABox(i, x, y);
+		#elif HIDDENLINE == 1
+			makeWireBox(last, lastx, lasty, 0x0000);
+			makeWireBox(i, x, y, 0xFFFF);
+		#else
+			makeBox(last, lastx, lasty, 0x0000);
+			makeBox(i, x, y, 0xFFFF);
+		#endif
+			steps = Frame_Wait();
+		#if ANTIALIAS == 0
+			last = i;
+			lastx = x;
+			lasty = y;
+		#endif
+			// Turn and move as far as the frames that went by
+			i = TRIG_WRAP(i + SPIN*steps);
+			bounce(&x, &dx, -25, 25, steps);
+			bounce(&y, &dy, -37, 17, steps);
+		}
+}
+#elif Solid == 1
+void makeSolid(int16_t i, int8_t x, int8_t y, uint16_t color){
+	int8_t v[8][3];
+	uint16_t colors[6];
+	uint32_t front[MESH_MASKWORDS];
+	uint8_t f;
+
+	if(i < 0 && color == 0x0000)
+		return;
+	cubeVerts(i, x, y, v);
+	projectVerts(v);
+	Mesh_FrontFaces(&CubeMesh, sx, sy, front);
+	for(f = 0; f < 6; f++){
+		if(color == 0x0000){
+			colors[f] = 0x0000;
+		}
+		else{
+			const uint8_t *q = CubeFaces[f];
+			int8_t *p0 = v[q[0]], *p1 = v[q[1]], *p2 = v[q[2]];
+			int16_t ux = p1[0]-p0[0], uy = p1[1]-p0[1], uz = p1[2]-p0[2];
+			int16_t wx = p2[0]-p0[0], wy = p2[1]-p0[1], wz = p2[2]-p0[2];
+			colors[f] = Raster_Shade(uy*wz - uz*wy, uz*wx - ux*wz, ux*wy - uy*wx, 31);
+		}
+	}
+	// Culled back faces leave only the silhouette to fill or erase
+	Mesh_DrawSolid(&CubeMesh, sx, sy, front, colors);
+}
+void runSolid(void) {
+	int16_t i = 0;
+	int16_t last = -1;
+	int8_t lastx = 0, x = 2, dx = 2;
+	int8_t lasty = 0, y = 2, dy = 2;
+	uint16_t steps;
+
+		while(1) {
+			makeSolid(last, lastx, lasty, 0x0000);
+			makeSolid(i, x, y, 0xFFFF);
+			steps = Frame_Wait();
+			last = i;
+			lastx = x;
+			lasty = y;
+			// Turn and move as far as the frames that went by
+			i = TRIG_WRAP(i + SPIN*steps);
+			bounce(&x, &dx, -25, 25, steps);
+			bounce(&y, &dy, -37, 17, steps);
+		}
+}
+#elif ZScene == 1
+// Queue the front faces of one cube for the depth buffered band renderer
+// and widen [*ymin, *ymax] to the rows it covers
+void addCube(int16_t i, int8_t x, int8_t y, int8_t z, uint16_t tint, int16_t *ymin, int16_t *ymax){
+	int8_t v[8][3];
+	int16_t xs[4], ys[4];
+	uint16_t ds[4];
+	uint32_t front[MESH_MASKWORDS];
+	uint8_t f, k;
+
+	cubeVerts(i, x, y, v);
+	for(k = 0; k < 8; k++){
+		v[k][2] += z;
+	}
+	projectVerts(v);
+	Mesh_FrontFaces(&CubeMesh, sx, sy, front);
+	for(f = 0; f < 6; f++){
+		const uint8_t *q = CubeFaces[f];
+		int8_t *p0 = v[q[0]], *p1 = v[q[1]], *p2 = v[q[2]];
+		int16_t ux = p1[0]-p0[0], uy = p1[1]-p0[1], uz = p1[2]-p0[2];
+		int16_t wx = p2[0]-p0[0], wy = p2[1]-p0[1], wz = p2[2]-p0[2];
+		if(!MESH_ISFRONT(front, f))
+			continue;
+		for(k = 0; k < 4; k++){
+			xs[k] = sx[q[k]];
+			ys[k] = sy[q[k]];
+			ds[k] = Band_Depth(v[q[k]][2]);
+			if(ys[k] < *ymin) *ymin = ys[k];
+			if(ys[k] > *ymax) *ymax = ys[k];
+		}
+		Band_AddFace(xs, ys, ds, 4, Raster_Shade(uy*wz - uz*wy, uz*wx - ux*wz, ux*wy - uy*wx, 31) & tint);
+	}
+}
+// Cubes at different depths swing across each other
+void runZScene(void) {
+	const static uint16_t tints[NUMCUBES] = {ST7735_WHITE, ST7735_CYAN, ST7735_YELLOW};
+	int16_t ymin, ymax;
+	int16_t lastmin = 0x7FFF, lastmax = -0x7FFF;
+	int16_t i = 0, j;
+	int8_t k;
+
+		while(1) {
+			ymin = 0x7FFF;
+			ymax = -0x7FFF;
+			Band_ClearFaces();
+			for(k = 0; k < NUMCUBES; k++){
+				// Each cube runs 7/20 of a turn ahead of the one before
+				j = TRIG_WRAP(i + k*(7*TRIG_STEPS/20));
+				addCube(j, 3*wave[j], 10 - 12*k, 3*k, tints[k], &ymin, &ymax);
 			}
-			last = 19;
+			// Redraw the rows of both frames so the old image is erased
+			Band_Render(ymin < lastmin ? ymin : lastmin, ymax > lastmax ? ymax : lastmax, 0x0000);
+			lastmin = ymin;
+			lastmax = ymax;
+			i = TRIG_WRAP(i + SPIN*Frame_Wait());
+		}
+}
+#elif LodSphere == 1
+// Three resolutions of the same sphere, switched by projected radius
+int8_t SphereV0[MESH_SPHEREVERTS(6,8)][3], SphereV1[MESH_SPHEREVERTS(4,6)][3], SphereV2[MESH_SPHEREVERTS(2,4)][3];
+uint8_t SphereF0[MESH_SPHEREFACES(6,8)][4], SphereF1[MESH_SPHEREFACES(4,6)][4], SphereF2[MESH_SPHEREFACES(2,4)][4];
+MeshEdge SphereE0[MESH_SPHEREEDGES(6,8)], SphereE1[MESH_SPHEREEDGES(4,6)], SphereE2[MESH_SPHEREEDGES(2,4)];
+Mesh Sphere0, Sphere1, Sphere2;
+const MeshLOD SphereLOD = {3, {&Sphere0, &Sphere1, &Sphere2}, {24, 10, 0}};
+int16_t sx[MESH_SPHEREVERTS(6,8)], sy[MESH_SPHEREVERTS(6,8)];
+
+void makeLodSphere(int16_t x, int16_t y, int16_t z, uint16_t color){
+	// Lower quality levels pick the mesh as if the sphere were smaller
+	int16_t r = Camera_Scale(&View, SPHERER, z)*(Quality_Level + 1)/LEVELS;
+	const Mesh *m = SphereLOD.levels[Mesh_SelectLOD(&SphereLOD, r)];
+	uint32_t front[MESH_MASKWORDS];
+	uint8_t k;
+
+	for(k = 0; k < m->numVerts; k++){
+		Camera_Project(&View, x + m->verts[k][0], y + m->verts[k][1], z + m->verts[k][2], &sx[k], &sy[k]);
+	}
+	Mesh_FrontFaces(m, sx, sy, front);
+	Mesh_DrawWire(m, sx, sy, front, color, MESH_FRONTEDGES);
+}
+// Fly the sphere out to the distance and back
+void runLodSphere(void) {
+	int16_t z = 30, dz = 2;
+	int16_t i = 0;
+	uint16_t steps;
+
+	Mesh_MakeSphere(&Sphere0, SphereV0, SphereF0, SphereE0, 6, 8, SPHERER);
+	Mesh_MakeSphere(&Sphere1, SphereV1, SphereF1, SphereE1, 4, 6, SPHERER);
+	Mesh_MakeSphere(&Sphere2, SphereV2, SphereF2, SphereE2, 2, 4, SPHERER);
+	Quality_Init(FRAMEMS, LEVELS - 1);
+		while(1) {
+			makeLodSphere(wave[i]*4, 0, z, 0xFFFF);
+			steps = Frame_Wait();
+			makeLodSphere(wave[i]*4, 0, z, 0x0000);
+			Quality_Update(Frame_Busy);
+			i = TRIG_WRAP(i + SPIN*steps);
+			z += dz;
+			if(z + dz < 30 || z + dz > 150)
+				dz = -dz;
+		}
+}
+#elif Crowd == 1
+// Model space cube, corners in the same order as cubeVerts
+const static int8_t BoxVerts[8][3] = {{4,4,4},{4,4,-4},{-4,4,-4},{-4,4,4},
+                                      {4,-4,4},{4,-4,-4},{-4,-4,-4},{-4,-4,4}};
+const static Mesh BoxMesh = {8, 6, 12, CubeFaces, CubeEdges, BoxVerts};
+Scene World;
+
+// A crowd of bouncing cubes drawn through the scene manager
+void runCrowd(void) {
+	const static uint16_t colors[4] = {ST7735_WHITE, ST7735_CYAN, ST7735_YELLOW, ST7735_MAGENTA};
+	SceneObject *o;
+	int8_t dx[NUMCUBES], dy[NUMCUBES];
+	int16_t xmax, ymax;
+	uint16_t steps;
+	uint8_t k;
+
+	Scene_Init(&World, &View, 0x0000);
+	for(k = 0; k < NUMCUBES; k++){
+		// Spread the cubes around one turn of the wave
+		o = Scene_Add(&World, &BoxMesh, wave[k*SCENE_ANGLES/NUMCUBES]*3,
+		              wave[TRIG_WRAP(k*SCENE_ANGLES/NUMCUBES + TRIG_QUARTER)]*4, 30 + (k%4)*12,
+		              (k & 1) ? SCENE_SOLID : SCENE_WIRE, colors[k%4]);
+		o->angle = k*SCENE_ANGLES/NUMCUBES;
+		dx[k] = (k & 2) ? 1 : -1;
+		dy[k] = (k & 4) ? 2 : -2;
+	}
+		while(1) {
+			Camera_Begin(&View);
+			Scene_Render(&World);
+			steps = Frame_Wait();
+			for(k = 0; k < NUMCUBES; k++){
+				o = &World.objects[k];
+				o->angle = TRIG_WRAP(o->angle + SPIN*steps);
+				xmax = o->z*56/FZ;
+				ymax = o->z*72/FZ;
+				if(o->x + dx[k] < -xmax || o->x + dx[k] > xmax)
+					dx[k] = -dx[k];
+				if(o->y + dy[k] < -ymax || o->y + dy[k] > ymax)
+					dy[k] = -dy[k];
+				o->x += dx[k];
+				o->y += dy[k];
+			}
+		}
+}
+#elif Baked == 1
+// The Demo cube turning in place, played from the frames baked by
+// Host/BakeCube.c, so no projection or line drawing happens here
+void runBaked(void) {
+	uint16_t k = 0;
+		while(1) {
+			k = Anim_Play(&CubeAnim, k);
+			Frame_Wait();
+		}
+}
+#elif Logo == 1
+// The Solid cube turning in place, decoded from the byte stream written
+// by Host/BakeLogo.c with one address window per run
+void runLogo(void) {
+	const uint8_t *p = 0;
+		while(1) {
+			p = Anim_PlayClip(&LogoClip, p);
+			Frame_Wait();
+		}
+}
+#elif XformBench == 1
+// Bus cycles for Xform_Batch (SMUAD/SMLAD when built for the M4) and the
+// portable Xform_BatchC at 8, 64 and 512 vertices. Read them in the debugger.
+uint32_t XformCycles[2][3];
+int16_t BenchX[BENCHMAX], BenchY[BENCHMAX], BenchZ[BENCHMAX];
+int16_t BenchOX[BENCHMAX], BenchOY[BENCHMAX], BenchOZ[BENCHMAX];
+
+void runXformBench(void) {
+	const static uint16_t sizes[3] = {8, 64, 512};
+	Xform xf;
+	uint32_t start;
+	uint16_t k;
+	uint8_t s;
+
+	for(k = 0; k < BENCHMAX; k++){
+		BenchX[k] = wave[k & TRIG_MASK]*100;
+		BenchY[k] = k;
+		BenchZ[k] = zwave[k & TRIG_MASK]*100;
+	}
+	Xform_Yaw(&xf, 37, 10, 20, 30);
+	// Free running SysTick without interrupts counts down at the bus clock
+	NVIC_ST_CTRL_R = 0;
+	NVIC_ST_RELOAD_R = 0x00FFFFFF;
+	NVIC_ST_CURRENT_R = 0;
+	NVIC_ST_CTRL_R = 0x05;
+	for(s = 0; s < 3; s++){
+		start = NVIC_ST_CURRENT_R;
+		Xform_Batch(&xf, BenchX, BenchY, BenchZ, BenchOX, BenchOY, BenchOZ, sizes[s]);
+		XformCycles[0][s] = (start - NVIC_ST_CURRENT_R) & 0x00FFFFFF;
+		start = NVIC_ST_CURRENT_R;
+		Xform_BatchC(&xf, BenchX, BenchY, BenchZ, BenchOX, BenchOY, BenchOZ, sizes[s]);
+		XformCycles[1][s] = (start - NVIC_ST_CURRENT_R) & 0x00FFFFFF;
+	}
+		while(1) {
+		}
+}
+#elif FloatBench == 1
+// Bus cycles for BENCHMAX points through each stage, integer then float,
+// and how many of the float results differ from the integer ones.
+// Stage 0 is Camera_Project against Camera_ProjectFloat, stage 1 is
+// Xform_BatchC against Xform_BatchFloat. Read them in the debugger.
+uint32_t FloatCycles[2][2];
+uint16_t FloatDiffer[2];
+int16_t BenchX[BENCHMAX], BenchY[BENCHMAX], BenchZ[BENCHMAX];
+int16_t BenchOX[2][BENCHMAX], BenchOY[2][BENCHMAX], BenchOZ[2][BENCHMAX];
+
+void runFloatBench(void) {
+	Xform xf;
+	uint32_t start;
+	uint16_t k;
+
+	for(k = 0; k < BENCHMAX; k++){
+		BenchX[k] = wave[k & TRIG_MASK];
+		BenchY[k] = (k & 0xFF) - 128;
+		BenchZ[k] = 16 + zwave[k & TRIG_MASK]*20;
+	}
+	View.yaw = 8;
+	Camera_Begin(&View);
+	Xform_Yaw(&xf, 37, 10, 20, 30);
+	// Free running SysTick without interrupts counts down at the bus clock
+	NVIC_ST_CTRL_R = 0;
+	NVIC_ST_RELOAD_R = 0x00FFFFFF;
+	NVIC_ST_CURRENT_R = 0;
+	NVIC_ST_CTRL_R = 0x05;
+	start = NVIC_ST_CURRENT_R;
+	for(k = 0; k < BENCHMAX; k++){
+		BenchOZ[0][k] = Camera_Project(&View, BenchX[k], BenchY[k], BenchZ[k], &BenchOX[0][k], &BenchOY[0][k]);
+	}
+	FloatCycles[0][0] = (start - NVIC_ST_CURRENT_R) & 0x00FFFFFF;
+	start = NVIC_ST_CURRENT_R;
+	for(k = 0; k < BENCHMAX; k++){
+		BenchOZ[1][k] = Camera_ProjectFloat(&View, BenchX[k], BenchY[k], BenchZ[k], &BenchOX[1][k], &BenchOY[1][k]);
+	}
+	FloatCycles[0][1] = (start - NVIC_ST_CURRENT_R) & 0x00FFFFFF;
+	for(k = 0; k < BENCHMAX; k++){
+		if(BenchOX[0][k] != BenchOX[1][k] || BenchOY[0][k] != BenchOY[1][k])
+			FloatDiffer[0]++;
+	}
+	start = NVIC_ST_CURRENT_R;
+	Xform_BatchC(&xf, BenchX, BenchY, BenchZ, BenchOX[0], BenchOY[0], BenchOZ[0], BENCHMAX);
+	FloatCycles[1][0] = (start - NVIC_ST_CURRENT_R) & 0x00FFFFFF;
+	start = NVIC_ST_CURRENT_R;
+	Xform_BatchFloat(&xf, BenchX, BenchY, BenchZ, BenchOX[1], BenchOY[1], BenchOZ[1], BENCHMAX);
+	FloatCycles[1][1] = (start - NVIC_ST_CURRENT_R) & 0x00FFFFFF;
+	for(k = 0; k < BENCHMAX; k++){
+		if(BenchOX[0][k] != BenchOX[1][k] || BenchOY[0][k] != BenchOY[1][k] || BenchOZ[0][k] != BenchOZ[1][k])
+			FloatDiffer[1]++;
+	}
+		while(1) {
 		}
 }
 #endif
 int main(void){
   PLL_Init(Bus80MHz);                  // set system clock to 80 MHz
+	Fpu_Init();                          // float stages and lazy stacking
   ST7735_InitR(INITR_REDTAB);
+	Frame_Init(80000000, FRAMEMS);       // frames start every FRAMEMS ms
 	//Wait here then run demo
 	#if Sphere == 1
+		Camera_Init(&View, -5, -20, 0, FZS, 64, 80);
 		runSphere();
 	#elif Cube == 1
+		Camera_Init(&View, 0, -10, 0, FZ, 64, 80);
 		runCube();
 	#elif Demo == 1
+		Camera_Init(&View, 0, -10, 0, FZ, 64, 80);
 		runCube();
+	#elif Solid == 1
+		Camera_Init(&View, 0, -10, 0, FZ, 64, 80);
+		runSolid();
+	#elif ZScene == 1
+		Camera_Init(&View, 0, -10, 0, FZ, 64, 80);
+		runZScene();
+	#elif LodSphere == 1
+		Camera_Init(&View, 0, 0, 0, FZ, 64, 80);
+		runLodSphere();
+	#elif Crowd == 1
+		Camera_Init(&View, 0, 0, 0, FZ, 64, 80);
+		runCrowd();
+	#elif Baked == 1
+		runBaked();
+	#elif Logo == 1
+		runLogo();
+	#elif XformBench == 1
+		runXformBench();
+	#elif FloatBench == 1
+		Camera_Init(&View, 0, -10, -20, FZ, 64, 80);
+		runFloatBench();
 	#endif
 }
 
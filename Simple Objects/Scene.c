@@ -0,0 +1,226 @@
+// Scene.c
+// Runs on TM4C123
+// Multi-object scene with batched per-frame rendering.
+
+#include <stdint.h>
+#include "ST7735.h"
+#include "Raster.h"
+#include "Mesh.h"
+#include "Band.h"
+#include "Camera.h"
+#include "Xform.h"
+#include "Scene.h"
+
+// Projected vertices of every object this frame
+static int16_t PoolX[SCENE_MAXVERTS], PoolY[SCENE_MAXVERTS];
+// One object's vertices in model then world space, as the batched
+// transform wants them
+static int16_t ModelX[SCENE_MESHVERTS], ModelY[SCENE_MESHVERTS], ModelZ[SCENE_MESHVERTS];
+static int16_t WorldX[SCENE_MESHVERTS], WorldY[SCENE_MESHVERTS], WorldZ[SCENE_MESHVERTS];
+
+static ScenePrim Prims[SCENE_MAXPRIMS];
+static uint16_t NumPrims;
+// Primitives binned by band, each bin in far to near order. A primitive
+// crossing several bands sits in each of their bins.
+static uint16_t Bins[SCENE_MAXBINNED];
+static uint16_t NumBinned;
+// Columns touched this frame, per band
+static int16_t CurL[BAND_COUNT], CurR[BAND_COUNT];
+
+void Scene_Init(Scene *s, const Camera *cam, uint16_t bg){
+	uint8_t b;
+	s->count = 0;
+	s->cam = cam;
+	s->bg = bg;
+	for(b = 0; b < BAND_COUNT; b++){
+		s->lastL[b] = 0x7FFF;
+		s->lastR[b] = -0x7FFF;
+	}
+}
+
+SceneObject *Scene_Add(Scene *s, const Mesh *m, int16_t x, int16_t y, int16_t z,
+                       uint8_t style, uint16_t color){
+	SceneObject *o;
+	if(s->count >= SCENE_MAXOBJECTS || m->numVerts > SCENE_MESHVERTS)
+		return 0;
+	o = &s->objects[s->count++];
+	o->mesh = m;
+	o->x = x; o->y = y; o->z = z;
+	o->angle = 0;
+	o->style = style;
+	o->color = color;
+	return o;
+}
+
+// Rotate, translate and project one object's vertices into the pool
+static void transform(const Scene *s, const SceneObject *o, uint16_t base){
+	const Mesh *m = o->mesh;
+	Xform xf;
+	uint8_t k;
+	for(k = 0; k < m->numVerts; k++){
+		ModelX[k] = m->verts[k][0];
+		ModelY[k] = m->verts[k][1];
+		ModelZ[k] = m->verts[k][2];
+	}
+	Xform_Yaw(&xf, o->angle, o->x, o->y, o->z);
+	Xform_Batch(&xf, ModelX, ModelY, ModelZ, WorldX, WorldY, WorldZ, m->numVerts);
+	for(k = 0; k < m->numVerts; k++){
+		Camera_Project(s->cam, WorldX[k], WorldY[k], WorldZ[k], &PoolX[base + k], &PoolY[base + k]);
+	}
+}
+
+// Queue a primitive and mark the columns it touches in each of its bands
+static void addPrim(const uint16_t *v, uint8_t n, uint16_t color){
+	ScenePrim *p;
+	int16_t ymin = 0x7FFF, ymax = -0x7FFF, xmin = 0x7FFF, xmax = -0x7FFF;
+	uint8_t i, b;
+	if(NumPrims >= SCENE_MAXPRIMS)
+		return;
+	for(i = 0; i < n; i++){
+		int16_t x = PoolX[v[i]], y = PoolY[v[i]];
+		if(y < ymin) ymin = y;
+		if(y > ymax) ymax = y;
+		if(x < xmin) xmin = x;
+		if(x > xmax) xmax = x;
+	}
+	if(ymax < 0 || ymin >= ST7735_TFTHEIGHT || xmax < 0 || xmin >= ST7735_TFTWIDTH)
+		return;
+	if(ymin < 0) ymin = 0;
+	if(ymax >= ST7735_TFTHEIGHT) ymax = ST7735_TFTHEIGHT - 1;
+	if(NumBinned + ymax/BAND_ROWS - ymin/BAND_ROWS + 1 > SCENE_MAXBINNED)
+		return;
+	p = &Prims[NumPrims++];
+	for(i = 0; i < n; i++){
+		p->v[i] = v[i];
+	}
+	p->n = n;
+	p->color = color;
+	p->band0 = ymin / BAND_ROWS;
+	p->band1 = ymax / BAND_ROWS;
+	NumBinned += p->band1 - p->band0 + 1;
+	for(b = p->band0; b <= p->band1; b++){
+		if(xmin < CurL[b]) CurL[b] = xmin;
+		if(xmax > CurR[b]) CurR[b] = xmax;
+	}
+}
+
+// Flat shade a face from its model space normal turned to the object's angle
+static uint16_t faceColor(const SceneObject *o, const uint8_t *q){
+	const int8_t *p0 = o->mesh->verts[q[0]], *p1 = o->mesh->verts[q[1]], *p2 = o->mesh->verts[q[2]];
+	int16_t ux = p1[0]-p0[0], uy = p1[1]-p0[1], uz = p1[2]-p0[2];
+	int16_t wx = p2[0]-p0[0], wy = p2[1]-p0[1], wz = p2[2]-p0[2];
+	int32_t nx = uy*wz - uz*wy, ny = uz*wx - ux*wz, nz = ux*wy - uy*wx;
+	int16_t sn = TRIG_SIN(o->angle);
+	int16_t cs = TRIG_COS(o->angle);
+	return Raster_Shade((nx*cs - nz*sn) >> 7, ny, (nx*sn + nz*cs) >> 7, 31) & o->color;
+}
+
+// Collect the visible edges or faces of an object
+static void collect(const SceneObject *o, uint16_t base){
+	const Mesh *m = o->mesh;
+	uint32_t front[MESH_MASKWORDS];
+	uint16_t v[4];
+	uint8_t f, e, i;
+
+	Mesh_FrontFaces(m, &PoolX[base], &PoolY[base], front);
+	if(o->style == SCENE_SOLID){
+		for(f = 0; f < m->numFaces; f++){
+			const uint8_t *q = m->faces[f];
+			if(!MESH_ISFRONT(front, f))
+				continue;
+			for(i = 0; i < 4; i++){
+				v[i] = base + q[i];
+			}
+			addPrim(v, (q[3] == q[2]) ? 3 : 4, faceColor(o, q));
+		}
+	}
+	else{
+		for(e = 0; e < m->numEdges; e++){
+			const MeshEdge *edge = &m->edges[e];
+			if(!MESH_ISFRONT(front, edge->f0) && !MESH_ISFRONT(front, edge->f1))
+				continue;
+			v[0] = base + edge->a;
+			v[1] = base + edge->b;
+			addPrim(v, 2, o->color);
+		}
+	}
+}
+
+static void drawPrim(const ScenePrim *p){
+	int16_t xs[4], ys[4];
+	uint8_t i;
+	if(p->n == 2){
+		Raster_Line(PoolX[p->v[0]], PoolY[p->v[0]], PoolX[p->v[1]], PoolY[p->v[1]], p->color);
+		return;
+	}
+	for(i = 0; i < p->n; i++){
+		xs[i] = PoolX[p->v[i]];
+		ys[i] = PoolY[p->v[i]];
+	}
+	Raster_FillConvex(xs, ys, p->n, p->color);
+}
+
+void Scene_Render(Scene *s){
+	uint8_t byDepth[SCENE_MAXOBJECTS];
+	uint16_t start[BAND_COUNT + 1];
+	uint16_t base = 0, i;
+	uint8_t b, k, j;
+
+	NumPrims = 0;
+	NumBinned = 0;
+	for(b = 0; b < BAND_COUNT; b++){
+		CurL[b] = 0x7FFF;
+		CurR[b] = -0x7FFF;
+	}
+
+	// Far objects first so solid faces overdraw correctly
+	for(k = 0; k < s->count; k++){
+		for(j = k; j > 0 && s->objects[byDepth[j-1]].z < s->objects[k].z; j--)
+			byDepth[j] = byDepth[j-1];
+		byDepth[j] = k;
+	}
+
+	// One batched pass: transform, project and collect every object
+	for(k = 0; k < s->count; k++){
+		const SceneObject *o = &s->objects[byDepth[k]];
+		if(base + o->mesh->numVerts > SCENE_MAXVERTS)
+			break;
+		transform(s, o, base);
+		collect(o, base);
+		base += o->mesh->numVerts;
+	}
+
+	// Bin by band with a counting sort, stable so depth order survives
+	for(b = 0; b <= BAND_COUNT; b++){
+		start[b] = 0;
+	}
+	for(i = 0; i < NumPrims; i++){
+		for(b = Prims[i].band0; b <= Prims[i].band1; b++)
+			start[b + 1]++;
+	}
+	for(b = 1; b <= BAND_COUNT; b++){
+		start[b] += start[b-1];
+	}
+	for(i = 0; i < NumPrims; i++){
+		for(b = Prims[i].band0; b <= Prims[i].band1; b++)
+			Bins[start[b]++] = i;
+	}
+	// start[b] is now the end of bin b, and start[b-1] its beginning
+
+	// Submit in screen order, one address window per changed band
+	Raster_SetSpanOutput(Band_Span);
+	for(b = 0; b < BAND_COUNT; b++){
+		int16_t x0 = CurL[b] < s->lastL[b] ? CurL[b] : s->lastL[b];
+		int16_t x1 = CurR[b] > s->lastR[b] ? CurR[b] : s->lastR[b];
+		s->lastL[b] = CurL[b];
+		s->lastR[b] = CurR[b];
+		if(x0 > x1)
+			continue;	// nothing there this frame or last
+		Band_Begin(b*BAND_ROWS, s->bg);
+		for(i = (b == 0) ? 0 : start[b-1]; i < start[b]; i++){
+			drawPrim(&Prims[Bins[i]]);
+		}
+		Band_Flush(x0, x1);
+	}
+	Raster_SetSpanOutput(0);
+}
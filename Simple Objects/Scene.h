@@ -0,0 +1,82 @@
+// Scene.h
+// Runs on TM4C123
+// Multi-object scene with batched per-frame rendering.
+// Every object is transformed and projected in one pass into a shared
+// vertex pool, its visible edges or faces are collected as primitives and
+// binned by render band, and each band that changed is drawn off screen
+// and sent with a single address window. The panel sees a handful of
+// windows per frame no matter how many objects are in the scene.
+
+#ifndef _SCENEH_
+#define _SCENEH_
+
+#include <stdint.h>
+#include "Mesh.h"
+#include "Band.h"
+#include "Camera.h"
+
+#define SCENE_MAXOBJECTS 24
+#define SCENE_MAXVERTS   256
+#define SCENE_MESHVERTS  64     // largest mesh an object may use
+#define SCENE_MAXPRIMS   320
+#define SCENE_MAXBINNED  (2*SCENE_MAXPRIMS)
+
+// Steps in a full turn of SceneObject.angle
+#define SCENE_ANGLES     TRIG_STEPS
+
+// How an object is drawn
+#define SCENE_WIRE  0   // front edges only
+#define SCENE_SOLID 1   // front faces filled, drawn far to near
+
+typedef struct {
+	const Mesh *mesh;       // must carry model space verts
+	int16_t x, y, z;        // position, z away from the viewer
+	uint16_t angle;         // rotation about the vertical axis, wrapped to SCENE_ANGLES
+	uint8_t style;          // SCENE_WIRE or SCENE_SOLID
+	uint16_t color;
+} SceneObject;
+
+// A visible edge (n = 2) or face (n = 3 or 4), as indices into the pool
+typedef struct {
+	uint16_t v[4];
+	uint16_t color;
+	uint8_t n;
+	uint8_t band0, band1;   // first and last band the primitive touches
+} ScenePrim;
+
+typedef struct {
+	SceneObject objects[SCENE_MAXOBJECTS];
+	uint8_t count;
+	const Camera *cam;      // view to render through
+	uint16_t bg;            // background color
+	int16_t lastL[BAND_COUNT], lastR[BAND_COUNT];  // columns drawn last frame, per band
+} Scene;
+
+//------------Scene_Init------------
+// Empty a scene and choose the camera it is seen through.
+// Input: s    scene
+//        cam  camera, Camera_Begin is called on it once per frame by the caller
+//        bg   16-bit background color
+// Output: none
+void Scene_Init(Scene *s, const Camera *cam, uint16_t bg);
+
+//------------Scene_Add------------
+// Add an object to a scene.
+// Input: s        scene
+//        m        mesh with model space vertices
+//        x, y, z  position
+//        style    SCENE_WIRE or SCENE_SOLID
+//        color    16-bit color
+// Output: the new object to animate, or 0 if the scene is full or the
+//         mesh has more than SCENE_MESHVERTS vertices
+SceneObject *Scene_Add(Scene *s, const Mesh *m, int16_t x, int16_t y, int16_t z,
+                       uint8_t style, uint16_t color);
+
+//------------Scene_Render------------
+// Draw one frame of the scene. Bands drawn last frame are redrawn as well,
+// which erases objects that moved away.
+// Input: s  scene
+// Output: none
+void Scene_Render(Scene *s);
+
+#endif
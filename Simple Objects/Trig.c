@@ -0,0 +1,9 @@
+// Trig.c
+// Runs on TM4C123
+// Compile time sine table, see Trig.h.
+
+#include <stdint.h>
+#include "Trig.h"
+
+#define TRIG_Q7(i) TRIG_MAKESIN(i, 127)
+const int8_t TrigSin[TRIG_STEPS] = {TRIG_TABLE(TRIG_Q7)};
@@ -0,0 +1,78 @@
+// Trig.h
+// Runs on TM4C123
+// Sine and cosine tables built by the compiler at a power of two
+// resolution. A full turn is TRIG_STEPS angle steps, so wrapping an angle
+// is a bitwise and instead of a modulus. The entries come from Bhaskara
+// I's rational approximation evaluated as constant expressions, so
+// changing TRIG_BITS regenerates every table with no script to rerun.
+
+#ifndef _TRIGH_
+#define _TRIGH_
+
+#include <stdint.h>
+
+// A full turn is 2^TRIG_BITS steps, 4 to 10
+#ifndef TRIG_BITS
+#define TRIG_BITS    8
+#endif
+#if TRIG_BITS < 4 || TRIG_BITS > 10
+#error "TRIG_BITS must be 4 to 10"
+#endif
+
+#define TRIG_STEPS   (1 << TRIG_BITS)
+#define TRIG_MASK    (TRIG_STEPS - 1)
+#define TRIG_HALF    (TRIG_STEPS/2)
+#define TRIG_QUARTER (TRIG_STEPS/4)
+
+// Wrap any angle, including negative ones, into 0 to TRIG_STEPS-1
+#define TRIG_WRAP(a) ((a) & TRIG_MASK)
+
+// sin(pi*n/d)*amp rounded, for 0 <= n <= d, with Bhaskara's
+// 16n(d-n)/(5d^2-4n(d-n)). Constant expression, for building tables.
+#define TRIG_BHASKARA(n, d, amp) \
+	((32*(amp)*(n)*((d)-(n)) + 5*(d)*(d) - 4*(n)*((d)-(n))) / \
+	 (2*(5*(d)*(d) - 4*(n)*((d)-(n)))))
+
+// sin of angle step a scaled by amp, as a constant expression
+#define TRIG_MAKESIN(a, amp) (TRIG_WRAP(a) < TRIG_HALF ? \
+	TRIG_BHASKARA(TRIG_WRAP(a), TRIG_HALF, amp) : \
+	-TRIG_BHASKARA(TRIG_WRAP(a) - TRIG_HALF, TRIG_HALF, amp))
+#define TRIG_MAKECOS(a, amp) TRIG_MAKESIN((a) + TRIG_QUARTER, amp)
+
+// Expand f(0), f(1), ... f(TRIG_STEPS-1) as an initializer list, where f
+// is a one argument macro such as one built on TRIG_MAKESIN
+#define TRIG_T1(f, i)    f(i)
+#define TRIG_T2(f, i)    TRIG_T1(f, i), TRIG_T1(f, (i)+1)
+#define TRIG_T4(f, i)    TRIG_T2(f, i), TRIG_T2(f, (i)+2)
+#define TRIG_T8(f, i)    TRIG_T4(f, i), TRIG_T4(f, (i)+4)
+#define TRIG_T16(f, i)   TRIG_T8(f, i), TRIG_T8(f, (i)+8)
+#define TRIG_T32(f, i)   TRIG_T16(f, i), TRIG_T16(f, (i)+16)
+#define TRIG_T64(f, i)   TRIG_T32(f, i), TRIG_T32(f, (i)+32)
+#define TRIG_T128(f, i)  TRIG_T64(f, i), TRIG_T64(f, (i)+64)
+#define TRIG_T256(f, i)  TRIG_T128(f, i), TRIG_T128(f, (i)+128)
+#define TRIG_T512(f, i)  TRIG_T256(f, i), TRIG_T256(f, (i)+256)
+#define TRIG_T1024(f, i) TRIG_T512(f, i), TRIG_T512(f, (i)+512)
+#if TRIG_BITS == 4
+#define TRIG_TABLE(f) TRIG_T16(f, 0)
+#elif TRIG_BITS == 5
+#define TRIG_TABLE(f) TRIG_T32(f, 0)
+#elif TRIG_BITS == 6
+#define TRIG_TABLE(f) TRIG_T64(f, 0)
+#elif TRIG_BITS == 7
+#define TRIG_TABLE(f) TRIG_T128(f, 0)
+#elif TRIG_BITS == 8
+#define TRIG_TABLE(f) TRIG_T256(f, 0)
+#elif TRIG_BITS == 9
+#define TRIG_TABLE(f) TRIG_T512(f, 0)
+#else
+#define TRIG_TABLE(f) TRIG_T1024(f, 0)
+#endif
+
+// sin of each angle step scaled by 127
+extern const int8_t TrigSin[TRIG_STEPS];
+
+// Table lookups, any integer angle is wrapped
+#define TRIG_SIN(a) TrigSin[TRIG_WRAP(a)]
+#define TRIG_COS(a) TrigSin[TRIG_WRAP((a) + TRIG_QUARTER)]
+
+#endif
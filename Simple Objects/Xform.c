@@ -0,0 +1,120 @@
+// Xform.c
+// Runs on TM4C123
+// Batched vertex transform, see Xform.h.
+
+#include <stdint.h>
+#include <string.h>
+#include "Trig.h"
+#include "Xform.h"
+
+// The dual multiplies come from the ACLE intrinsics, built into ARMCC 5
+// and declared in arm_acle.h for GCC and Clang
+#if !XFORM_FLOAT
+#if defined(__CC_ARM) && defined(__TARGET_FEATURE_DSPMUL)
+#define XFORM_DSP 1
+#elif defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#define XFORM_DSP 1
+#endif
+#endif
+
+void Xform_Yaw(Xform *xf, uint16_t angle, int16_t tx, int16_t ty, int16_t tz){
+	// Q7 table to Q14, multiplied since the values may be negative
+	int16_t sn = TRIG_SIN(angle) * (1 << (XFORM_Q - 7));
+	int16_t cs = TRIG_COS(angle) * (1 << (XFORM_Q - 7));
+	xf->m[0][0] = cs; xf->m[0][1] = 0;      xf->m[0][2] = -sn;
+	xf->m[1][0] = 0;  xf->m[1][1] = XFORM_ONE; xf->m[1][2] = 0;
+	xf->m[2][0] = sn; xf->m[2][1] = 0;      xf->m[2][2] = cs;
+	xf->t[0] = tx;
+	xf->t[1] = ty;
+	xf->t[2] = tz;
+}
+
+void Xform_BatchC(const Xform *xf, const int16_t *x, const int16_t *y, const int16_t *z,
+                  int16_t *ox, int16_t *oy, int16_t *oz, uint16_t n){
+	const int16_t (*m)[3] = xf->m;
+	uint16_t i;
+	for(i = 0; i < n; i++){
+		int32_t vx = x[i], vy = y[i], vz = z[i];
+		ox[i] = ((m[0][0]*vx + m[0][1]*vy + m[0][2]*vz) >> XFORM_Q) + xf->t[0];
+		oy[i] = ((m[1][0]*vx + m[1][1]*vy + m[1][2]*vz) >> XFORM_Q) + xf->t[1];
+		oz[i] = ((m[2][0]*vx + m[2][1]*vy + m[2][2]*vz) >> XFORM_Q) + xf->t[2];
+	}
+}
+
+// Nearest integer without the math library
+static int16_t roundNear(float f){
+	return (int16_t)(f >= 0 ? f + 0.5f : f - 0.5f);
+}
+
+void Xform_BatchFloat(const Xform *xf, const int16_t *x, const int16_t *y, const int16_t *z,
+                      int16_t *ox, int16_t *oy, int16_t *oz, uint16_t n){
+	float m[3][3];
+	uint16_t i, j, k;
+	for(j = 0; j < 3; j++){
+		for(k = 0; k < 3; k++){
+			m[j][k] = xf->m[j][k]*(1.0f/XFORM_ONE);
+		}
+	}
+	for(i = 0; i < n; i++){
+		float vx = x[i], vy = y[i], vz = z[i];
+		ox[i] = roundNear(m[0][0]*vx + m[0][1]*vy + m[0][2]*vz) + xf->t[0];
+		oy[i] = roundNear(m[1][0]*vx + m[1][1]*vy + m[1][2]*vz) + xf->t[1];
+		oz[i] = roundNear(m[2][0]*vx + m[2][1]*vy + m[2][2]*vz) + xf->t[2];
+	}
+}
+
+#if XFORM_FLOAT
+void Xform_Batch(const Xform *xf, const int16_t *x, const int16_t *y, const int16_t *z,
+                 int16_t *ox, int16_t *oy, int16_t *oz, uint16_t n){
+	Xform_BatchFloat(xf, x, y, z, ox, oy, oz, n);
+}
+#elif defined(XFORM_DSP)
+// Sum of the products of the low halves and of the high halves
+#define smuad(a, b) __smuad(a, b)
+// The same added to acc
+#define smlad(a, b, acc) __smlad(a, b, acc)
+// Two neighbouring int16_t as one word, low half first, unaligned is fine
+static inline uint32_t load2(const int16_t *p){
+	uint32_t w;
+	memcpy(&w, p, 4);
+	return w;
+}
+static inline void store2(int16_t *p, int32_t lo, int32_t hi){
+	uint32_t w = (lo & 0xFFFF) | ((uint32_t)hi << 16);
+	memcpy(p, &w, 4);
+}
+
+void Xform_Batch(const Xform *xf, const int16_t *x, const int16_t *y, const int16_t *z,
+                 int16_t *ox, int16_t *oy, int16_t *oz, uint16_t n){
+	// Matrix rows packed for the dual multiplies: (m0, m1) pairs with a
+	// vertex's (x, y), and m2 sits in the half of the z word it belongs to
+	uint32_t r0 = (uint16_t)xf->m[0][0] | ((uint32_t)xf->m[0][1] << 16);
+	uint32_t r1 = (uint16_t)xf->m[1][0] | ((uint32_t)xf->m[1][1] << 16);
+	uint32_t r2 = (uint16_t)xf->m[2][0] | ((uint32_t)xf->m[2][1] << 16);
+	uint32_t z0lo = (uint16_t)xf->m[0][2], z0hi = z0lo << 16;
+	uint32_t z1lo = (uint16_t)xf->m[1][2], z1hi = z1lo << 16;
+	uint32_t z2lo = (uint16_t)xf->m[2][2], z2hi = z2lo << 16;
+	int16_t tx = xf->t[0], ty = xf->t[1], tz = xf->t[2];
+	uint16_t i;
+
+	for(i = 0; i + 1 < n; i += 2){
+		uint32_t X = load2(&x[i]), Y = load2(&y[i]), Z = load2(&z[i]);
+		uint32_t a = (X & 0xFFFF) | (Y << 16);          // x[i], y[i]
+		uint32_t b = (X >> 16) | (Y & 0xFFFF0000);      // x[i+1], y[i+1]
+		store2(&ox[i], (smlad(Z, z0lo, smuad(a, r0)) >> XFORM_Q) + tx,
+		               (smlad(Z, z0hi, smuad(b, r0)) >> XFORM_Q) + tx);
+		store2(&oy[i], (smlad(Z, z1lo, smuad(a, r1)) >> XFORM_Q) + ty,
+		               (smlad(Z, z1hi, smuad(b, r1)) >> XFORM_Q) + ty);
+		store2(&oz[i], (smlad(Z, z2lo, smuad(a, r2)) >> XFORM_Q) + tz,
+		               (smlad(Z, z2hi, smuad(b, r2)) >> XFORM_Q) + tz);
+	}
+	if(i < n)
+		Xform_BatchC(xf, &x[i], &y[i], &z[i], &ox[i], &oy[i], &oz[i], 1);
+}
+#else
+void Xform_Batch(const Xform *xf, const int16_t *x, const int16_t *y, const int16_t *z,
+                 int16_t *ox, int16_t *oy, int16_t *oz, uint16_t n){
+	Xform_BatchC(xf, x, y, z, ox, oy, oz, n);
+}
+#endif
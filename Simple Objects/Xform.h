@@ -0,0 +1,65 @@
+// Xform.h
+// Runs on TM4C123
+// Batched vertex transform. Vertices are kept as structure of arrays,
+// one int16_t array per axis, and every vertex in a batch goes through
+// the same fixed point rotation and a translation. On a Cortex-M4 the kernel
+// reads two vertices per word and uses the dual 16-bit multiply
+// accumulate instructions SMUAD and SMLAD, so each instruction does two
+// of the multiplies. Other targets, such as the host build, use the
+// portable C loop.
+
+#ifndef _XFORMH_
+#define _XFORMH_
+
+#include <stdint.h>
+
+// Fraction bits of the rotation entries. Q14 rather than Q15 so that 1.0
+// is exact and an axis the rotation leaves alone comes through unchanged.
+#define XFORM_Q 14
+#define XFORM_ONE (1 << XFORM_Q)
+
+// 1 runs Xform_Batch on the FPU, 0 in fixed point
+#ifndef XFORM_FLOAT
+#define XFORM_FLOAT 0
+#endif
+
+typedef struct {
+	int16_t m[3][3];        // rotation, Q14, row i gives output axis i
+	int16_t t[3];           // added after the rotation
+} Xform;
+
+//------------Xform_Yaw------------
+// Build a turn about the vertical axis followed by a move.
+// Input: xf          transform to fill
+//        angle       turn in TRIG_STEPS per turn
+//        tx, ty, tz  translation
+// Output: none
+void Xform_Yaw(Xform *xf, uint16_t angle, int16_t tx, int16_t ty, int16_t tz);
+
+//------------Xform_Batch------------
+// Transform n vertices, out = (m*v >> XFORM_Q) + t. Uses SMUAD and SMLAD
+// when the compiler targets the DSP extension, the C loop otherwise, or
+// Xform_BatchFloat when XFORM_FLOAT is 1.
+// Coordinates must lie within +/-16383 so the sums fit in 32 bits for
+// any rotation. The outputs may not overlap the inputs.
+// Input: xf          transform
+//        x, y, z     the n input vertices
+//        ox, oy, oz  receive the n transformed vertices
+//        n           number of vertices
+// Output: none
+void Xform_Batch(const Xform *xf, const int16_t *x, const int16_t *y, const int16_t *z,
+                 int16_t *ox, int16_t *oy, int16_t *oz, uint16_t n);
+
+//------------Xform_BatchC------------
+// Same as Xform_Batch, always with the portable C loop. Kept callable so
+// the two can be compared on the target.
+void Xform_BatchC(const Xform *xf, const int16_t *x, const int16_t *y, const int16_t *z,
+                  int16_t *ox, int16_t *oy, int16_t *oz, uint16_t n);
+
+//------------Xform_BatchFloat------------
+// Same as Xform_Batch in single precision float, rounding to nearest
+// instead of truncating the fraction.
+void Xform_BatchFloat(const Xform *xf, const int16_t *x, const int16_t *y, const int16_t *z,
+                      int16_t *ox, int16_t *oy, int16_t *oz, uint16_t n);
+
+#endif
@@ -0,0 +1,120 @@
+// Band.h
+// Runs on TM4C123
+// Off-screen render band with a 16-bit depth buffer.
+// The screen is drawn as a stack of BAND_ROWS tall bands. Each band is
+// cleared, every face that crosses it is rasterized with a per-pixel depth
+// test, and the finished band is streamed to the panel with one address
+// window. Color plus depth for a 16 row band is 8 KB, well under the
+// 32 KB of SRAM, where a full screen depth buffer alone would be 40 KB.
+
+#ifndef _BANDH_
+#define _BANDH_
+
+#include <stdint.h>
+#include "ST7735.h"
+
+#define BAND_ROWS     16
+#define BAND_W        128
+#define BAND_MAXFACES 32
+
+// Bands needed to cover the screen
+#define BAND_COUNT ((ST7735_TFTHEIGHT + BAND_ROWS - 1)/BAND_ROWS)
+
+// Depth stored in the buffer, larger is nearer, 0 is infinitely far
+#define BAND_DEPTHMAX 0x7FFF
+
+// A face queued for Band_Render. The plane holds depth as d = A*x + B*y + C
+// with 8 fractional bits.
+typedef struct {
+	int16_t xs[4], ys[4];
+	int32_t A, B, C;
+	int16_t ymin, ymax;
+	uint16_t color;
+	uint8_t n;
+} BandFace;
+
+//------------Band_Depth------------
+// Depth value of a point at distance z. Inverse depth is linear in
+// screen space, so it can be interpolated across a projected face.
+// Input: z  distance from the viewer, greater than 0
+// Output: depth for Band_AddFace, larger is nearer
+uint16_t Band_Depth(int16_t z);
+
+//------------Band_Begin------------
+// Start a band: clear its color to the background and its depth to far.
+// Input: top  first screen row of the band
+//        bg   16-bit background color
+// Output: none
+void Band_Begin(int16_t top, uint16_t bg);
+
+//------------Band_Span------------
+// Write a span into the current band without a depth test. Same shape as
+// ST7735_DrawFastHLine so it can be handed to Raster_SetSpanOutput.
+// Input: x, y  start of the span in screen coordinates
+//        w     width in pixels
+//        color 16-bit color
+// Output: none
+void Band_Span(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+//------------Band_LineAA------------
+// Draw an anti-aliased line into the current band with Xiaolin Wu's
+// algorithm. Each step along the line covers two pixels across it, and
+// the color is blended with what the band already holds there in
+// proportion to how much of each pixel the line covers. The panel can't
+// be read back, since MISO is unconnected, so lines can only be blended
+// over pixels drawn into the band. Parts outside the band are clipped,
+// so every band can be handed the whole list of lines.
+// Input: x0, y0  first end point in screen coordinates
+//        x1, y1  second end point
+//        color   16-bit color
+// Output: none
+void Band_LineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+//------------Band_SetHorizon------------
+// Keep Band_LineAA above a horizon: pixels below the row given for their
+// column are left alone. Used to hide lines behind nearer ones.
+// Input: top  lowest screen row still drawn in each of the BAND_W
+//             columns, or 0 to draw everywhere
+// Output: none
+void Band_SetHorizon(const uint8_t *top);
+
+//------------Band_Flush------------
+// Stream columns x0 to x1 of the current band to the panel.
+// Requires 11 + 2*(x1-x0+1)*BAND_ROWS bytes of transmission
+// Input: x0, x1  first and last column to send
+// Output: none
+void Band_Flush(int16_t x0, int16_t x1);
+
+//------------Band_ClearFaces------------
+// Empty the face list before queueing a new frame.
+// Input: none
+// Output: none
+void Band_ClearFaces(void);
+
+//------------Band_AddFace------------
+// Queue a flat, planar, convex face for depth tested rendering.
+// Input: xs, ys  projected vertices
+//        ds      Band_Depth of each vertex
+//        n       3 or 4 vertices
+//        color   16-bit color
+// Output: 1 if queued, 0 if the list is full or the face is edge on
+uint8_t Band_AddFace(const int16_t *xs, const int16_t *ys, const uint16_t *ds,
+                     uint8_t n, uint16_t color);
+
+//------------Band_FillFace------------
+// Rasterize the part of one face inside the current band, keeping only
+// pixels nearer than what the band already holds.
+// Input: f  face from Band_AddFace
+// Output: none
+void Band_FillFace(const BandFace *f);
+
+//------------Band_Render------------
+// Draw every queued face over screen rows ymin to ymax, one band at a
+// time. Rows in range that no face covers are cleared to bg, so passing
+// the previous frame's rows as well erases the old image.
+// Input: ymin, ymax  rows to redraw
+//        bg          16-bit background color
+// Output: none
+void Band_Render(int16_t ymin, int16_t ymax, uint16_t bg);
+
+#endif
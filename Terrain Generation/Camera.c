@@ -0,0 +1,94 @@
+// Camera.c
+// Runs on TM4C123
+// Pinhole camera shared by every renderer.
+
+#include <stdint.h>
+#include "Camera.h"
+
+void Camera_Init(Camera *c, int16_t x, int16_t y, int16_t z, int16_t focal,
+                 int16_t cx, int16_t cy){
+	c->x = x; c->y = y; c->z = z;
+	c->yaw = 0;
+	c->focal = focal;
+	c->cx = cx; c->cy = cy;
+	c->recipFocal = 0;
+	Camera_Begin(c);
+}
+
+void Camera_Begin(Camera *c){
+	int16_t z;
+	c->sinYaw = TRIG_SIN(c->yaw);
+	c->cosYaw = TRIG_COS(c->yaw);
+	if(c->recipFocal != c->focal){
+		// Rounded up, so that with the product truncated toward zero a
+		// length at its own depth scales to exactly focal and the rest
+		// nearly always match len*focal/z
+		c->recip[0] = (int32_t)c->focal << CAMERA_RECIPQ;
+		for(z = 1; z <= CAMERA_MAXZ; z++){
+			c->recip[z] = (((int32_t)c->focal << CAMERA_RECIPQ) + z - 1) / z;
+		}
+		c->recipFocal = c->focal;
+	}
+}
+
+void Camera_View(const Camera *c, int16_t x, int16_t y, int16_t z, int16_t *v){
+	x -= c->x;
+	y -= c->y;
+	z -= c->z;
+	// TrigSin is scaled by 127, dividing keeps lengths and rounds
+	// toward zero on both sides
+	if(c->yaw){
+		int16_t t = (x*c->cosYaw - z*c->sinYaw) / 127;
+		z = (x*c->sinYaw + z*c->cosYaw) / 127;
+		x = t;
+	}
+	v[0] = x;
+	v[1] = y;
+	v[2] = z;
+}
+
+int16_t Camera_Scale(const Camera *c, int16_t len, int16_t z){
+	int32_t p;
+	if(z > CAMERA_MAXZ)
+		return (int32_t)len*c->focal/z;
+	// Truncate toward zero like the divide, a shift would floor
+	p = (int32_t)len*c->recip[z];
+	return p >= 0 ? p >> CAMERA_RECIPQ : -(-p >> CAMERA_RECIPQ);
+}
+
+// Nearest integer without the math library
+static int16_t roundNear(float f){
+	return (int16_t)(f >= 0 ? f + 0.5f : f - 0.5f);
+}
+
+int16_t Camera_ProjectFloat(const Camera *c, int16_t x, int16_t y, int16_t z,
+                            int16_t *sx, int16_t *sy){
+	float vx = x - c->x, vy = y - c->y, vz = z - c->z, s;
+	if(c->yaw){
+		float sn = c->sinYaw*(1.0f/127), cs = c->cosYaw*(1.0f/127);
+		s = vx*cs - vz*sn;
+		vz = vx*sn + vz*cs;
+		vx = s;
+	}
+	if(vz < 1.0f)
+		vz = 1.0f;
+	s = c->focal/vz;
+	*sx = c->cx + roundNear(vx*s);
+	*sy = c->cy + roundNear(vy*s);
+	return roundNear(vz);
+}
+
+int16_t Camera_Project(const Camera *c, int16_t x, int16_t y, int16_t z,
+                       int16_t *sx, int16_t *sy){
+#if CAMERA_FLOAT
+	return Camera_ProjectFloat(c, x, y, z, sx, sy);
+#else
+	int16_t v[3];
+	Camera_View(c, x, y, z, v);
+	if(v[2] < 1)
+		v[2] = 1;
+	*sx = c->cx + Camera_Scale(c, v[0], v[2]);
+	*sy = c->cy + Camera_Scale(c, v[1], v[2]);
+	return v[2];
+#endif
+}
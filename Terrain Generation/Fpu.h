@@ -0,0 +1,19 @@
+// Fpu.h
+// Runs on TM4C123
+// Turns on the Cortex-M4F single precision floating point unit. The
+// float options CAMERA_FLOAT, XFORM_FLOAT and NOISE_FLOAT need it, and
+// it costs nothing to enable when they are off. Lazy stacking is set so
+// an interrupt only saves the FPU registers if its handler uses them,
+// which keeps SysTick_Handler as cheap as in an integer only build.
+
+#ifndef _FPUH_
+#define _FPUH_
+
+//------------Fpu_Init------------
+// Grant full access to coprocessors 10 and 11 and enable automatic,
+// lazy state preservation. Call before any float instruction runs.
+// Input: none
+// Output: none
+void Fpu_Init(void);
+
+#endif
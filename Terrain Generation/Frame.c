@@ -0,0 +1,71 @@
+// Frame.c
+// Runs on TM4C123
+// Fixed timestep frame scheduler on SysTick.
+
+#include <stdint.h>
+#include "Frame.h"
+#include "tm4c123gh6pm.h"
+
+void EnableInterrupts(void);  // Enable interrupts
+void WaitForInterrupt(void);  // low power mode
+
+volatile uint32_t Frame_Ticks;
+uint32_t Frame_Overruns;
+uint16_t Frame_Busy;
+
+static uint16_t Period;
+static uint32_t Start;        // tick the current frame started on
+static uint32_t Next;         // tick the next frame is due
+static uint8_t Done;         // Frame_Busy already taken by Frame_Done
+
+void Frame_Init(uint32_t busHz, uint16_t periodMs){
+	NVIC_ST_CTRL_R = 0;                   // disable SysTick during setup
+	NVIC_ST_RELOAD_R = busHz/1000 - 1;    // one interrupt a millisecond
+	NVIC_ST_CURRENT_R = 0;                // any write clears it
+	NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R&0x00FFFFFF)|0x40000000; // priority 2
+	Frame_Ticks = 0;
+	Frame_Overruns = 0;
+	Frame_Busy = 0;
+	Done = 0;
+	Period = periodMs;
+	Start = 0;
+	Next = periodMs;
+	NVIC_ST_CTRL_R = 0x07;                // enable with core clock and interrupts
+	EnableInterrupts();
+}
+
+void SysTick_Handler(void){
+	Frame_Ticks++;
+}
+
+void Frame_Done(void){
+	Frame_Busy = Frame_Ticks - Start;
+	Done = 1;
+}
+
+uint16_t Frame_Left(void){
+	int32_t left = Next - Frame_Ticks;
+	return left > 0 ? left : 0;
+}
+
+uint16_t Frame_Wait(void){
+	uint32_t now = Frame_Ticks;
+	uint16_t steps = 1;
+
+	if(!Done)
+		Frame_Busy = now - Start;
+	Done = 0;
+	if((int32_t)(now - Next) > 0){
+		// Skip the slots already missed and start on the next boundary
+		uint32_t missed = (now - Next)/Period + 1;
+		Frame_Overruns++;
+		Next += missed*Period;
+		steps += missed;
+	}
+	while((int32_t)(Frame_Ticks - Next) < 0){
+		WaitForInterrupt();
+	}
+	Start = Next;
+	Next += Period;
+	return steps;
+}
@@ -0,0 +1,144 @@
+// BakeTerrain.c
+// Runs on a PC
+// Bakes a loop of terrain rows into TerrainTrack.c and TerrainTrack.h
+// for Track_Row, then reads every row back to check it. Rows are as wide
+// as the coarsest level of detail reaches, so ST7735TestMain.c can take
+// its full detail and coarse rows from the same table. The last BLEND
+// rows fade into the rows just before row 0, so the loop has no seam.
+// Delta coding against the row in front was tried: at NOISESTEP apart
+// the rows are barely related and the deltas spread wider than the
+// heights themselves, so the heights are coded directly.
+// Build and run from the Terrain Generation folder:
+//   gcc -O2 -I. -o baketerrain Host/BakeTerrain.c Track.c Noise.c
+//   ./baketerrain
+
+#include <stdio.h>
+#include <stdint.h>
+#include "Noise.h"
+#include "Track.h"
+
+// Same grid and levels of detail as ST7735TestMain.c
+#define XSTRIP    28
+#define NOISESTEP 20
+#define LODS      3
+#define OCTAVES   4
+// Heights in a row, every column the coarsest level samples
+#define WIDTH     (((1 << (LODS-1)))*(XSTRIP - 1) + 1)
+#define ROWS      512
+#define BLEND     32
+
+static int32_t Heights[ROWS][WIDTH];
+static uint8_t Data[ROWS*WIDTH*2];
+static uint16_t Start[ROWS];
+static uint32_t Len;
+static uint8_t Bits, Used;
+
+// One row of WIDTH heights, NOISE_MAXROW at a time
+static void noiseRow(int32_t *out, int32_t y){
+	int i;
+	for(i = 0; i < WIDTH; i += NOISE_MAXROW){
+		Noise_Row(out + i, 0, NOISESTEP, y, i, WIDTH - i < NOISE_MAXROW ? WIDTH - i : NOISE_MAXROW, OCTAVES);
+	}
+}
+
+static void putBit(int b){
+	Bits = (Bits << 1) | b;
+	if(++Used == 8){
+		Data[Len++] = Bits;
+		Used = 0;
+	}
+}
+
+static void putHeight(int32_t h){
+	uint32_t v = h < 0 ? -2*h - 1 : 2*h;
+	uint32_t q;
+	for(q = v >> 1; q; q--)
+		putBit(0);
+	putBit(1);
+	putBit(v & 1);
+}
+
+int main(void){
+	static int32_t before[WIDTH], out[WIDTH];
+	FILE *c, *h;
+	int r, i, bad = 0;
+	unsigned long bits;
+
+	// Row r is world row BLEND + r, so the BLEND rows before row 0 exist
+	for(r = 0; r < ROWS; r++){
+		noiseRow(Heights[r], (BLEND + r)*NOISESTEP);
+		if(r >= ROWS - BLEND){
+			int t = r - (ROWS - BLEND) + 1;
+			noiseRow(before, (r - (ROWS - BLEND))*NOISESTEP);
+			for(i = 0; i < WIDTH; i++){
+				int32_t s = (BLEND - t)*Heights[r][i] + t*before[i];
+				Heights[r][i] = (s >= 0 ? s + BLEND/2 : s - BLEND/2)/BLEND;
+			}
+		}
+	}
+	for(r = 0; r < ROWS; r++){
+		if(Len > 0xFFFF){
+			fprintf(stderr, "track larger than 64 KB\n");
+			return 1;
+		}
+		Start[r] = Len;
+		for(i = 0; i < WIDTH; i++){
+			putHeight(Heights[r][i]);
+		}
+		// Rows start on a byte so any row can be read on its own
+		while(Used)
+			putBit(0);
+	}
+
+	c = fopen("TerrainTrack.c", "w");
+	h = fopen("TerrainTrack.h", "w");
+	if(c == 0 || h == 0){
+		fprintf(stderr, "could not create TerrainTrack.c or TerrainTrack.h\n");
+		return 1;
+	}
+	fprintf(h, "// TerrainTrack.h\n// Runs on TM4C123\n// Generated by Host/BakeTerrain.c, do not edit.\n\n"
+	           "#ifndef _TERRAINTRACKH_\n#define _TERRAINTRACKH_\n\n#include \"Track.h\"\n\n"
+	           "// A loop of %d terrain rows, %d heights wide\nextern const Track TerrainTrack;\n\n#endif\n", ROWS, WIDTH);
+	fprintf(c, "// TerrainTrack.c\n// Runs on TM4C123\n// Generated by Host/BakeTerrain.c, do not edit.\n\n"
+	           "#include <stdint.h>\n#include \"Track.h\"\n#include \"TerrainTrack.h\"\n\n"
+	           "static const uint8_t TrackData[%lu] = {", (unsigned long)Len);
+	for(i = 0; i < (int)Len; i++){
+		fprintf(c, "%s%u", i == 0 ? "\n\t" : (i % 24) ? "," : ",\n\t", Data[i]);
+	}
+	fprintf(c, "\n};\n\nstatic const uint16_t TrackStart[%d] = {", ROWS);
+	for(r = 0; r < ROWS; r++){
+		fprintf(c, "%s%u", r == 0 ? "\n\t" : (r % 12) ? "," : ",\n\t", Start[r]);
+	}
+	fprintf(c, "};\n\nconst Track TerrainTrack = {%d, %d, TrackStart, TrackData};\n", ROWS, WIDTH);
+	fclose(c);
+	fclose(h);
+
+	// Every row must read back as baked, whole and every other height
+	{
+		const Track track = {ROWS, WIDTH, Start, Data};
+		for(r = 0; r < ROWS; r++){
+			Track_Row(&track, r, out, 0, 1, WIDTH);
+			for(i = 0; i < WIDTH; i++){
+				if(out[i] != Heights[r][i]){
+					bad++;
+					break;
+				}
+			}
+			Track_Row(&track, r + ROWS, out, 1, 2, WIDTH/2);
+			for(i = 0; i < WIDTH/2; i++){
+				if(out[i] != Heights[r][1 + 2*i]){
+					bad++;
+					break;
+				}
+			}
+		}
+	}
+
+	bits = Len*8;
+	printf("%d rows of %d heights, %lu bytes of flash plus %d of row offsets\n", ROWS, WIDTH,
+	       (unsigned long)Len, (int)(ROWS*sizeof(uint16_t)));
+	printf("%.2f bits a height, %lu bytes as int8, %lu as int32\n", (double)bits/(ROWS*WIDTH),
+	       (unsigned long)ROWS*WIDTH, (unsigned long)ROWS*WIDTH*4);
+	printf("rows that read back wrong: %d\n", bad);
+	return bad != 0;
+}
@@ -0,0 +1,143 @@
+// BenchNoise.c
+// Runs on a PC
+// Times the terrain noise one row of XSTRIP samples at a time. It
+// compares the integer value noise this engine replaced, copied below,
+// with the fixed point gradient noise of Noise_Height and its float
+// twin Noise_HeightFloat, and times Noise_Row filling the same rows
+// with shared lattice corners. For each octave count it prints the time
+// per row, the best of PASSES passes so other work on the PC drops out,
+// and the heights where the fixed point and float versions disagree. The
+// old code ran every octave it was asked for, 22 when the map was first
+// filled, though its integer amplitude hit 0 after four; the new one
+// stops once its amplitude reaches 0, after nine. Host timings
+// only rank the versions; on the TM4C123 time the row loop of
+// runTerrain with SysTick.
+// Build from the Terrain Generation folder:
+//   gcc -O2 -I. -o benchnoise Host/BenchNoise.c Noise.c
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "Noise.h"
+
+#define XSTRIP 28
+#define ROWS   4000
+#define PASSES 10
+
+static volatile int32_t Sink;
+
+// The generator Noise_Height replaced, as it was
+static const int oldHash[] = {208,34,231,213,32,248,233,56,161,78,24,140,71,48,140,254,245,255,247,247,40,
+                     185,248,251,245,28,124,204,204,76,36,1,107,28,234,163,202,224,245,128,167,204,
+                     9,92,217,54,239,174,173,102,193,189,190,121,100,108,167,44,43,77,180,204,8,81,
+                     70,223,11,38,24,254,210,210,177,32,81,195,243,125,8,169,112,32,97,53,195,13,
+                     203,9,47,104,125,117,114,124,165,203,181,235,193,206,70,180,174,0,167,181,41,
+                     164,30,116,127,198,245,146,87,224,149,206,57,4,192,210,65,210,129,240,178,105,
+                     228,108,245,148,140,40,35,195,38,58,65,207,215,253,65,85,208,76,62,3,237,55,89,
+                     232,50,217,64,244,157,199,121,252,90,17,212,203,149,152,140,187,234,177,73,174,
+                     193,100,192,143,97,53,145,135,19,103,13,90,135,151,199,91,239,247,33,39,145,
+                     101,120,99,3,186,86,99,41,237,203,111,79,220,135,158,42,30,154,120,67,87,167,
+                     135,176,183,191,253,115,184,21,233,58,129,233,142,39,128,211,118,137,139,255,
+                     114,20,218,113,154,27,127,246,250,1,8,198,250,209,92,222,173,21,88,102,219};
+
+static int oldNoise2(int x, int y){
+	int tmp = oldHash[(y + 3) & 255];
+	return oldHash[(tmp + x) & 255];
+}
+
+static int32_t oldSmooth(int32_t x, int32_t y, int32_t s){
+	s = s * s * (3-2*s);
+	return x + s * (y-x);
+}
+
+static int32_t oldNoise2d(int32_t x, int32_t y){
+	int x_int = x/100, y_int = y/100;
+	int32_t x_frac = x%100, y_frac = y%100;
+	int32_t low = oldSmooth(oldNoise2(x_int, y_int), oldNoise2(x_int+1, y_int), x_frac);
+	int32_t high = oldSmooth(oldNoise2(x_int, y_int+1), oldNoise2(x_int+1, y_int+1), x_frac);
+	return oldSmooth(low, high, y_frac);
+}
+
+static int32_t oldPerlin2d(int32_t x, int32_t y, int32_t freq, int depth){
+	int32_t xa = x*freq%832, ya = y*freq%832;
+	int32_t amp = 10, fin = 0, div = 0;
+	int i;
+	for(i = 0; i < depth; i++){
+		div += 256 * amp;
+		fin += oldNoise2d(xa, ya) * amp;
+		amp /= 2;
+		xa *= 2;
+		ya *= 2;
+	}
+	return fin/div;
+}
+
+static double now(void){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+// Keep the shortest time since t0 in *best
+static void keepBest(double *best, double t0){
+	double t = now() - t0;
+	if(t < *best)
+		*best = t;
+}
+
+int main(void){
+	static const int octaves[5] = {1, 2, 3, 4, 22};
+	double t0, tOld, tFixed, tFloat, tRow;
+	int32_t row[XSTRIP];
+	int k, p, i, j, rowBad = 0;
+
+	printf("octaves  old us/row  fixed us/row  float us/row  Noise_Row us  differ\n");
+	for(k = 0; k < 5; k++){
+		int oct = octaves[k], bad = 0;
+		tOld = tFixed = tFloat = tRow = 1e9;
+		for(p = 0; p < PASSES; p++){
+			t0 = now();
+			for(i = 0; i < ROWS; i++){
+				for(j = 0; j < XSTRIP; j++){
+					Sink = oldPerlin2d(j*20, i, 3, oct)/90000;
+				}
+			}
+			keepBest(&tOld, t0);
+			t0 = now();
+			for(i = 0; i < ROWS; i++){
+				for(j = 0; j < XSTRIP; j++){
+					Sink = Noise_Height(j*20, i, oct);
+				}
+			}
+			keepBest(&tFixed, t0);
+			t0 = now();
+			for(i = 0; i < ROWS; i++){
+				for(j = 0; j < XSTRIP; j++){
+					Sink = Noise_HeightFloat(j*20, i, oct);
+				}
+			}
+			keepBest(&tFloat, t0);
+			t0 = now();
+			for(i = 0; i < ROWS; i++){
+				Noise_Row(row, 0, 20, i, 0, XSTRIP, oct);
+				Sink = row[XSTRIP - 1];
+			}
+			keepBest(&tRow, t0);
+		}
+		for(i = 0; i < ROWS; i++){
+			for(j = 0; j < XSTRIP; j++){
+				if(Noise_Height(j*20, i, oct) != Noise_HeightFloat(j*20, i, oct))
+					bad++;
+			}
+			Noise_Row(row, 0, 20, i, 0, XSTRIP, oct);
+			for(j = 0; j < XSTRIP; j++){
+				if(row[j] != Noise_Height(j*20, i, oct))
+					rowBad++;
+			}
+		}
+		printf("%7d  %10.2f  %12.2f  %12.2f  %12.2f  %5.1f%%\n", oct, tOld*1e6/ROWS,
+		       tFixed*1e6/ROWS, tFloat*1e6/ROWS, tRow*1e6/ROWS, 100.0*bad/ROWS/XSTRIP);
+	}
+	printf("Noise_Row heights that differ from Noise_Height: %d\n", rowBad);
+	return rowBad != 0;
+}
@@ -0,0 +1,208 @@
+// Noise.c
+// Runs on TM4C123
+// Fixed point gradient noise for the terrain heightmap.
+
+#include <stdint.h>
+#include "Trig.h"
+#include "Noise.h"
+
+static int SEED = 3;
+
+static const uint8_t hash[] = {208,34,231,213,32,248,233,56,161,78,24,140,71,48,140,254,245,255,247,247,40,
+                     185,248,251,245,28,124,204,204,76,36,1,107,28,234,163,202,224,245,128,167,204,
+                     9,92,217,54,239,174,173,102,193,189,190,121,100,108,167,44,43,77,180,204,8,81,
+                     70,223,11,38,24,254,210,210,177,32,81,195,243,125,8,169,112,32,97,53,195,13,
+                     203,9,47,104,125,117,114,124,165,203,181,235,193,206,70,180,174,0,167,181,41,
+                     164,30,116,127,198,245,146,87,224,149,206,57,4,192,210,65,210,129,240,178,105,
+                     228,108,245,148,140,40,35,195,38,58,65,207,215,253,65,85,208,76,62,3,237,55,89,
+                     232,50,217,64,244,157,199,121,252,90,17,212,203,149,152,140,187,234,177,73,174,
+                     193,100,192,143,97,53,145,135,19,103,13,90,135,151,199,91,239,247,33,39,145,
+                     101,120,99,3,186,86,99,41,237,203,111,79,220,135,158,42,30,154,120,67,87,167,
+                     135,176,183,191,253,115,184,21,233,58,129,233,142,39,128,211,118,137,139,255,
+                     114,20,218,113,154,27,127,246,250,1,8,198,250,209,92,222,173,21,88,102,219};
+
+// Gradient directions picked by the low 3 bits of a lattice hash
+static const int8_t GradX[8] = {1, -1, 1, -1, 1, -1, 0, 0};
+static const int8_t GradY[8] = {1, 1, -1, -1, 0, 0, 1, -1};
+
+// 6t^5-15t^4+10t^3 for t = i/256, 12 fraction bits, built by the compiler
+#define FADE(i) ((int16_t)(((int64_t)(i)*(i)*(i)*((i)*(6*(i) - 15*256) + 10*65536) + (1L << 27)) >> 28))
+static const int16_t Fade[256] = {TRIG_T256(FADE, 0)};
+
+static int noise2(int x, int y)
+{
+    int tmp = hash[(y + SEED) & 255];
+    return hash[(tmp + x) & 255];
+}
+
+// Dot product of a corner's gradient with the offset to the sample
+static int16_t corner(int x, int y, int16_t dx, int16_t dy){
+	uint8_t h = noise2(x, y) & 7;
+	return GradX[h]*dx + GradY[h]*dy;
+}
+
+// Blend the four corner products of a cell with the fade weights
+static int16_t blend(int32_t s, int32_t t, int32_t u, int32_t v, int32_t wx, int32_t wy){
+	int32_t low = s + (((t - s)*wx) >> 12);
+	int32_t high = u + (((v - u)*wx) >> 12);
+	return low + (((high - low)*wy) >> 12);
+}
+
+int16_t Noise_Gradient(int32_t x, int32_t y){
+	int ix = x >> 8, iy = y >> 8;
+	int16_t fx = x & 0xFF, fy = y & 0xFF;
+	return blend(corner(ix, iy, fx, fy), corner(ix+1, iy, fx - 256, fy),
+	             corner(ix, iy+1, fx, fy - 256), corner(ix+1, iy+1, fx - 256, fy - 256),
+	             Fade[fx], Fade[fy]);
+}
+
+// Sample position to lattice position with 8 fraction bits. The hash
+// repeats every 256 cells, so wrapping first keeps the product small.
+static int32_t lattice(int32_t v){
+	return ((v % (256*NOISE_CELL))*256)/NOISE_CELL;
+}
+
+// Rounded height of a noise sum with 8 fraction bits
+static int32_t height(int32_t sum){
+	return (sum*NOISE_SCALE + 128) >> 8;
+}
+
+int32_t Noise_Height(int32_t x, int32_t y, int octaves){
+#if NOISE_FLOAT
+	return Noise_HeightFloat(x, y, octaves);
+#else
+	int32_t lx = lattice(x), ly = lattice(y);
+	int32_t sum = 0, amp = 256;
+	int i;
+	// After the ninth octave amp is 0 and the rest add nothing
+	for(i = 0; i < octaves && amp; i++){
+		sum += (Noise_Gradient(lx, ly)*amp) >> 8;
+		amp >>= 1;
+		lx <<= 1;
+		ly <<= 1;
+	}
+	return height(sum);
+#endif
+}
+
+#if !NOISE_FLOAT
+// Lattice x of each sample in the strip. Kept out of the stack, which is
+// small on the board, as Noise_Row is never called from an interrupt. The
+// running sums are kept in out itself.
+static int32_t RowX[NOISE_MAXROW];
+#endif
+
+void Noise_Row(int32_t *out, int32_t x, int32_t dx, int32_t y,
+               uint8_t first, uint8_t count, int octaves){
+#if NOISE_FLOAT
+	uint8_t j;
+	for(j = 0; j < count; j++){
+		out[j] = Noise_HeightFloat(x + (first + j)*dx, y, octaves);
+	}
+#else
+	int32_t *sum = out;
+	int32_t ly = lattice(y), amp = 256;
+	uint8_t j;
+	int i;
+
+	if(count > NOISE_MAXROW)
+		count = NOISE_MAXROW;
+	for(j = 0; j < count; j++){
+		RowX[j] = lattice(x + (first + j)*dx);
+		sum[j] = 0;
+	}
+	for(i = 0; i < octaves && amp; i++){
+		// The whole strip shares one pair of lattice rows and one y weight
+		int iy = ly >> 8;
+		int16_t fy = ly & 0xFF;
+		int32_t wy = Fade[fy];
+		int row0 = hash[(iy + SEED) & 255], row1 = hash[(iy + 1 + SEED) & 255];
+		int cell = 0;
+		uint8_t h00, h10 = 0, h01, h11 = 0;
+		j = 0;
+		while(j < count){
+			// Find the corners of the cell the next sample is in, keeping
+			// the shared edge when that is the next cell along
+			int32_t px = RowX[j] << i;
+			int ix = px >> 8;
+			int32_t gs, gt, gu, gv, cs, ct, cu, cv;
+			if(j && ix == cell + 1){
+				h00 = h10;
+				h01 = h11;
+			}
+			else{
+				h00 = hash[(row0 + ix) & 255] & 7;
+				h01 = hash[(row1 + ix) & 255] & 7;
+			}
+			h10 = hash[(row0 + ix + 1) & 255] & 7;
+			h11 = hash[(row1 + ix + 1) & 255] & 7;
+			cell = ix;
+			// Across the cell each corner product is linear in fx. Take
+			// the low edge's near corner (gs*fx + cs) and its rise to the
+			// far corner (gt*fx + ct) once here, the same for the high edge
+			gs = GradX[h00]; cs = GradY[h00]*fy;
+			gu = GradX[h01]; cu = GradY[h01]*(fy - 256);
+			gt = GradX[h10] - gs; ct = GradY[h10]*fy - 256*GradX[h10] - cs;
+			gv = GradX[h11] - gu; cv = GradY[h11]*(fy - 256) - 256*GradX[h11] - cu;
+			// Then sweep the samples that fall in the cell. amp is
+			// 256 >> i, so scaling by it is a shift by i.
+			do{
+				int32_t fx = px & 0xFF, wx = Fade[fx];
+				int32_t low = gs*fx + cs + (((gt*fx + ct)*wx) >> 12);
+				int32_t high = gu*fx + cu + (((gv*fx + cv)*wx) >> 12);
+				sum[j] += (low + (((high - low)*wy) >> 12)) >> i;
+			}while(++j < count && ((px = RowX[j] << i) >> 8) == cell);
+		}
+		amp >>= 1;
+		ly <<= 1;
+	}
+	for(j = 0; j < count; j++){
+		out[j] = height(sum[j]);
+	}
+#endif
+}
+
+// Noise_Gradient in float, fraction in [0, 1)
+static float gradientFloat(float x, float y){
+	int32_t ix = (int32_t)x, iy = (int32_t)y;
+	float fx, fy, wx, wy, s, t, u, v, low, high;
+	uint8_t h;
+	if(x < ix) ix--;
+	if(y < iy) iy--;
+	fx = x - ix;
+	fy = y - iy;
+	h = noise2(ix, iy) & 7;
+	s = GradX[h]*fx + GradY[h]*fy;
+	h = noise2(ix+1, iy) & 7;
+	t = GradX[h]*(fx - 1) + GradY[h]*fy;
+	h = noise2(ix, iy+1) & 7;
+	u = GradX[h]*fx + GradY[h]*(fy - 1);
+	h = noise2(ix+1, iy+1) & 7;
+	v = GradX[h]*(fx - 1) + GradY[h]*(fy - 1);
+	wx = fx*fx*fx*(fx*(6*fx - 15) + 10);
+	wy = fy*fy*fy*(fy*(6*fy - 15) + 10);
+	low = s + (t - s)*wx;
+	high = u + (v - u)*wx;
+	return low + (high - low)*wy;
+}
+
+// Nearest height of a noise sum
+static int32_t heightFloat(float sum){
+	float h = sum*NOISE_SCALE;
+	return (int32_t)(h >= 0 ? h + 0.5f : h - 0.5f);
+}
+
+int32_t Noise_HeightFloat(int32_t x, int32_t y, int octaves){
+	float fx = (float)(x % (256*NOISE_CELL))/NOISE_CELL;
+	float fy = (float)(y % (256*NOISE_CELL))/NOISE_CELL;
+	float sum = 0, amp = 1;
+	int i;
+	// The same nine octaves at most as Noise_Height
+	for(i = 0; i < octaves && amp >= 1/256.0f; i++){
+		sum += gradientFloat(fx, fy)*amp;
+		amp *= 0.5f;
+		fx *= 2;
+		fy *= 2;
+	}
+	return heightFloat(sum);
+}
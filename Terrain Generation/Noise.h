@@ -0,0 +1,74 @@
+// Noise.h
+// Runs on TM4C123
+// Fixed point gradient noise for the terrain heightmap. Lattice points
+// take one of eight gradients from a hash table, the four around a
+// sample are blended with a 6t^5-15t^4+10t^3 fade read from a table,
+// and octaves of halving amplitude are summed until the amplitude rounds
+// to 0, nine at most. With NOISE_FLOAT set the same noise
+// is computed in float instead, which needs the FPU enabled by Fpu_Init.
+
+#ifndef _NOISEH_
+#define _NOISEH_
+
+#include <stdint.h>
+
+// 1 makes Noise_Height use Noise_HeightFloat, 0 the fixed point noise
+#ifndef NOISE_FLOAT
+#define NOISE_FLOAT 0
+#endif
+
+// Sample units per lattice cell in the first octave
+#define NOISE_CELL 33
+
+// Height of a noise value of 1.0, heights come out at about -5 to 5
+#define NOISE_SCALE 5
+
+// Bound on |Noise_Gradient|. Across x the four corners weigh in at most
+// t(1-fade(t)) + (1-t)fade(t), which peaks at 1/2 mid cell, the same
+// across y, so the noise stays within 1.0, plus a little for rounding.
+#define NOISE_PEAK 264
+
+// Most samples Noise_Row takes in one call
+#define NOISE_MAXROW 64
+
+//------------Noise_Gradient------------
+// One octave of gradient noise.
+// Input: x, y  lattice position with 8 fraction bits
+// Output: noise with 8 fraction bits, within +/-NOISE_PEAK
+int16_t Noise_Gradient(int32_t x, int32_t y);
+
+//------------Noise_Height------------
+// Terrain height at a sample position. Octaves past the ninth would add
+// nothing at 8 fraction bits and are not run.
+// Input: x, y     sample position, NOISE_CELL units per lattice cell
+//        octaves  most octaves to add
+// Output: height
+int32_t Noise_Height(int32_t x, int32_t y, int octaves);
+
+//------------Noise_Row------------
+// Noise_Height for a strip of samples along one row, count samples from
+// sample first at x + first*dx, x + (first+1)*dx and so on, all at y.
+// The strip is worked an octave at a time: the row's lattice rows and y
+// weight are found once, and each cell's corner gradients and the parts
+// of their products fixed across it once, before the samples in the
+// cell are swept, so a row costs less than count Noise_Height calls.
+// Passing first lets a row be filled a piece at a time. Gives the same
+// heights as Noise_Height. Works in static buffers, so it must not be
+// called from an interrupt while the main loop may be in it.
+// Input: out      receives count heights, entry 0 for sample first
+//        x, dx    position of sample 0 and the spacing along the row
+//        y        position of the row
+//        first    index of the first sample to compute
+//        count    samples, at most NOISE_MAXROW
+//        octaves  most octaves to add
+// Output: none
+void Noise_Row(int32_t *out, int32_t x, int32_t dx, int32_t y,
+               uint8_t first, uint8_t count, int octaves);
+
+//------------Noise_HeightFloat------------
+// Noise_Height computed in single precision float.
+// Input: as Noise_Height
+// Output: height
+int32_t Noise_HeightFloat(int32_t x, int32_t y, int octaves);
+
+#endif
@@ -0,0 +1,61 @@
+// Raster.c
+// Runs on TM4C123
+// Polygon row extents, from the Simple Objects rasterizer. Edges are
+// walked once with a 16.16 fixed point DDA to find the left and right
+// extent of every row.
+
+#include <stdint.h>
+#include "Raster.h"
+
+// Walk one edge and widen the extents of the rows it crosses between
+// top and bottom. l and r are indexed from row top.
+static void walkEdge(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                     int16_t top, int16_t bottom, int16_t *l, int16_t *r){
+	int32_t fx, step;
+	int16_t y, x;
+
+	if(y0 > y1){
+		int16_t t;
+		t = x0; x0 = x1; x1 = t;
+		t = y0; y0 = y1; y1 = t;
+	}
+	if(y1 < top || y0 > bottom)
+		return;
+	if(y0 == y1){
+		y = y0 - top;
+		if(x0 < l[y]) l[y] = x0;
+		if(x1 < l[y]) l[y] = x1;
+		if(x0 > r[y]) r[y] = x0;
+		if(x1 > r[y]) r[y] = x1;
+		return;
+	}
+	step = ((int32_t)(x1 - x0) << 16) / (y1 - y0);
+	fx = ((int32_t)x0 << 16) + 0x8000;
+	if(y0 < top){
+		fx += step * (top - y0);
+		y0 = top;
+	}
+	if(y1 > bottom)
+		y1 = bottom;
+	for(y = y0 - top; y <= y1 - top; y++){
+		x = fx >> 16;
+		if(x < l[y]) l[y] = x;
+		if(x > r[y]) r[y] = x;
+		fx += step;
+	}
+}
+
+void Raster_Extents(const int16_t *xs, const int16_t *ys, uint8_t n,
+                    int16_t top, int16_t bottom, int16_t *l, int16_t *r){
+	int16_t y;
+	uint8_t i;
+
+	for(y = 0; y <= bottom - top; y++){
+		l[y] = 0x7FFF;
+		r[y] = -0x7FFF;
+	}
+	for(i = 0; i < n; i++){
+		uint8_t j = (i + 1 == n) ? 0 : i + 1;
+		walkEdge(xs[i], ys[i], xs[j], ys[j], top, bottom, l, r);
+	}
+}
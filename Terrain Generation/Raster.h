@@ -0,0 +1,29 @@
+// Raster.h
+// Runs on TM4C123
+// The part of the Simple Objects rasterizer the terrain uses: the line
+// drawer hook type and the polygon row extents that Band.c fills its
+// faces from. The filled polygon, line and ellipse drawing stay in the
+// Simple Objects copy.
+
+#ifndef _RASTERH_
+#define _RASTERH_
+
+#include <stdint.h>
+
+// Draws one whole line from (x0, y0) to (x1, y1), such as Band_LineAA
+typedef void (*LineFunc)(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+//------------Raster_Extents------------
+// Find the left and right x of each row a convex polygon covers, without
+// drawing it. Rows outside the polygon come back with l > r. Used by
+// renderers that need the row extents but shade the pixels themselves.
+// Input: xs, ys  the n vertices
+//        n       number of vertices
+//        top     first row wanted
+//        bottom  last row wanted
+//        l, r    receive bottom-top+1 extents, entry 0 is row top
+// Output: none
+void Raster_Extents(const int16_t *xs, const int16_t *ys, uint8_t n,
+                    int16_t top, int16_t bottom, int16_t *l, int16_t *r);
+
+#endif
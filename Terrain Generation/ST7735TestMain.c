@@ -20,7 +20,17 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 #include "ST7735.h"
+#include "Camera.h"
+#include "Frame.h"
+#include "Quality.h"
+#include "Band.h"
+#include "Raster.h"
+#include "Noise.h"
+#include "Track.h"
+#include "TerrainTrack.h"
+#include "Fpu.h"
 #include "PLL.h"
 #include "tm4c123gh6pm.h"
 
@@ -29,87 +39,357 @@
 	#define FZ			17
 	#define SCALE		5
 	#define ZSCALE	1
-	#define XSTRIP	144/SCALE
-	#define ZSTRIP	80/SCALE
-int32_t terrain[ZSTRIP+1][XSTRIP];
+	#define FRAMEMS	100
+	#define ANTIALIAS	1
+	// Hide the parts of the mesh behind nearer ridges
+	#define HIDDEN	1
+	// Draw the terrain filled and shaded, one screen column at a time,
+	// instead of as a wireframe
+	#define VOXEL	0
+	// Noise units between grid points, across and along the rows
+	#define NOISESTEP	20
+	// Fly the loop baked by Host/BakeTerrain.c instead of generating
+	// noise, for a fixed path with no noise cost and an instant start
+	#define BAKED	0
+	// Grid size. Heights are stored a byte each, so the voxel renderer,
+	// which needs nothing per grid point but its height, takes a grid
+	// twice as wide and twice as deep in less RAM than the int32_t grid
+	// it had. The wireframes also keep screen positions and horizons per
+	// point, which would not fit four times over, and the baked track is
+	// cut for the smaller grid.
+	#if VOXEL == 1 && BAKED == 0
+	#define GRID	2
+	#else
+	#define GRID	1
+	#endif
+	#define XSTRIP	(GRID*(144/SCALE))
+	#define ZSTRIP	(GRID*(80/SCALE))
+	// Heights are kept as int8_t steps of HEIGHTSTEP. A height never
+	// leaves 2*NOISE_SCALE*NOISE_PEAK/256, the octaves adding up to less
+	// than twice the first, so this is the smallest step that covers the
+	// noise in 127 steps, 1 for the noise as it is.
+	#define HEIGHTSTEP	(2*NOISE_SCALE*NOISE_PEAK/256/128 + 1)
+	#define HEIGHT(q)	((int16_t)(q)*HEIGHTSTEP)
+	// Levels of detail. Past the ZSTRIP rows of full detail come LODROWS
+	// rows spaced twice as far apart across and along, then LODROWS at
+	// four times, and so on for LODS levels in all. Every row has XSTRIP
+	// points, so a coarse row costs the same as a fine one but reaches
+	// further out to the sides, as the view widens with distance. Only
+	// the anti-aliased and voxel renderers draw them; the plain wireframe
+	// erases line by line and keeps to the full detail rows.
+	#if ANTIALIAS == 1 || VOXEL == 1
+	#define LODS	3
+	#else
+	#define LODS	1
+	#endif
+	#define LODROWS	(GRID*8)
+	// Depth of the nearest row of the farthest strip, where the mesh has
+	// faded out
+	#define FARDEPTH	(ZSTRIP + LODROWS*((2 << (LODS-1)) - 2))
+	// Noise x of grid column 0, far enough in that the coarsest rows never
+	// sample left of 0
+	#define NOISEX	((XSTRIP/2)*((1 << (LODS-1)) - 1)*NOISESTEP)
+	// Full detail rows generated ahead of the far row
+	#define AHEAD	3
+	// Columns of noise every frame generates whatever its slack: one full
+	// detail row, and a coarse row every 2^k frames for level k
+	#define STEADY	(2*XSTRIP - (XSTRIP >> (LODS-1)))
+	// Columns generated between checks of the time left in a frame
+	#define SLICE	4
+// The heightmap is a ring of rows. Row z counted from the viewer is
+// ROW(z), so scrolling forward writes the new far row over the nearest
+// one and moves head instead of copying every row down.
+int8_t terrain[ZSTRIP+1][XSTRIP];
+uint8_t head;
+#define ROW(z) terrain[((z) + head) % (ZSTRIP+1)]
+// Rows scrolled since start, row z is row Scroll + z of the world
+int32_t Scroll;
+// Rows past the far row, generated a few columns at a time so no frame
+// has to find a whole row at once. AheadReady rows from AheadHead on
+// are finished.
+int8_t Ahead[AHEAD][XSTRIP];
+uint8_t AheadHead, AheadReady;
+// A row of noise being filled a few columns at a time
+typedef struct {
+	int8_t *out;         // 0 when there is no row in progress
+	int32_t x, dx, y;    // as for Noise_Row
+	uint8_t done;        // columns filled so far
+	uint8_t octaves;     // fixed when the row starts, so it has no seams
+} RowJob;
+RowJob AheadJob;
+// Flips every frame, picks this frame's half of the tables kept for the
+// next frame
+uint8_t flip;
+#if LODS > 1
+// Coarse rows. Level k holds the LODROWS world rows that are multiples
+// of 2^k just behind the level in front. World row m*2^k sits in slot
+// m % (LODROWS+1) and LodTag keeps which m. The slot left over is where
+// the background builds row LodNext, the one the level moves onto next.
+int8_t LodTerrain[LODS-1][LODROWS+1][XSTRIP];
+int32_t LodTag[LODS-1][LODROWS+1];
+int32_t LodNext[LODS-1];
+RowJob LodJob[LODS-1];
+// This frame's rows of each level, nearest first: heights and their
+// depth counted like z+1 of a full detail row
+int8_t *LodRow[LODS-1][LODROWS];
+int16_t LodDepth[LODS-1][LODROWS];
+#endif
+#if VOXEL == 0
+// Screen y of every grid point, kept in the same ring as the heights.
+// This frame's projections are in ScreenY[flip] and last frame's stay in
+// the other half for the erase pass.
+int16_t ScreenY[2][ZSTRIP+1][XSTRIP];
+#define ROWY(b, z) ScreenY[b][((z) + head) % (ZSTRIP+1)]
+// Screen x of every column at each depth. The camera never moves or
+// turns, so a column at a given depth always lands on the same x.
+int16_t ScreenX[ZSTRIP+2][XSTRIP];
+#if LODS > 1
+// Screen positions of this frame's coarse rows
+int16_t LodX[LODS-1][LODROWS][XSTRIP], LodY[LODS-1][LODROWS][XSTRIP];
+#endif
+#if HIDDEN == 1
+// Floating horizon. Strips are drawn front to back, and a terrain that is
+// only seen from above can only show through above everything nearer, so
+// Horizon[b][z][x] is the highest screen row reached in column x by the
+// strips in front of strip z. Each frame's horizons are kept for the
+// next frame's erase pass, which has to skip the same pixels.
+uint8_t Horizon[2][ZSTRIP+2][ST7735_TFTWIDTH];
+#if LODS > 1
+// Horizons in front of the coarse strips, only drawn anti-aliased, so
+// they are never erased and one frame's worth will do
+uint8_t LodHorizon[(LODS-1)*LODROWS][ST7735_TFTWIDTH];
+#endif
+const uint8_t *Hor;
+uint8_t *Next;
+uint8_t Trace;
+#endif
+#endif
+// Eye sits 24 units above the terrain's zero height
+Camera View;
 #endif
 
 #if Perlin == 1
-static int SEED = 3;
-
-static int hash[] = {208,34,231,213,32,248,233,56,161,78,24,140,71,48,140,254,245,255,247,247,40,
-                     185,248,251,245,28,124,204,204,76,36,1,107,28,234,163,202,224,245,128,167,204,
-                     9,92,217,54,239,174,173,102,193,189,190,121,100,108,167,44,43,77,180,204,8,81,
-                     70,223,11,38,24,254,210,210,177,32,81,195,243,125,8,169,112,32,97,53,195,13,
-                     203,9,47,104,125,117,114,124,165,203,181,235,193,206,70,180,174,0,167,181,41,
-                     164,30,116,127,198,245,146,87,224,149,206,57,4,192,210,65,210,129,240,178,105,
-                     228,108,245,148,140,40,35,195,38,58,65,207,215,253,65,85,208,76,62,3,237,55,89,
-                     232,50,217,64,244,157,199,121,252,90,17,212,203,149,152,140,187,234,177,73,174,
-                     193,100,192,143,97,53,145,135,19,103,13,90,135,151,199,91,239,247,33,39,145,
-                     101,120,99,3,186,86,99,41,237,203,111,79,220,135,158,42,30,154,120,67,87,167,
-                     135,176,183,191,253,115,184,21,233,58,129,233,142,39,128,211,118,137,139,255,
-                     114,20,218,113,154,27,127,246,250,1,8,198,250,209,92,222,173,21,88,102,219};
-
-int noise2(int x, int y)
-{
-    int tmp = hash[(y + SEED) & 255];
-    return hash[(tmp + x) & 255];
-}
-
-int32_t lin_inter(int32_t x, int32_t y, int32_t s)
-{
-    return x + s * (y-x);
-}
-
-int32_t smooth_inter(int32_t x, int32_t y, int32_t s)
-{
-    return lin_inter(x, y, s * s * (3-2*s));
-}
-
-int32_t noise2d(int32_t x, int32_t y)
-{
-    int x_int = x/100;
-    int y_int = y/100;
-    int32_t x_frac = x%100;
-    int32_t y_frac = y%100;
-	
-    int s = noise2(x_int, y_int);
-    int t = noise2(x_int+1, y_int);
-    int u = noise2(x_int, y_int+1);
-    int v = noise2(x_int+1, y_int+1);
-    int32_t low = smooth_inter(s, t, x_frac);
-    int32_t high = smooth_inter(u, v, x_frac);
-    return smooth_inter(low, high, y_frac);
-}
-
-int32_t perlin2d(int32_t x, int32_t y, int32_t freq, int depth)
-{
-    int32_t xa = x*freq%832;
-    int32_t ya = y*freq%832;
-    int32_t amp = 10;
-    int32_t fin = 0;
-    int32_t div = 0;
-
-    int i;
-    for(i=0; i<depth; i++)
-    {
-        div += 256 * amp;
-        fin += noise2d(xa, ya) * amp;
-        amp /= 2;
-        xa *= 2;
-        ya *= 2;
-    }
-
-    return fin/div;
-}
-
-// Slightly modified Bresenham's algorithm
-void makeLine(int8_t x, int8_t y, int8_t z, int8_t x1, int8_t y1, int8_t z1, uint16_t color) {			
-	int16_t cx = 64 + (x*FZ/(z));
-	int16_t cy = 55 + ((y+24)*FZ/(z));
-	int16_t cx1 = 64 + (x1*FZ/(z1));
-	int16_t cy1 = 55 + ((y1+24)*FZ/(z1));
-	
+#if VOXEL == 0
+// Screen x of each column at each depth, for a camera with no yaw
+void projectColumns(void) {
+	int16_t x, d, depth;
+	for(d = 0; d < ZSTRIP+2; d++){
+		depth = d*ZSCALE - View.z;
+		if(depth < 1)
+			depth = 1;
+		for(x = 0; x < XSTRIP; x++){
+			ScreenX[d][x] = View.cx + Camera_Scale(&View, (x - XSTRIP/2)*SCALE - View.x, depth);
+		}
+	}
+}
+
+// Project row z, at depth z+1, into this frame's half of ScreenY
+void projectRow(int16_t z) {
+	int8_t *h = ROW(z);
+	int16_t *sy = ROWY(flip, z);
+	int16_t x, depth = (z+1)*ZSCALE - View.z;
+	if(depth < 1)
+		depth = 1;
+	for(x = 0; x < XSTRIP; x++){
+		sy[x] = View.cy + Camera_Scale(&View, HEIGHT(h[x]) - View.y, depth);
+	}
+}
+#endif
+
+// Store count heights as steps of HEIGHTSTEP
+void packHeights(int8_t *out, const int32_t *h, uint8_t count) {
+	uint8_t i;
+	for(i = 0; i < count; i++){
+		out[i] = (h[i] + (h[i] < 0 ? -HEIGHTSTEP/2 : HEIGHTSTEP/2))/HEIGHTSTEP;
+	}
+}
+
+// Fill up to cols more columns of job, return the columns filled
+uint8_t stepJob(RowJob *job, uint8_t cols) {
+	// Heights before packing, static to spare the small stack
+	static int32_t h[XSTRIP];
+#if BAKED == 1
+	// A baked row is always read whole in one call, whatever cols allows,
+	// as the track costs only a few bit reads a height. The noise
+	// positions give its row and columns in the track.
+	if(job->done == XSTRIP)
+		return 0;
+	cols = XSTRIP - job->done;
+	Track_Row(&TerrainTrack, job->y/NOISESTEP, h, job->x/NOISESTEP, job->dx/NOISESTEP, XSTRIP);
+	packHeights(job->out, h, XSTRIP);
+#else
+	if(cols > XSTRIP - job->done)
+		cols = XSTRIP - job->done;
+	Noise_Row(h, job->x, job->dx, job->y, job->done, cols, job->octaves);
+	packHeights(job->out + job->done, h, cols);
+#endif
+	job->done += cols;
+	return cols;
+}
+
+// Fill a whole row at once
+void wholeRow(int8_t *out, int32_t x, int32_t dx, int32_t y, uint8_t octaves) {
+	RowJob job = {out, x, dx, y, 0, octaves};
+	stepJob(&job, XSTRIP);
+}
+
+#if LODS > 1
+// Start job on world row m of coarse level k, with fewer octaves the
+// coarser it is
+void startLod(RowJob *job, int16_t k, int32_t m, uint8_t octaves) {
+	int16_t s = 1 << k;
+	job->out = LodTerrain[k-1][m % (LODROWS+1)];
+	job->x = NOISEX - (s-1)*(XSTRIP/2)*NOISESTEP;
+	job->dx = s*NOISESTEP;
+	job->y = m*s*NOISESTEP;
+	job->done = 0;
+	job->octaves = octaves > k ? octaves - k : 1;
+}
+
+// Move each coarse level up behind the one in front of it. A row the
+// background has not finished is generated here.
+void updateLods(uint8_t octaves) {
+	int32_t back = Scroll + ZSTRIP, m;
+	int16_t k, r, s;
+	for(k = 1; k < LODS; k++){
+		s = 1 << k;
+		m = back/s + 1;
+		for(r = 0; r < LODROWS; r++, m++){
+			int8_t *row = LodTerrain[k-1][m % (LODROWS+1)];
+			if(LodTag[k-1][m % (LODROWS+1)] != m){
+				RowJob *job = &LodJob[k-1];
+				if(job->out != row || job->y != m*s*NOISESTEP)
+					startLod(job, k, m, octaves);
+				stepJob(job, XSTRIP);
+				LodTag[k-1][m % (LODROWS+1)] = m;
+				job->out = 0;
+			}
+			LodRow[k-1][r] = row;
+			LodDepth[k-1][r] = m*s - Scroll + 1;
+		}
+		LodNext[k-1] = m;
+		back = (m - 1)*s;
+	}
+}
+
+#if VOXEL == 0
+// Project the rows of the first lods-1 coarse levels for this frame
+void projectLods(uint8_t lods) {
+	int16_t k, r, x, s, depth;
+	for(k = 1; k < lods; k++){
+		s = 1 << k;
+		for(r = 0; r < LODROWS; r++){
+			int8_t *h = LodRow[k-1][r];
+			depth = LodDepth[k-1][r]*ZSCALE - View.z;
+			for(x = 0; x < XSTRIP; x++){
+				LodX[k-1][r][x] = View.cx + Camera_Scale(&View, s*(x - XSTRIP/2)*SCALE - View.x, depth);
+				LodY[k-1][r][x] = View.cy + Camera_Scale(&View, HEIGHT(h[x]) - View.y, depth);
+			}
+		}
+	}
+}
+#endif
+#endif
+
+// Spend up to cols columns of noise on the rows that will be needed
+// next: the full detail rows queued behind the far row first, then the
+// next row of each coarse level.
+// Input: cols     columns to generate
+//        octaves  octaves for rows started now
+// Output: 0 once every row ahead is ready, 1 if there is work left
+uint8_t generateAhead(int16_t cols, uint8_t octaves) {
+	while(cols > 0){
+		if(AheadReady < AHEAD){
+			if(!AheadJob.out){
+				AheadJob.out = Ahead[(AheadHead + AheadReady) % AHEAD];
+				AheadJob.x = NOISEX;
+				AheadJob.dx = NOISESTEP;
+				AheadJob.y = (Scroll + ZSTRIP + 1 + AheadReady)*NOISESTEP;
+				AheadJob.done = 0;
+				AheadJob.octaves = octaves;
+			}
+			cols -= stepJob(&AheadJob, cols);
+			if(AheadJob.done == XSTRIP){
+				AheadReady++;
+				AheadJob.out = 0;
+			}
+			continue;
+		}
+	#if LODS > 1
+		{
+			int16_t k;
+			for(k = 1; k < LODS; k++){
+				int32_t m = LodNext[k-1];
+				RowJob *job = &LodJob[k-1];
+				if(LodTag[k-1][m % (LODROWS+1)] == m)
+					continue;
+				if(!job->out || job->y != m*(1 << k)*NOISESTEP)
+					startLod(job, k, m, octaves);
+				cols -= stepJob(job, cols);
+				if(job->done == XSTRIP){
+					LodTag[k-1][m % (LODROWS+1)] = m;
+					job->out = 0;
+				}
+				break;
+			}
+			if(k < LODS)
+				continue;
+		}
+	#endif
+		return 0;
+	}
+	return 1;
+}
+
+// Scroll one row forward. The far row comes off the queue, finished
+// here if the background has not got to it.
+void scrollRow(uint8_t octaves) {
+	while(!AheadReady){
+		generateAhead(XSTRIP, octaves);
+	}
+	// The nearest row scrolls off and its storage becomes the new far row
+	memcpy(terrain[head], Ahead[AheadHead], sizeof(terrain[0]));
+	AheadHead = (AheadHead + 1) % AHEAD;
+	AheadReady--;
+	Scroll++;
+	head = (head + 1) % (ZSTRIP+1);
+}
+
+#if VOXEL == 0
+#if HIDDEN == 1
+// Horizon in front of strip n
+uint8_t *horizonAt(int16_t n) {
+#if LODS > 1
+	if(n > ZSTRIP+1)
+		return LodHorizon[n - ZSTRIP - 2];
+#endif
+	return Horizon[flip][n];
+}
+
+// Start strip n of this frame. Its pixels are tested against the horizon
+// in front of it and raise the one behind it.
+void beginStrip(int16_t n) {
+	Hor = horizonAt(n);
+	Next = horizonAt(n+1);
+	memcpy(Next, Hor, ST7735_TFTWIDTH);
+}
+#endif
+
+// Draw one pixel of the mesh unless a nearer strip hides it
+void plot(int16_t x, int16_t y, uint16_t color) {
+#if HIDDEN == 1
+	if(x < 0 || x >= ST7735_TFTWIDTH || y > Hor[x])
+		return;
+	if(Next && y < Next[x])
+		Next[x] = y < 0 ? 0 : y;
+	if(Trace)
+		return;
+#endif
+	ST7735_DrawPixel(x, y, color);
+}
+
+// Slightly modified Bresenham's algorithm, between projected points
+void makeLine(int16_t cx, int16_t cy, int16_t cx1, int16_t cy1, uint16_t color) {
 	int8_t	dx, dy;
 	int8_t	incx, incy;
 	int8_t	balance;
@@ -138,7 +418,7 @@ void makeLine(int8_t x, int8_t y, int8_t z, int8_t x1, int8_t y1, int8_t z1, uin
 		dx <<= 1;
 
 		while (cx != cx1) {
-			ST7735_DrawPixel(cx, cy, color);
+			plot(cx, cy, color);
 			if (balance >= 0) {
 				cy += incy;
 				balance -= dx;
@@ -146,7 +426,7 @@ void makeLine(int8_t x, int8_t y, int8_t z, int8_t x1, int8_t y1, int8_t z1, uin
 			balance += dy;
 			cx += incx;
 		}
-		ST7735_DrawPixel(cx, cy, color);
+		plot(cx, cy, color);
 	}
 	else {
 		dx <<= 1;
@@ -154,7 +434,7 @@ void makeLine(int8_t x, int8_t y, int8_t z, int8_t x1, int8_t y1, int8_t z1, uin
 		dy <<= 1;
 
 		while (cy != cy1) {
-			ST7735_DrawPixel(cx, cy, color);
+			plot(cx, cy, color);
 			if (balance >= 0) {
 				cx += incx;
 				balance -= dy;
@@ -162,79 +442,377 @@ void makeLine(int8_t x, int8_t y, int8_t z, int8_t x1, int8_t y1, int8_t z1, uin
 			balance += dx;
 			cy += incy;
 		} 
-		ST7735_DrawPixel(cx, cy, color);
+		plot(cx, cy, color);
 	}
 }
 #endif
+#endif
 
 #if Perlin == 1
-void runTerrain(void) {
+// Detail at each quality level: rows drawn, noise octaves for new rows,
+// and whether the plain wireframe's old frame is cleared with one window
+// instead of being erased line by line, which is cheaper on the bus but
+// flickers
+#define LEVELS 4
+const static uint8_t ViewRows[LEVELS] = {GRID*8, GRID*10, GRID*12, ZSTRIP};
+const static uint8_t Octaves[LEVELS] = {1, 2, 3, 4};
+#if VOXEL == 0 && ANTIALIAS == 0
+const static uint8_t ClearAll[LEVELS] = {1, 1, 0, 0};
+#endif
+
+#if ANTIALIAS == 1 && VOXEL == 0
+int16_t lastTop = ST7735_TFTHEIGHT;
+
+// Wireframe color of a strip whose near row is at depth, fading out
+// towards FARDEPTH
+uint16_t fadeColor(int16_t depth){
+	int16_t f = (depth - 2)*(ZSTRIP - 2)/(FARDEPTH - 2);
+	return 0xFFFF - (f<<12) - (f<<7) - (f<<1);
+}
+
+// Send the lines of strip n to line. Strips 2 to ZSTRIP join the full
+// detail rows, and each coarse level adds LODROWS more, the first of them
+// stitched onto the last row of the level in front. A row at twice the
+// spacing has a point under every other point of the row in front, the
+// points between are joined to the far points on both sides of them.
+void stripLines(int16_t n, LineFunc line){
+	int16_t *ax, *ay, *bx, *by, x, c, depth = n;
+	uint16_t color;
+	uint8_t seam = 0;
+#if LODS > 1
+	if(n > ZSTRIP){
+		int16_t k = (n - ZSTRIP - 1)/LODROWS, r = (n - ZSTRIP - 1)%LODROWS;
+		bx = LodX[k][r];
+		by = LodY[k][r];
+		if(r){
+			ax = LodX[k][r-1];
+			ay = LodY[k][r-1];
+			depth = LodDepth[k][r-1];
+		}
+		else if(k){
+			ax = LodX[k-1][LODROWS-1];
+			ay = LodY[k-1][LODROWS-1];
+			depth = LodDepth[k-1][LODROWS-1];
+			seam = 1;
+		}
+		else{
+			ax = ScreenX[ZSTRIP+1];
+			ay = ROWY(flip, ZSTRIP);
+			seam = 1;
+		}
+	}
+	else
+#endif
+	{
+		ax = ScreenX[n];
+		ay = ROWY(flip, n-1);
+		bx = ScreenX[n+1];
+		by = ROWY(flip, n);
+	}
+	color = fadeColor(depth);
+	if(!seam){
+		for(x = 0; x < XSTRIP - 1; x++){
+			line(ax[x], ay[x], ax[x+1], ay[x+1], color);
+			line(ax[x], ay[x], bx[x], by[x], color);
+			line(ax[x], ay[x], bx[x+1], by[x+1], color);
+		}
+		return;
+	}
+	for(x = 0; x < XSTRIP; x++){
+		// Far point at or just left of near point x, both rows are
+		// centered on column XSTRIP/2
+		c = (x - XSTRIP/2 + XSTRIP)/2;
+		if(x < XSTRIP - 1)
+			line(ax[x], ay[x], ax[x+1], ay[x+1], color);
+		line(ax[x], ay[x], bx[c], by[c], color);
+		if((x - XSTRIP/2) & 1)
+			line(ax[x], ay[x], bx[c+1], by[c+1], color);
+	}
+}
+
+// Draw the mesh with Wu lines blended into the band buffer. Bands from
+// the highest point of this frame or the last down to the bottom of the
+// screen are cleared, drawn and sent whole, so nothing is erased line
+// by line and the far, dim rows fade smoothly into the black.
+// lods levels of detail are drawn, the coarse ones only behind a full
+// view of fine rows.
+void drawTerrainAA(uint8_t view, uint8_t lods){
+	int16_t x, z, top = ST7735_TFTHEIGHT, t, n, last = view;
+	for(z = 1; z <= view; z++){
+		int16_t *sy = ROWY(flip, z);
+		for(x = 0; x < XSTRIP; x++){
+			if(sy[x] < top)
+				top = sy[x];
+		}
+	}
+#if LODS > 1
+	if(lods > 1){
+		last = ZSTRIP + (lods-1)*LODROWS;
+		for(n = 0; n < (lods-1)*LODROWS; n++){
+			int16_t *sy = LodY[n/LODROWS][n%LODROWS];
+			for(x = 0; x < XSTRIP; x++){
+				if(sy[x] < top)
+					top = sy[x];
+			}
+		}
+	}
+#endif
+	top--;
+	t = top < lastTop ? top : lastTop;
+	lastTop = top;
+	if(t < 0) t = 0;
+#if HIDDEN == 1
+	// Walk the mesh once without drawing to find each strip's horizon,
+	// the bands then only blend the pixels in front of it
+	Trace = 1;
+	memset(Horizon[flip][2], ST7735_TFTHEIGHT, ST7735_TFTWIDTH);
+	for(n = 2; n <= last; n++){
+		beginStrip(n);
+		stripLines(n, makeLine);
+	}
+	Trace = 0;
+#endif
+	for(; t < ST7735_TFTHEIGHT; t += BAND_ROWS){
+		Band_Begin(t, 0x0000);
+		for(n = 2; n <= last; n++){
+		#if HIDDEN == 1
+			Band_SetHorizon(horizonAt(n));
+		#endif
+			stripLines(n, Band_LineAA);
+		}
+		Band_Flush(0, BAND_W - 1);
+	}
+#if HIDDEN == 1
+	Band_SetHorizon(0);
+#endif
+}
+#endif
+
+#if VOXEL == 1
+// Highest row each screen column filled last frame, the sky above this
+// frame's terrain is only cleared where the old terrain reached
+int16_t VoxelTop[ST7735_TFTWIDTH];
+
+// Highest row filled so far in each screen column, and the height last
+// sampled there
+int16_t VoxelBuf[ST7735_TFTWIDTH], VoxelLast[ST7735_TFTWIDTH];
+
+// Add one row of the heightmap to the y-buffer. Each screen column only
+// gets the part that shows above what nearer rows filled, sent as one
+// vertical span.
+// Input: row    heights, XSTRIP points spacing grid columns apart
+//        d      depth counted like z+1 of a full detail row
+//        level  level of detail, points are 2^level grid columns apart
+//        first  1 for the nearest row, which has nothing to shade against
+void voxelRow(const int8_t *row, int16_t d, uint8_t level, uint8_t first){
+	int16_t x, sy, lit, h, depth = d*ZSCALE - View.z;
+	// Dim the far rows like the wireframe does
+	int16_t fade = 256 - (d-2)*192/FARDEPTH;
+	int32_t g, step;
+	if(depth < 1)
+		depth = 1;
+	// Row point under screen column 0, and the step per screen column,
+	// with 16 fractional bits
+	step = ((int32_t)depth << 16)/(View.focal*(SCALE << level));
+	g = ((int32_t)(XSTRIP/2) << 16) + ((int32_t)View.x << 16)/(SCALE << level) - View.cx*step;
+	for(x = 0; x < ST7735_TFTWIDTH; x++, g += step){
+		int16_t i = g >> 16;
+		if(i < 0 || i >= XSTRIP - 1 || VoxelBuf[x] == 0)
+			continue;
+		// Height between the two row points, 4 fractional bits
+		h = HEIGHT((row[i] << 4) + (((row[i+1] - row[i]) * ((g >> 8) & 0xFF)) >> 4));
+		sy = View.cy + ((Camera_Scale(&View, h - (View.y << 4), depth) + 8) >> 4);
+		if(first)
+			VoxelLast[x] = h;
+		if(sy < 0)
+			sy = 0;
+		if(sy < VoxelBuf[x]){
+			// Ground rising away from the viewer faces it and is lit,
+			// coarse rows are further apart so rise further
+			lit = 16 + ((VoxelLast[x] - h) >> (3 + level));
+			if(lit < 4) lit = 4;
+			if(lit > 31) lit = 31;
+			lit = (lit*fade) >> 8;
+			ST7735_DrawFastVLine(x, sy, VoxelBuf[x] - sy, (lit << 11) | (lit << 6) | lit);
+			VoxelBuf[x] = sy;
+		}
+		VoxelLast[x] = h;
+	}
+}
+
+// Fill the terrain front to back into a y-buffer. The work is a fixed
+// number of samples per screen column, however many grid cells the view
+// holds, and the coarse levels of detail carry it further out.
+void drawTerrainVoxel(uint8_t view, uint8_t lods){
 	int16_t x, z;
-	int i, j;
-	int ioff = ZSTRIP * 40;
+	for(x = 0; x < ST7735_TFTWIDTH; x++){
+		VoxelBuf[x] = ST7735_TFTHEIGHT;
+	}
+	for(z = 1; z <= view; z++){
+		voxelRow(ROW(z), z+1, 0, z == 1);
+	}
+#if LODS > 1
+	for(z = 0; z < (lods-1)*LODROWS; z++){
+		voxelRow(LodRow[z/LODROWS][z%LODROWS], LodDepth[z/LODROWS][z%LODROWS], z/LODROWS + 1, 0);
+	}
+#endif
+	for(x = 0; x < ST7735_TFTWIDTH; x++){
+		if(VoxelTop[x] < VoxelBuf[x])
+			ST7735_DrawFastVLine(x, VoxelTop[x], VoxelBuf[x] - VoxelTop[x], 0x0000);
+		VoxelTop[x] = VoxelBuf[x];
+	}
+}
+#endif
+
+void runTerrain(void) {
+	uint8_t level, view;
+#if VOXEL == 1
+	int16_t x;
+	uint8_t lods;
+#elif ANTIALIAS == 1
+	int16_t z;
+	uint8_t lods;
+#else
+	int16_t x, z, z1;
+	// Nothing has been drawn yet, so the first frame erases nothing
+	uint8_t lastView = 0, erase;
+#endif
+	Quality_Init(FRAMEMS, LEVELS - 1);
+#if VOXEL == 0
+	projectColumns();
+#endif
+#if VOXEL == 1
+	for(x = 0; x < ST7735_TFTWIDTH; x++){
+		VoxelTop[x] = ST7735_TFTHEIGHT;
+	}
+#endif
 	while(1) {
-		int16_t z1;
-		/*setAddrWindow(0, 40, 128, 160);
-		for(z = 0; z < 128*120; z++){
-			pushColor(0);
-		}*/
+		level = Quality_Level;
+		view = ViewRows[level];
+	#if VOXEL == 1 || ANTIALIAS == 1
+		// Coarse levels carry on from a full view of fine rows
+		lods = (view == ZSTRIP) ? LODS : 1;
+	#else
+		erase = !ClearAll[level];
+	#endif
+		Camera_Begin(&View);
+	#if LODS > 1
+		updateLods(Octaves[level]);
+	#endif
+	#if VOXEL == 1
+		drawTerrainVoxel(view, lods);
+	#else
+		// Every row moved one closer, project each one once for this frame
+		for(z = 1; z <= view; z++){
+			projectRow(z);
+		}
+	#if ANTIALIAS == 1
+	#if LODS > 1
+		projectLods(lods);
+	#endif
+		drawTerrainAA(view, lods);
+	#else
+		if(!erase){
+			setAddrWindow(0, 40, 127, 159);
+			for(z = 0; z < 128*120; z++){
+				pushColor(0);
+			}
+		}
+	#if HIDDEN == 1
+		memset(Horizon[flip][2], ST7735_TFTHEIGHT, ST7735_TFTWIDTH);
+	#endif
 		for(z = 2; z <= ZSTRIP; z++){
 			uint16_t color = 0xFFFF - ((z-2)<<12) - ((z-2)<<7) - ((z-2)<<1);
+			int16_t *nx = ScreenX[z], *ny = ROWY(flip, z-1), *fx = ScreenX[z+1], *fy = ROWY(flip, z);
+			int16_t *ax, *ay, *bx, *by;
 			if(z > 30)
 				color = 0x0000;
-			for(x = -XSTRIP/2; x < XSTRIP/2 - 1; x++) {
-				if((z * 2) <= ZSTRIP + 2){
+		#if HIDDEN == 1
+			if(z <= view)
+				beginStrip(z);
+		#endif
+			for(x = 0; x < XSTRIP - 1; x++) {
+				// Rows drawn last frame have moved one closer, erase them
+				// where they were drawn, from last frame's projections
+				if(erase && (z * 2) <= ZSTRIP + 2 && (z - 2) * 2 + 2 <= lastView){
 					z1 = (z - 2) * 2;
-					makeLine(x*SCALE, terrain[z1][x+XSTRIP/2], (z1+2)*ZSCALE, (x+1)*SCALE, terrain[z1][(x+1)+XSTRIP/2],     (z1+2)*ZSCALE, 0x0000);
-					makeLine(x*SCALE, terrain[z1][x+XSTRIP/2], (z1+2)*ZSCALE,     x*SCALE,       terrain[z1+1][x+XSTRIP/2], (z1+3)*ZSCALE, 0x0000);
-					makeLine(x*SCALE, terrain[z1][x+XSTRIP/2], (z1+2)*ZSCALE, (x+1)*SCALE,   terrain[z1+1][(x+1)+XSTRIP/2], (z1+3)*ZSCALE, 0x0000);	
+				#if HIDDEN == 1
+					// Last frame's strip z1+2, behind last frame's horizon
+					Hor = Horizon[!flip][z1+2];
+					Next = 0;
+				#endif
+					ax = ScreenX[z1+2];
+					ay = ROWY(!flip, z1);
+					bx = ScreenX[z1+3];
+					by = ROWY(!flip, z1+1);
+					makeLine(ax[x], ay[x], ax[x+1], ay[x+1], 0x0000);
+					makeLine(ax[x], ay[x], bx[x],   by[x],   0x0000);
+					makeLine(ax[x], ay[x], bx[x+1], by[x+1], 0x0000);
 					z1 += 1;
-					makeLine(x*SCALE, terrain[z1][x+XSTRIP/2], (z1+2)*ZSCALE, (x+1)*SCALE, terrain[z1][(x+1)+XSTRIP/2],     (z1+2)*ZSCALE, 0x0000);
-					makeLine(x*SCALE, terrain[z1][x+XSTRIP/2], (z1+2)*ZSCALE,     x*SCALE,       terrain[z1+1][x+XSTRIP/2], (z1+3)*ZSCALE, 0x0000);
-					makeLine(x*SCALE, terrain[z1][x+XSTRIP/2], (z1+2)*ZSCALE, (x+1)*SCALE,   terrain[z1+1][(x+1)+XSTRIP/2], (z1+3)*ZSCALE, 0x0000);
+					if(z1 + 2 <= lastView){
+					#if HIDDEN == 1
+						Hor = Horizon[!flip][z1+2];
+					#endif
+						ax = bx;
+						ay = by;
+						bx = ScreenX[z1+3];
+						by = ROWY(!flip, z1+1);
+						makeLine(ax[x], ay[x], ax[x+1], ay[x+1], 0x0000);
+						makeLine(ax[x], ay[x], bx[x],   by[x],   0x0000);
+						makeLine(ax[x], ay[x], bx[x+1], by[x+1], 0x0000);
+					}
 				}
 			  
-				makeLine(x*SCALE, terrain[z-1][x+XSTRIP/2], z*ZSCALE, (x+1)*SCALE, terrain[z-1][(x+1)+XSTRIP/2],     z*ZSCALE, color);
-				makeLine(x*SCALE, terrain[z-1][x+XSTRIP/2], z*ZSCALE,     x*SCALE,       terrain[z][x+XSTRIP/2], (z+1)*ZSCALE, color);
-				makeLine(x*SCALE, terrain[z-1][x+XSTRIP/2], z*ZSCALE, (x+1)*SCALE,   terrain[z][(x+1)+XSTRIP/2], (z+1)*ZSCALE, color);
-			}
-		}
-		/*for(x = -XSTRIP/2; x < XSTRIP/2 - 1; x++) {
-			makeLine(x*SCALE, terrain[z-1][x+XSTRIP/2], z*ZSCALE, (x+1)*SCALE, terrain[z-1][(x+1)+XSTRIP/2], z*ZSCALE, 0xFFFF - ((ZSTRIP+1)<<12) - ((ZSTRIP+1)<<7) - ((ZSTRIP+1)<<1));
-		}*/
-		/*
-		for(z = 2; z <= ZSTRIP; z++){
-			for(x = -XSTRIP/2; x < XSTRIP/2 - 1; x++) {
-				makeLine(x*SCALE, terrain[z-1][x+XSTRIP/2], z*ZSCALE, (x+1)*SCALE, terrain[z-1][(x+1)+XSTRIP/2],     z*ZSCALE, 0xFFFF);
-				makeLine(x*SCALE, terrain[z-1][x+XSTRIP/2], z*ZSCALE,     x*SCALE,       terrain[z][x+XSTRIP/2], (z+1)*ZSCALE, 0xFFFF);
-				makeLine(x*SCALE, terrain[z-1][x+XSTRIP/2], z*ZSCALE, (x+1)*SCALE,   terrain[z][(x+1)+XSTRIP/2], (z+1)*ZSCALE, 0xFFFF);
-			}
-		}*/
-	
-		for(i = 1; i <= ZSTRIP; i++){
-			for(j = 0; j < XSTRIP; j++){
-				terrain[i-1][j] = terrain[i][j];
+				if(z <= view){
+				#if HIDDEN == 1
+					Hor = Horizon[flip][z];
+					Next = Horizon[flip][z+1];
+				#endif
+					makeLine(nx[x], ny[x], nx[x+1], ny[x+1], color);
+					makeLine(nx[x], ny[x], fx[x],   fy[x],   color);
+					makeLine(nx[x], ny[x], fx[x+1], fy[x+1], color);
+				}
 			}
 		}
-		for(j = 0; j < XSTRIP; j++){
-				terrain[ZSTRIP][j] = perlin2d(j * 20, ioff++, 3, 22)/90000;
-		}
-		//Delay1ms(100);
+	#endif
+	#endif
+
+		// Every frame pays for the rows it uses on average, the queue
+		// absorbs the coarse rows that fall due on the same frame
+		generateAhead(STEADY, Octaves[level]);
+		scrollRow(Octaves[level]);
+		flip ^= 1;
+		// Work ahead in the slack until the next frame is nearly due,
+		// without counting it as load
+		Frame_Done();
+		while(Frame_Left() > 1 && generateAhead(SLICE, Octaves[level]));
+		// One row scrolls in per frame, the erase pass relies on it, so an
+		// overrun slows the scroll instead of skipping rows
+		Frame_Wait();
+	#if VOXEL == 0 && ANTIALIAS == 0
+		lastView = view;
+	#endif
+		Quality_Update(Frame_Busy);
 	
 	}
 }
 #endif
 int main(void){
   PLL_Init(Bus80MHz);                  // set system clock to 80 MHz
+	Fpu_Init();                          // float stages and lazy stacking
   ST7735_InitR(INITR_REDTAB);
 	//Wait here then run demo
 	#if Perlin == 1
-		int i, j;
+		int i;
+		Camera_Init(&View, 0, -24, 0, FZ, 64, 55);
 		for(i = 0; i <= ZSTRIP; i++){
-			for(j = 0; j < XSTRIP; j++){
-				terrain[i][j] = perlin2d(j * 20, i, 3, 22)/90000; //110000
-			}
+			wholeRow(terrain[i], NOISEX, NOISESTEP, i * NOISESTEP, 4);
 		}
+	#if LODS > 1
+		updateLods(4);
+	#endif
+		while(generateAhead(XSTRIP, 4));
+		Frame_Init(80000000, FRAMEMS);   // frames start every FRAMEMS ms
 		runTerrain();
 	#endif
 	return 1;
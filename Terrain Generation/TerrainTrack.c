@@ -0,0 +1,884 @@
+// TerrainTrack.c
+// Runs on TM4C123
+// Generated by Host/BakeTerrain.c, do not edit.
+
+#include <stdint.h>
+#include "Track.h"
+#include "TerrainTrack.h"
+
+static const uint8_t TrackData[19842] = {
+	90,211,92,136,190,127,52,74,104,145,53,147,228,68,36,219,108,130,181,246,87,241,104,69,
+	180,107,30,133,235,117,68,137,31,21,90,200,75,34,248,128,151,148,159,86,141,114,113,31,
+	213,106,162,234,168,172,171,203,170,180,184,202,41,148,45,201,194,217,82,232,169,107,150,212,
+	166,84,114,230,130,187,239,248,68,225,16,137,163,76,107,123,228,153,196,136,165,11,118,114,
+	95,121,29,178,164,197,9,18,50,156,162,218,45,197,101,217,173,255,128,66,154,152,149,173,
+	34,16,253,122,116,42,41,173,74,214,68,89,219,224,173,91,101,43,155,33,79,71,71,161,
+	77,103,149,146,43,209,52,84,104,155,128,251,20,84,72,148,157,194,81,77,35,242,85,215,
+	124,59,68,120,148,228,76,70,232,173,235,68,136,109,53,149,105,135,247,202,136,179,39,92,
+	203,64,220,130,158,215,159,144,152,167,8,178,17,81,165,73,41,17,88,215,236,215,98,145,
+	75,112,137,45,168,139,83,102,246,66,162,37,37,173,137,112,146,71,66,181,20,212,93,81,
+	9,174,100,180,148,180,237,37,39,169,209,70,80,166,73,249,70,139,154,197,52,85,233,218,
+	213,85,167,47,84,146,237,32,36,181,196,242,225,66,170,168,137,149,146,217,39,206,70,66,
+	209,164,132,146,202,196,162,114,38,57,118,114,137,35,114,78,132,43,60,208,199,179,25,210,
+	206,122,106,105,84,163,182,181,220,227,34,200,226,139,174,19,73,38,255,90,71,167,235,73,
+	146,153,81,34,209,146,40,100,230,173,17,88,148,149,45,16,38,92,241,110,229,170,78,82,
+	76,143,47,56,94,210,141,23,90,137,17,34,134,34,105,72,166,190,17,178,139,79,210,246,
+	89,55,69,24,83,219,82,240,237,217,187,52,147,118,241,30,211,217,22,21,137,78,103,38,
+	208,147,108,246,196,70,227,201,26,78,47,180,84,81,162,19,50,253,201,65,16,130,72,181,
+	44,160,151,20,232,164,213,122,124,74,218,69,174,157,37,165,50,151,242,242,92,71,222,41,
+	196,107,241,78,78,196,157,146,53,200,165,218,23,210,128,248,184,138,11,52,51,117,205,207,
+	221,158,226,208,151,175,233,228,41,187,61,11,25,204,138,75,183,154,100,132,82,236,142,237,
+	20,42,148,161,230,218,145,45,54,213,145,101,232,84,137,72,68,213,54,181,157,68,73,118,
+	203,18,38,209,81,36,233,226,153,33,37,191,102,143,139,45,201,83,83,42,37,192,68,227,
+	180,143,71,187,83,181,43,42,76,152,209,81,221,115,85,147,180,141,50,222,169,56,167,21,
+	215,115,150,201,9,68,83,138,210,233,44,241,208,180,88,132,36,147,155,46,17,58,103,160,
+	86,77,103,87,37,177,19,106,163,106,242,122,22,138,116,191,132,75,229,11,116,182,228,144,
+	69,198,205,128,213,150,168,234,197,178,38,146,137,180,157,146,232,167,40,137,221,18,253,87,
+	245,213,41,70,162,250,23,162,57,168,213,166,178,142,18,90,88,178,196,106,242,40,172,155,
+	37,163,168,248,142,93,215,238,137,52,34,143,166,175,17,94,107,104,68,102,162,73,39,103,
+	154,168,180,139,209,228,182,72,128,34,225,19,111,105,188,36,233,226,134,150,91,150,145,106,
+	75,253,156,79,53,164,18,73,204,136,136,67,108,162,8,163,235,37,146,36,165,170,36,245,
+	73,241,0,164,232,156,18,139,210,110,153,71,45,38,214,155,72,146,117,35,147,110,104,164,
+	101,203,170,201,178,74,119,47,226,178,58,81,172,179,37,196,244,155,118,42,70,51,246,75,
+	18,122,228,17,36,145,22,69,77,68,145,40,148,68,170,72,164,234,73,8,187,188,154,72,
+	146,41,113,58,25,162,240,179,252,144,150,164,94,36,169,122,69,23,203,215,39,84,156,251,
+	93,118,138,156,165,37,174,186,73,50,186,46,127,106,121,91,34,147,73,82,56,146,43,38,
+	109,19,168,36,148,43,17,42,147,83,60,135,156,230,74,166,149,23,22,100,20,72,218,134,
+	231,9,247,104,199,98,109,101,71,116,57,61,166,128,70,247,40,187,71,8,142,239,149,43,
+	52,46,54,144,171,114,109,42,115,90,211,104,222,78,17,144,163,73,196,95,8,147,29,75,
+	140,72,150,75,145,36,139,94,150,83,84,151,84,91,68,215,197,157,112,182,177,115,169,59,
+	22,155,178,154,187,209,63,74,93,171,163,139,71,68,171,76,162,228,116,69,63,156,168,222,
+	114,201,27,108,206,110,53,21,90,148,144,132,35,241,169,38,73,18,36,148,137,228,34,33,
+	57,182,178,39,33,155,42,219,239,183,192,137,24,174,34,150,68,175,181,108,161,88,147,40,
+	154,242,150,183,109,162,242,85,214,89,92,87,210,218,203,212,100,19,137,82,144,184,73,104,
+	183,0,36,73,172,177,69,232,73,137,41,118,58,81,20,133,157,132,205,53,92,113,36,108,
+	164,223,22,68,105,185,243,68,150,237,41,122,37,162,34,82,204,72,209,128,89,71,187,183,
+	150,105,13,202,34,73,34,47,84,41,73,73,146,121,39,196,226,69,149,38,98,37,145,74,
+	23,21,169,206,89,230,118,225,182,149,69,152,185,94,145,173,36,212,186,209,76,165,165,90,
+	45,203,204,170,202,85,43,213,210,154,185,162,105,95,148,148,156,90,113,119,200,202,105,64,
+	141,9,34,83,44,73,8,145,103,45,52,218,108,228,102,235,132,178,111,201,44,66,217,90,
+	222,179,109,171,247,60,237,205,164,33,123,105,178,152,122,104,168,178,107,117,188,83,63,228,
+	188,156,121,72,209,43,147,133,113,89,238,204,167,127,38,36,196,166,19,132,73,38,82,78,
+	106,77,148,41,21,242,171,32,221,34,117,53,42,163,86,146,142,93,39,34,208,236,37,147,
+	81,203,72,109,63,182,78,92,124,251,73,138,35,162,107,111,37,125,52,139,59,128,22,181,
+	162,148,179,217,188,66,196,123,117,21,166,65,109,206,195,162,90,230,92,40,147,146,137,34,
+	66,40,139,164,189,199,161,34,83,234,33,108,53,17,18,162,84,181,95,106,165,147,154,185,
+	42,141,46,21,172,107,165,226,206,202,58,20,235,85,84,85,107,39,26,100,137,238,91,80,
+	170,139,208,162,42,62,116,81,159,148,210,155,41,100,146,155,17,17,112,174,153,35,116,90,
+	157,9,15,132,72,219,70,230,54,126,150,181,90,36,68,211,224,139,117,0,165,110,17,36,
+	105,21,205,148,226,147,134,186,45,217,243,106,37,50,142,36,167,18,174,237,68,66,38,137,
+	76,181,178,203,43,126,240,136,213,179,84,217,46,37,15,150,175,66,73,235,212,153,167,73,
+	70,72,111,229,36,171,203,106,89,50,233,69,54,227,20,212,87,50,99,85,45,17,53,84,
+	242,165,62,179,124,65,84,119,201,73,154,68,9,61,251,34,214,72,163,126,106,241,47,54,
+	50,191,218,146,41,40,92,68,81,82,30,74,27,150,242,42,192,137,213,196,226,121,85,40,
+	135,170,59,85,50,202,197,59,181,118,146,212,174,19,149,110,180,213,17,91,178,157,22,213,
+	196,225,59,169,48,107,245,180,36,150,132,66,33,34,196,16,182,72,231,146,17,5,66,46,
+	148,146,209,62,141,150,42,42,156,41,106,114,220,19,120,226,242,33,182,136,136,40,149,161,
+	0,47,36,203,220,121,31,47,105,251,75,46,113,56,122,22,201,77,159,115,73,164,209,8,
+	237,218,35,113,118,43,185,34,79,194,204,69,183,235,88,147,64,228,150,186,66,201,76,170,
+	89,104,139,197,168,200,175,154,188,146,73,105,79,87,121,73,40,233,34,202,203,110,46,122,
+	178,170,239,85,169,128,124,137,109,102,254,219,74,63,54,108,153,145,120,153,179,73,178,45,
+	191,60,169,114,164,22,207,198,211,117,79,245,31,17,42,95,9,61,102,252,139,178,164,174,
+	165,73,28,188,87,35,242,197,50,157,171,226,154,101,23,59,73,213,113,116,150,185,169,172,
+	147,85,52,142,164,113,118,164,140,141,41,66,50,41,234,93,196,188,45,202,72,75,9,81,
+	16,181,50,155,132,219,233,171,236,68,72,168,83,69,132,155,44,233,164,60,186,94,245,232,
+	148,152,163,99,144,152,146,159,179,145,47,47,133,159,77,137,78,155,137,47,36,46,236,185,
+	21,255,205,8,229,245,146,138,241,78,73,209,9,67,141,30,74,237,102,34,71,85,220,164,
+	74,74,229,246,43,90,38,149,89,28,90,98,239,239,95,105,174,164,155,36,213,162,217,121,
+	71,38,164,57,192,101,57,56,138,246,137,25,42,166,212,242,121,51,18,183,54,69,88,153,
+	234,49,77,81,19,202,122,36,239,147,130,164,217,19,220,133,119,165,239,32,160,182,184,210,
+	225,150,181,45,215,203,153,43,74,126,213,111,180,104,90,60,73,107,225,74,10,191,173,38,
+	72,250,98,76,187,11,73,22,156,139,48,36,209,24,253,25,200,166,191,82,124,92,138,254,
+	27,163,74,105,49,185,54,245,10,154,133,153,10,155,66,20,86,102,108,196,113,45,79,41,
+	16,140,144,136,136,128,197,141,36,45,44,165,69,229,58,46,155,230,73,68,162,42,109,121,
+	24,166,144,147,33,52,100,44,166,245,17,156,165,43,165,168,181,184,244,228,222,240,241,47,
+	68,167,148,210,81,77,90,92,158,159,39,20,249,63,34,116,153,43,124,82,229,124,236,165,
+	174,159,145,62,151,20,212,91,41,25,192,140,66,87,145,19,75,123,43,115,97,110,74,105,
+	196,248,165,18,242,156,148,141,183,58,254,41,184,19,239,92,90,72,180,68,67,57,84,44,
+	243,156,128,89,50,68,110,181,114,124,164,70,145,173,35,165,62,242,253,114,149,148,95,201,
+	115,172,70,79,38,81,39,133,246,92,90,175,71,145,39,38,160,45,109,163,199,105,44,174,
+	34,229,160,138,72,164,133,56,169,15,34,209,53,76,137,17,84,150,151,149,11,18,74,133,
+	34,100,114,56,196,158,60,150,74,109,0,103,21,37,114,79,232,158,142,160,255,102,255,212,
+	122,164,22,247,5,105,219,103,185,203,201,56,188,223,243,218,237,18,172,139,197,184,186,18,
+	222,184,158,178,114,245,41,149,85,114,250,94,233,213,26,23,89,27,22,232,85,164,235,150,
+	74,234,19,84,185,219,148,106,46,58,228,74,30,84,85,26,83,127,162,202,93,22,166,248,
+	164,243,98,17,90,252,165,215,43,122,90,38,49,45,126,145,114,241,47,252,158,104,175,100,
+	120,139,42,201,28,74,225,122,151,38,142,232,173,87,20,136,230,172,82,201,236,69,196,148,
+	163,85,251,69,163,146,95,53,148,148,138,73,164,156,160,67,144,123,180,132,137,73,175,185,
+	147,41,75,91,103,181,207,42,244,218,34,215,34,242,111,125,161,77,35,57,67,214,78,211,
+	74,182,36,212,151,152,44,66,100,132,138,85,98,246,139,141,34,86,43,136,144,162,36,86,
+	138,150,146,200,88,118,137,72,189,44,147,210,188,87,194,52,146,23,142,19,9,63,67,36,
+	181,14,85,73,169,39,41,60,162,114,203,211,93,76,175,75,107,42,169,24,164,151,28,149,
+	197,119,241,114,147,154,212,38,202,77,114,218,141,173,232,249,213,148,168,145,39,54,137,178,
+	38,205,241,170,142,44,145,108,155,136,150,228,99,84,83,37,84,107,202,210,83,230,179,140,
+	102,236,87,0,228,165,101,122,154,255,74,150,220,38,35,197,18,171,17,201,94,103,19,136,
+	236,249,74,202,242,228,150,38,66,81,147,95,201,10,137,74,93,168,157,233,45,218,244,85,
+	169,176,148,235,169,249,107,124,19,82,71,162,101,185,30,150,147,214,183,140,165,122,147,92,
+	209,168,136,179,106,228,71,144,75,145,121,19,83,127,113,11,34,105,238,116,230,34,179,123,
+	54,130,154,172,186,82,250,164,36,236,169,174,179,77,233,18,68,233,17,10,111,90,16,139,
+	93,74,245,20,154,162,210,211,189,114,226,138,156,189,82,71,84,39,83,46,147,202,248,83,
+	161,103,85,115,178,185,85,253,36,128,17,10,25,173,37,30,76,227,218,85,21,194,169,40,
+	89,101,73,54,125,51,122,19,77,116,165,60,137,52,76,231,52,137,180,109,100,206,49,82,
+	248,68,40,122,20,66,150,201,226,162,65,18,125,38,181,137,77,184,143,58,101,34,177,36,
+	178,145,242,101,82,51,121,23,136,187,44,94,81,172,139,81,110,164,71,224,205,83,119,247,
+	93,44,157,147,196,175,114,110,105,103,117,71,165,26,73,39,203,121,105,220,85,46,41,34,
+	153,71,18,154,235,76,181,147,47,73,75,201,98,92,25,250,140,136,126,110,153,18,16,162,
+	86,37,165,165,118,123,153,104,180,181,166,173,18,82,205,237,145,69,188,228,73,102,177,81,
+	128,139,169,73,165,173,39,10,39,86,148,162,147,106,19,82,92,166,36,242,234,85,165,94,
+	157,83,139,71,106,23,90,247,37,168,78,20,181,0,158,138,95,25,186,139,246,183,156,180,
+	88,136,155,155,155,208,133,179,43,34,44,221,137,36,235,123,157,20,196,220,162,74,165,33,
+	41,39,207,91,52,77,58,23,37,218,82,32,146,201,111,230,203,218,37,17,83,255,136,169,
+	161,26,21,122,208,90,81,98,109,93,77,4,211,111,190,215,36,79,34,224,156,229,221,217,
+	50,201,26,150,104,156,91,38,109,84,228,147,211,118,150,82,170,232,217,68,227,83,81,71,
+	150,173,113,27,217,59,90,46,147,64,226,57,66,247,44,109,236,110,17,52,207,20,194,33,
+	39,207,16,169,34,45,86,235,153,36,41,35,126,178,161,156,82,22,109,167,21,9,8,139,
+	188,235,124,174,85,198,146,77,19,156,101,107,82,255,147,20,98,172,101,37,85,10,157,148,
+	214,43,87,23,146,117,165,197,77,21,170,152,165,165,105,96,20,197,34,69,162,17,20,36,
+	201,70,138,218,18,50,77,164,145,74,202,26,36,86,69,135,189,67,139,74,15,37,122,18,
+	83,122,142,156,252,151,234,164,33,40,229,104,250,147,174,240,164,216,161,127,177,89,18,110,
+	118,228,210,124,77,121,46,11,114,82,52,42,50,107,182,144,83,41,169,36,162,69,17,251,
+	240,164,164,82,228,72,185,226,163,69,125,17,146,229,95,42,19,56,190,242,70,215,19,107,
+	82,127,71,101,19,63,45,138,119,75,117,202,151,48,228,149,246,68,164,147,33,36,226,149,
+	82,84,130,140,254,46,85,142,166,180,66,40,145,145,17,112,165,187,223,188,138,33,84,68,
+	170,72,146,42,207,137,181,106,61,95,111,161,61,83,75,135,74,73,115,167,43,90,93,150,
+	190,89,86,166,200,180,122,190,181,105,83,78,212,83,23,228,192,181,10,196,236,245,200,118,
+	246,166,185,113,180,220,137,104,189,219,167,228,140,206,61,16,141,190,82,71,238,251,81,81,
+	38,167,251,149,46,203,99,165,52,133,196,252,180,45,45,33,40,95,33,110,174,39,13,201,
+	8,164,167,168,73,237,10,32,150,110,162,228,149,230,86,163,145,115,110,45,182,224,151,253,
+	21,211,41,63,139,83,93,180,233,181,17,231,19,212,249,149,98,245,26,62,17,197,183,10,
+	116,41,174,133,151,98,235,36,92,253,40,16,73,35,175,84,132,148,190,79,90,18,66,73,
+	34,41,98,120,175,66,120,222,224,146,85,17,73,98,162,145,77,22,53,193,51,239,72,207,
+	213,36,37,216,150,100,139,95,159,242,228,104,159,40,238,242,169,105,162,147,130,147,145,226,
+	164,147,173,209,39,205,202,18,201,104,94,149,77,33,109,87,114,137,141,121,125,106,103,52,
+	71,16,146,217,188,242,102,126,137,221,212,41,17,208,240,168,211,169,57,35,77,34,145,100,
+	67,203,145,228,207,86,174,213,160,50,72,151,70,145,82,133,84,191,77,72,180,81,17,33,
+	122,210,243,220,225,20,36,53,170,114,244,91,123,81,228,20,212,208,139,17,32,169,9,16,
+	137,72,128,226,142,210,119,66,167,180,85,229,201,186,82,85,71,66,70,89,92,67,162,39,
+	23,29,20,122,105,233,214,149,233,197,212,104,149,107,146,152,135,252,75,107,137,43,22,211,
+	58,45,84,169,91,249,16,144,169,127,149,156,71,164,245,208,245,205,72,145,22,164,83,204,
+	121,36,51,54,58,161,208,171,73,114,40,163,117,153,11,66,238,151,93,132,167,241,55,193,
+	57,90,76,151,116,172,138,178,90,172,209,50,231,66,82,230,40,133,59,43,16,243,230,126,
+	82,86,234,72,156,37,36,22,149,52,180,109,33,58,139,118,162,86,137,178,47,23,34,37,
+	78,72,83,35,138,89,91,27,91,20,249,84,18,33,41,196,142,168,91,243,124,159,240,235,
+	84,66,164,33,212,34,89,86,103,182,190,56,78,139,55,237,147,206,73,151,166,137,93,156,
+	158,148,61,128,141,84,79,83,92,132,242,125,10,106,47,83,85,115,47,73,36,230,154,150,
+	168,157,162,221,11,212,203,22,100,172,212,39,151,61,76,181,43,128,70,154,34,19,34,28,
+	150,158,87,73,38,231,242,223,145,48,137,114,154,111,145,102,219,137,8,221,100,43,252,103,
+	103,42,165,159,100,82,36,81,73,9,0,154,105,156,130,178,244,19,100,85,200,184,187,137,
+	244,94,77,122,84,90,139,118,41,218,152,146,246,180,21,36,82,178,186,184,92,114,68,245,
+	72,83,222,106,112,137,94,79,146,213,145,122,244,255,197,154,77,232,143,146,117,178,34,78,
+	36,114,147,110,126,153,73,139,55,40,111,69,164,249,78,16,114,132,45,10,19,213,57,68,
+	89,77,185,20,113,121,9,180,221,219,45,37,111,82,108,210,98,239,38,189,173,47,43,90,
+	157,8,178,226,35,153,94,141,74,196,171,84,136,213,46,117,217,39,21,82,241,109,69,74,
+	149,221,148,179,161,69,73,221,45,76,165,163,210,215,73,203,197,113,24,36,132,39,17,180,
+	146,72,132,41,202,133,151,194,68,165,94,69,85,137,30,110,245,181,213,20,146,242,41,84,
+	44,211,196,77,173,41,175,71,160,144,187,115,114,45,86,221,203,211,73,242,54,126,177,110,
+	84,113,75,197,217,124,78,17,19,185,205,35,208,242,178,90,156,94,72,181,162,76,254,147,
+	224,229,203,68,147,89,194,182,171,201,22,153,31,18,107,80,105,45,108,155,127,213,191,54,
+	244,196,90,90,57,184,158,144,183,167,164,91,200,209,36,218,36,68,37,142,218,42,73,45,
+	15,68,184,149,61,147,55,34,106,121,37,9,23,17,25,4,74,72,94,243,200,206,185,22,
+	154,109,137,8,91,54,92,45,135,249,16,169,149,90,154,139,117,109,84,78,52,185,165,74,
+	249,82,149,181,150,81,148,210,113,60,166,145,196,149,212,173,106,142,133,28,74,211,43,102,
+	113,40,187,242,43,71,27,82,165,197,43,36,66,139,8,171,41,215,71,137,157,179,158,186,
+	243,82,21,4,151,204,209,153,200,187,89,20,38,243,96,89,91,107,41,63,185,17,66,121,
+	243,74,230,69,250,59,58,20,236,208,143,90,228,148,68,182,66,233,94,38,158,147,36,167,
+	125,137,111,73,136,160,100,122,57,213,221,50,68,245,82,53,33,113,237,209,70,166,69,172,
+	196,217,104,215,45,42,177,74,148,162,76,165,165,213,146,46,58,245,121,48,18,146,91,32,
+	133,254,146,116,235,82,20,106,154,41,241,36,75,102,153,10,32,162,133,123,221,249,36,125,
+	218,177,180,144,151,162,19,226,170,107,132,140,138,46,164,189,103,174,46,40,202,81,108,83,
+	89,77,66,134,181,47,107,36,250,175,106,82,187,166,89,76,88,173,35,44,163,148,154,138,
+	201,96,56,86,162,186,70,138,90,46,82,36,202,29,45,18,137,183,149,204,188,163,85,56,
+	74,124,138,145,231,223,104,93,155,72,164,77,73,36,82,68,176,92,79,73,52,106,94,203,
+	197,255,98,75,72,74,147,203,38,150,40,175,47,144,156,156,201,207,105,18,17,92,42,43,
+	79,205,217,167,183,123,113,48,175,167,102,147,106,95,160,142,212,74,155,73,229,85,206,172,
+	165,169,209,35,121,45,39,169,14,40,183,161,113,83,166,214,149,220,169,172,192,18,213,77,
+	102,137,105,103,20,126,146,247,148,37,186,49,37,22,166,57,152,137,73,29,20,110,93,94,
+	173,196,179,26,34,66,20,127,26,177,19,108,217,64,154,92,83,147,20,229,47,47,201,58,
+	80,165,214,93,106,95,164,178,147,138,164,187,73,234,215,112,158,126,136,114,215,38,101,82,
+	149,104,217,100,235,40,215,178,137,209,121,21,57,62,186,40,136,199,145,54,178,201,109,32,
+	145,161,81,248,148,41,156,163,39,162,236,209,10,16,150,33,82,5,34,80,35,20,68,127,
+	78,212,168,215,5,235,73,89,104,68,165,162,214,164,20,83,133,204,138,84,161,69,141,149,
+	162,39,34,112,150,39,227,115,57,182,222,61,192,233,52,164,232,213,74,233,202,202,105,75,
+	202,74,90,173,226,68,212,165,174,234,213,53,165,37,41,83,92,73,33,149,204,93,94,202,
+	192,36,159,22,37,36,200,148,34,74,146,210,63,102,104,204,207,44,210,184,156,212,178,145,
+	79,205,71,236,132,54,175,240,249,67,137,105,123,103,46,103,138,192,171,78,153,38,177,92,
+	249,139,169,77,21,49,18,151,104,168,185,221,150,185,91,43,43,20,215,215,123,17,19,52,
+	238,58,68,113,63,165,96,91,196,136,161,44,164,244,253,146,164,142,75,212,34,89,77,226,
+	242,114,201,9,85,36,215,22,178,158,218,76,73,215,37,118,45,136,145,84,19,28,204,133,
+	180,251,255,101,51,146,215,141,171,100,145,189,250,52,159,124,44,246,222,75,114,178,41,30,
+	17,20,182,139,136,173,239,184,77,102,226,105,73,96,162,197,228,186,121,78,244,189,107,198,
+	170,106,20,153,209,113,103,190,95,20,173,73,50,156,38,142,137,75,40,180,236,174,132,158,
+	92,47,137,128,207,132,92,125,242,36,33,108,137,161,82,226,84,82,50,132,40,43,18,178,
+	38,221,40,145,237,200,68,146,153,145,18,155,19,214,105,13,179,69,116,213,50,16,128,177,
+	46,52,73,162,175,78,75,94,167,150,127,253,125,39,5,23,146,38,149,137,242,155,223,50,
+	78,35,52,154,70,75,210,106,23,25,20,153,53,144,95,147,52,202,68,168,114,133,104,229,
+	54,81,255,114,187,38,145,106,45,145,87,164,250,211,57,74,134,244,143,33,17,103,52,245,
+	207,146,254,104,145,15,158,137,183,179,209,230,191,33,89,210,90,228,140,132,84,198,247,11,
+	29,189,90,112,68,242,226,92,153,118,203,206,168,137,73,36,77,109,68,68,81,35,212,84,
+	158,94,153,73,171,85,204,173,212,93,197,222,185,111,75,78,39,41,81,197,49,95,26,138,
+	20,101,29,40,212,83,78,133,216,180,89,4,149,20,33,43,17,104,204,162,202,48,151,101,
+	16,174,76,196,72,139,36,66,149,104,133,81,146,103,165,111,11,210,118,136,162,200,89,194,
+	81,60,161,158,181,27,94,237,252,94,148,104,91,28,171,237,63,242,213,81,232,77,255,225,
+	53,47,50,249,209,74,217,22,175,52,106,153,109,102,147,130,228,225,77,61,18,150,100,68,
+	73,45,74,117,17,226,73,174,75,42,137,46,250,247,100,165,43,73,43,70,86,241,73,247,
+	226,187,154,106,146,208,64,74,34,210,123,31,51,51,126,247,177,113,9,53,155,57,39,164,
+	163,205,58,172,66,249,24,220,228,184,223,178,189,234,173,194,77,10,182,247,157,104,178,148,
+	106,40,200,180,237,109,74,79,85,66,120,171,165,170,178,84,214,89,209,54,83,136,226,250,
+	146,113,87,19,165,56,185,221,171,90,20,40,243,173,100,68,228,226,17,33,36,92,161,16,
+	137,9,171,230,145,40,165,251,173,8,146,70,210,137,98,73,9,80,132,146,22,239,52,67,
+	54,210,100,95,176,218,34,42,90,214,171,17,232,210,181,189,187,209,23,17,121,124,114,180,
+	37,51,186,81,113,46,40,221,54,41,232,163,33,73,228,133,47,132,205,88,149,133,17,34,
+	234,39,36,158,73,41,106,172,178,75,87,98,171,69,82,71,22,148,182,46,52,154,110,216,
+	170,115,253,40,79,34,169,194,154,76,209,188,217,249,237,215,211,101,163,104,87,83,60,110,
+	47,142,79,34,99,60,212,72,110,51,56,67,46,20,95,232,92,137,61,249,53,25,179,236,
+	100,41,38,132,108,85,174,19,150,184,174,149,138,155,82,139,178,185,165,241,78,42,180,112,
+	157,68,215,39,92,216,162,62,150,169,86,167,36,212,78,96,190,17,98,124,229,220,66,115,
+	184,169,112,138,66,33,93,104,78,51,137,18,45,86,137,16,148,66,207,94,38,196,72,73,
+	61,68,82,241,18,52,148,217,44,128,156,147,50,20,146,39,69,164,81,31,190,126,253,219,
+	154,38,133,122,217,141,42,42,99,110,209,219,84,229,27,111,214,245,167,20,35,201,10,43,
+	34,197,174,136,141,101,63,177,51,19,127,74,28,233,204,232,139,37,45,94,67,210,182,239,
+	73,99,214,82,166,87,229,76,138,95,147,45,60,144,180,64,139,103,62,220,22,106,156,180,
+	80,190,18,69,75,33,73,77,163,243,164,132,83,245,98,150,200,153,9,51,100,170,196,136,
+	83,108,246,153,162,255,104,87,0,181,58,152,163,36,118,81,164,166,169,23,187,69,221,117,
+	234,37,46,83,45,44,178,168,142,226,209,73,218,154,85,165,210,201,20,77,84,128,180,138,
+	105,217,66,211,83,73,123,183,51,202,100,76,242,22,242,45,19,31,201,162,132,110,17,53,
+	109,232,239,83,150,112,145,9,36,145,17,36,130,35,149,128,71,74,212,68,190,154,45,121,
+	37,83,144,190,162,97,52,154,239,86,153,38,95,178,196,198,66,146,34,244,70,68,93,249,
+	183,157,191,167,52,155,80,215,122,186,101,123,91,161,45,84,226,73,104,245,237,39,185,20,
+	42,165,210,137,11,114,213,197,157,50,71,212,145,205,76,162,167,242,108,128,179,75,56,109,
+	200,125,246,136,88,247,153,172,109,231,146,236,196,136,132,84,141,136,150,223,167,35,83,181,
+	136,145,119,105,47,87,211,182,239,81,76,128,148,100,154,139,90,46,57,84,141,98,77,5,
+	218,215,173,36,127,174,23,10,179,173,36,178,86,236,182,162,78,188,84,22,180,146,145,75,
+	137,200,65,43,36,118,144,220,86,75,121,17,232,149,200,18,150,152,213,237,43,174,36,171,
+	69,34,66,66,42,248,235,18,18,212,43,162,80,139,69,56,154,39,0,87,179,47,72,38,
+	138,89,219,162,89,87,46,27,74,226,42,166,190,77,199,19,123,231,55,101,74,73,8,227,
+	208,72,213,179,111,115,37,145,57,4,220,201,116,178,107,171,254,87,164,89,28,190,86,154,
+	147,43,72,127,34,241,78,202,101,20,234,214,187,22,213,42,142,214,149,234,101,16,40,251,
+	80,226,243,215,9,17,19,132,69,89,23,223,92,221,211,136,77,65,66,135,86,106,102,234,
+	35,202,252,84,45,179,100,86,164,139,230,164,77,0,138,39,79,21,69,127,209,136,158,142,
+	150,166,175,39,18,70,141,92,214,178,122,138,196,162,74,90,82,137,247,100,17,162,107,228,
+	210,173,69,216,41,184,81,234,45,70,124,89,161,22,118,23,132,175,141,204,146,213,161,72,
+	173,4,145,16,136,132,75,69,77,137,18,147,79,152,146,84,137,121,54,154,75,17,0,197,
+	37,138,212,45,164,116,16,162,187,39,99,165,5,21,113,169,36,244,242,238,111,134,61,146,
+	29,126,35,99,52,172,138,198,103,54,105,28,91,73,158,224,149,23,145,148,146,86,165,90,
+	56,154,50,46,215,66,90,211,250,161,121,41,92,87,122,70,148,187,162,154,149,62,68,56,
+	187,234,250,144,200,173,116,67,27,73,52,217,146,147,149,160,132,77,25,219,165,95,62,191,
+	218,75,36,136,179,254,45,240,66,143,16,219,74,68,132,37,23,103,244,92,237,29,216,149,
+	107,122,41,166,86,18,78,177,164,233,75,142,217,123,151,15,133,236,157,36,139,75,83,168,
+	202,214,145,109,85,52,37,165,36,192,219,207,46,115,34,222,81,57,73,101,25,149,50,145,
+	49,42,77,29,21,169,79,66,68,60,156,137,63,235,253,229,136,178,37,59,106,225,9,41,
+	243,161,20,64,146,82,19,100,72,138,124,206,10,132,181,169,19,145,33,36,113,236,114,81,
+	219,194,77,34,84,137,145,98,132,36,228,134,227,183,164,133,19,102,101,145,64,147,138,79,
+	82,213,17,170,170,242,180,202,229,122,164,78,57,36,100,93,247,9,171,39,118,178,244,93,
+	217,54,174,46,74,230,146,185,144,46,34,137,57,44,150,89,173,184,182,234,100,155,124,137,
+	114,179,8,145,102,133,28,102,72,242,136,217,191,187,75,143,25,54,163,57,68,39,90,74,
+	139,192,229,27,174,46,151,56,185,178,170,220,23,229,230,221,229,54,159,39,22,150,202,74,
+	178,56,146,101,245,34,69,177,10,165,174,180,45,190,216,132,182,243,144,147,107,144,151,120,
+	209,174,169,10,122,114,214,40,162,150,153,215,23,164,45,61,121,18,175,20,106,249,242,197,
+	49,71,196,143,213,128,227,34,34,39,178,132,42,110,162,18,76,73,91,76,213,36,87,242,
+	147,182,73,115,73,71,229,170,115,114,175,213,197,62,60,182,178,216,181,75,184,186,95,23,
+	173,113,119,147,78,150,87,21,78,173,17,171,169,150,114,242,229,47,113,73,205,74,212,91,
+	87,116,186,139,39,45,96,107,237,242,22,244,212,33,83,221,218,85,83,237,189,90,155,145,
+	102,65,36,230,40,138,143,118,39,150,117,225,17,18,72,138,34,37,18,82,157,154,66,242,
+	73,103,197,21,250,106,242,164,90,216,148,153,58,203,215,144,215,46,181,38,202,21,148,210,
+	36,85,47,222,143,188,233,187,46,191,72,187,161,99,142,89,175,146,52,197,184,136,144,238,
+	131,132,113,174,78,107,42,85,73,142,21,52,213,42,182,77,16,151,186,26,172,155,83,235,
+	17,208,122,37,9,8,17,52,41,16,75,112,149,181,117,72,166,130,33,33,49,122,202,73,
+	191,225,11,69,47,87,17,184,81,141,249,244,189,82,18,66,177,81,40,130,185,113,61,95,
+	46,113,119,78,85,202,45,85,170,202,166,95,75,106,166,85,20,156,77,28,82,117,228,228,
+	167,252,178,154,78,156,64,77,188,233,78,114,198,213,195,91,32,155,76,210,81,234,158,200,
+	210,93,171,84,153,211,218,101,20,80,206,18,105,164,162,101,89,194,95,184,92,182,192,149,
+	148,238,68,198,184,173,10,218,57,52,46,121,57,146,29,41,121,220,179,218,74,249,42,118,
+	148,41,38,77,77,137,218,45,92,101,173,196,148,39,39,205,58,165,38,133,174,228,249,229,
+	187,210,121,105,157,17,67,142,158,158,222,36,111,76,154,73,72,91,36,179,36,149,36,147,
+	35,72,36,203,64,60,75,138,168,244,217,27,243,147,66,225,39,166,137,73,196,66,106,71,
+	40,81,45,36,168,150,133,209,89,182,208,138,185,63,37,111,65,83,141,179,52,64,152,174,
+	189,90,244,186,38,83,66,117,39,100,154,150,92,238,22,233,101,82,210,171,75,92,77,98,
+	78,19,244,35,201,78,164,242,214,147,112,238,91,159,148,214,45,162,212,125,195,136,253,105,
+	31,22,152,72,138,52,51,136,166,180,93,243,138,132,33,101,150,202,217,61,55,146,177,229,
+	174,186,164,212,196,37,249,17,71,254,150,88,172,133,20,164,226,106,45,252,225,36,47,245,
+	106,228,66,166,226,51,145,90,71,41,9,18,121,80,133,206,36,144,84,141,194,159,151,36,
+	228,87,18,221,144,168,142,125,187,75,156,210,200,166,74,146,23,203,117,199,166,153,73,90,
+	106,215,43,169,235,21,32,85,232,216,169,36,229,159,9,186,162,91,56,90,17,22,228,161,
+	19,155,198,127,223,179,85,66,112,68,81,21,114,210,201,157,250,204,81,201,34,40,224,138,
+	45,26,200,137,174,35,168,157,17,60,173,66,140,90,105,68,241,82,151,168,165,233,122,169,
+	221,78,251,158,164,208,169,229,42,178,235,208,93,243,122,46,155,175,52,106,37,68,75,255,
+	70,122,37,153,250,18,44,202,145,20,232,217,185,229,72,182,179,46,130,200,170,215,158,245,
+	188,137,64,113,77,11,173,37,18,146,32,93,204,228,209,168,144,36,41,210,165,234,45,146,
+	95,44,138,20,18,237,166,107,113,19,140,241,113,212,161,17,81,86,214,141,101,28,157,56,
+	45,186,215,173,28,159,105,66,169,220,139,210,47,58,234,199,21,17,111,83,178,117,40,147,
+	164,82,118,138,150,169,219,169,11,73,184,40,132,137,116,69,145,89,16,145,44,226,137,151,
+	161,88,182,111,16,181,29,34,10,155,37,18,36,34,105,30,103,148,52,78,123,190,249,16,
+	139,96,246,210,76,171,215,178,235,43,165,59,223,123,154,26,36,142,85,171,133,170,237,234,
+	48,147,147,182,202,210,56,70,132,173,50,37,58,82,113,0,206,180,70,132,205,174,155,71,
+	234,110,209,104,173,215,54,210,9,183,38,144,177,180,145,57,232,205,232,213,82,244,76,181,
+	202,90,90,19,55,155,77,160,41,31,150,226,137,90,178,36,146,186,79,77,54,168,136,139,
+	75,145,37,112,177,5,94,41,23,200,178,218,159,54,130,209,189,38,119,114,137,194,146,174,
+	85,167,41,63,91,162,206,82,74,60,78,165,171,174,235,42,106,74,166,173,235,173,169,73,
+	201,234,148,210,241,105,70,170,43,32,137,27,244,34,20,55,72,138,205,71,45,188,164,34,
+	121,37,109,147,37,68,84,102,220,155,233,84,78,66,78,196,150,83,119,155,213,23,80,179,
+	145,56,107,89,18,168,184,94,235,97,38,145,41,242,165,76,37,95,175,114,214,146,100,74,
+	228,148,73,223,41,207,42,75,226,49,67,34,228,86,185,48,108,168,188,180,66,169,41,75,
+	201,173,19,207,148,145,207,92,149,41,162,74,208,179,246,151,150,78,63,201,209,34,156,212,
+	53,61,212,157,122,192,19,98,164,144,205,239,19,55,232,120,145,27,36,72,188,132,216,132,
+	173,244,62,107,15,214,137,165,229,196,37,166,138,110,108,253,9,5,66,73,18,39,220,66,
+	152,157,41,50,104,180,113,115,165,11,165,87,107,20,106,237,69,153,76,139,214,169,173,90,
+	202,79,241,54,87,210,47,212,83,165,56,142,18,76,122,35,113,73,70,167,203,205,162,92,
+	183,241,19,94,62,75,100,161,43,34,104,90,66,36,153,70,150,148,137,226,46,45,179,92,
+	165,235,100,66,202,246,144,163,159,34,214,75,21,233,75,233,36,126,155,65,40,174,106,237,
+	208,138,55,246,116,39,20,225,26,72,174,46,68,147,149,201,184,169,250,200,66,91,169,34,
+	71,148,165,70,177,205,62,23,171,31,149,249,34,74,145,79,219,77,210,175,45,194,177,52,
+	136,201,57,62,208,89,148,249,99,162,88,106,242,85,176,164,21,183,90,90,66,181,149,229,
+	155,37,102,200,86,237,148,146,133,197,61,19,133,171,74,115,133,177,8,228,38,167,173,108,
+	43,168,192,151,246,149,26,203,229,68,234,213,170,147,138,117,69,181,202,228,233,97,71,35,
+	161,35,180,141,92,41,59,83,174,117,244,145,57,211,163,73,137,36,90,100,178,87,33,111,
+	41,182,202,197,121,168,73,114,45,8,136,158,47,153,145,102,174,254,197,202,40,67,154,99,
+	108,247,194,43,175,200,128,228,228,143,159,235,226,92,90,77,33,117,69,28,84,123,235,39,
+	70,242,121,24,132,154,78,139,142,82,53,213,26,148,210,214,78,108,178,147,112,68,205,99,
+	217,53,18,136,238,210,188,161,74,228,247,189,30,162,112,228,187,168,209,109,111,71,244,11,
+	202,27,201,185,138,215,101,35,204,78,136,172,123,132,34,22,149,90,67,179,32,69,97,254,
+	109,254,73,16,180,37,118,84,75,92,166,205,161,122,42,163,72,208,165,229,38,147,186,140,
+	169,146,111,188,133,85,107,137,244,78,43,235,101,53,21,101,87,118,74,223,22,90,244,229,
+	117,41,73,202,170,167,42,43,147,181,10,61,58,73,128,93,70,54,154,190,149,23,233,34,
+	90,178,36,159,212,186,235,208,73,45,122,20,83,172,226,187,166,155,223,68,76,72,47,72,
+	116,216,137,51,160,178,68,38,16,146,69,207,78,231,183,240,45,9,207,166,183,232,189,250,
+	206,66,56,158,75,196,165,144,150,133,82,41,87,164,237,86,17,85,63,34,81,226,82,180,
+	71,166,151,210,172,116,191,146,16,230,167,252,233,78,133,39,73,122,206,75,105,84,180,150,
+	93,8,154,53,26,41,38,215,212,98,35,45,235,147,210,225,61,46,68,81,186,151,56,139,
+	210,164,90,92,139,79,57,200,137,11,179,118,189,164,73,154,126,252,188,183,138,53,100,60,
+	139,101,238,232,173,124,211,75,216,167,21,236,141,23,72,154,191,42,116,90,117,42,90,237,
+	92,83,44,154,117,246,169,201,194,229,26,144,107,164,146,82,69,152,204,245,55,37,71,110,
+	191,242,43,43,99,231,10,28,38,55,47,181,81,81,74,72,77,66,86,227,113,58,76,163,
+	113,77,192,202,183,34,111,180,164,37,9,83,178,30,170,52,145,203,17,52,43,150,202,211,
+	201,151,217,90,81,54,229,18,115,73,45,168,138,215,45,20,146,16,137,41,118,91,150,83,
+	36,223,232,134,164,92,118,166,178,139,211,76,197,207,201,62,21,90,74,210,52,18,157,90,
+	81,101,147,80,150,165,57,81,0,163,54,124,100,35,75,226,106,215,145,79,83,72,172,255,
+	165,180,147,133,36,75,221,22,167,191,136,82,47,55,245,31,9,24,236,231,114,100,73,144,
+	73,164,153,107,98,254,84,37,86,187,79,156,76,133,86,158,43,80,165,171,213,60,85,222,
+	94,233,150,190,94,45,100,245,85,34,57,60,128,146,136,78,75,97,56,206,20,133,118,44,
+	178,34,147,65,8,147,58,125,160,182,165,166,119,55,33,36,123,179,60,230,162,159,167,68,
+	145,9,204,105,89,175,110,45,178,162,104,89,93,132,142,43,102,222,162,180,125,205,112,163,
+	132,210,18,115,133,56,185,204,162,44,137,41,107,212,146,158,246,130,153,94,53,160,226,47,
+	212,210,81,161,26,150,226,245,137,170,178,185,234,77,73,75,85,55,90,113,33,83,73,196,
+	151,57,76,166,163,93,21,20,101,148,232,64,155,27,37,40,252,154,164,218,68,21,40,167,
+	27,103,42,213,239,68,151,225,228,36,228,146,236,86,147,80,69,55,108,150,40,213,153,35,
+	151,158,156,240,153,91,84,82,113,165,35,154,147,100,133,228,154,85,46,145,43,212,196,39,
+	19,93,46,89,66,211,168,141,197,53,76,166,69,167,201,73,86,69,128,23,234,47,20,141,
+	232,42,79,63,28,153,23,107,136,170,49,17,20,66,136,132,154,89,14,17,22,151,90,212,
+	69,98,95,19,212,82,34,36,196,68,74,35,34,192,98,213,133,75,39,84,121,101,16,75,
+	146,98,81,71,155,105,237,251,111,204,173,36,225,54,112,145,73,89,153,242,114,200,182,167,
+	55,68,91,124,54,69,128,150,186,215,19,154,185,33,82,171,82,45,27,41,56,174,248,201,
+	125,47,170,75,130,106,245,57,113,70,82,215,148,143,197,36,118,43,73,128,150,137,143,147,
+	58,93,58,90,110,43,186,142,186,52,146,20,102,165,115,182,91,145,27,148,141,162,34,8,
+	239,173,56,133,167,105,69,33,8,80,66,8,132,241,35,70,84,177,78,200,145,210,98,78,
+	173,115,180,75,159,89,101,107,92,147,90,38,191,202,40,228,150,136,233,50,139,38,163,214,
+	101,79,128,158,226,232,148,223,38,118,219,202,78,90,244,80,143,143,85,172,164,190,77,113,
+	37,45,16,244,145,24,202,57,81,77,85,89,241,45,20,153,56,164,34,178,211,73,45,68,
+	36,178,75,50,164,34,102,219,132,90,142,62,90,113,101,230,223,55,73,233,202,194,162,185,
+	114,74,146,229,24,213,177,218,175,161,106,149,57,210,181,41,28,182,171,78,158,46,81,212,
+	197,177,35,88,179,181,101,82,139,185,58,171,157,173,86,172,232,183,100,36,175,35,105,122,
+	73,40,168,35,85,16,74,70,86,175,185,42,169,221,166,141,151,34,201,122,219,83,196,86,
+	110,212,34,124,234,36,121,189,171,175,201,90,115,146,151,208,175,58,89,208,169,108,147,137,
+	201,202,136,190,33,127,110,78,62,72,36,173,55,234,123,21,18,250,154,76,162,40,170,86,
+	136,137,75,202,102,91,155,86,47,218,228,164,133,100,82,184,70,229,138,119,124,117,198,160,
+	146,108,248,242,141,220,155,119,89,36,154,67,253,214,189,211,196,17,23,36,68,35,212,209,
+	45,179,111,107,201,155,34,100,73,19,100,72,75,212,73,54,70,249,164,139,65,38,162,38,
+	239,86,246,109,136,44,173,41,90,154,203,85,77,82,185,202,140,138,221,114,229,167,106,80,
+	158,43,215,11,213,138,114,149,234,89,210,200,246,137,194,190,139,192,163,114,67,30,137,146,
+	61,113,194,86,222,145,5,25,235,238,45,165,234,226,161,45,34,136,164,98,79,60,144,73,
+	76,75,88,148,186,42,34,144,180,72,84,170,88,80,146,38,212,252,34,107,188,90,51,40,
+	180,75,73,52,170,237,146,102,175,137,190,36,164,156,47,31,84,37,79,126,79,92,185,20,
+	251,68,125,148,150,50,133,233,41,216,168,189,254,118,146,253,164,164,156,84,81,117,46,187,
+	210,38,168,190,169,20,213,184,188,82,90,146,113,32,210,233,122,178,209,61,234,154,124,74,
+	72,95,139,45,197,119,166,115,60,244,103,213,8,184,189,178,33,66,18,65,219,163,34,225,
+	116,38,247,240,188,149,127,74,45,114,185,9,241,39,18,106,45,149,117,22,197,237,45,210,
+	138,74,149,68,229,46,42,162,229,17,197,71,81,57,75,169,160,68,137,56,46,71,146,144,
+	170,170,92,162,72,224,158,180,145,94,178,16,130,138,107,90,45,143,183,94,249,37,120,141,
+	144,186,58,103,113,35,111,141,24,207,105,27,165,139,54,29,205,21,217,230,79,154,188,133,
+	51,237,169,159,204,132,137,228,138,174,79,33,76,109,235,73,201,209,50,44,151,165,9,46,
+	48,165,164,90,18,148,210,117,24,163,90,136,245,151,221,33,230,81,165,206,105,107,181,36,
+	148,203,104,165,19,186,146,89,53,8,178,101,154,186,114,102,202,132,186,209,80,146,36,208,
+	163,41,150,72,145,164,118,40,68,20,137,68,164,78,20,136,166,229,68,76,167,234,223,222,
+	10,102,245,55,4,151,68,75,32,148,215,164,251,230,190,197,203,78,42,28,139,226,231,109,
+	21,169,109,66,221,105,138,170,242,164,98,74,235,147,69,238,234,200,216,182,168,203,41,111,
+	217,231,157,214,20,226,104,163,147,36,45,36,99,126,215,209,88,232,206,219,44,146,118,230,
+	123,161,52,76,105,11,211,41,247,169,55,173,128,66,141,180,104,37,17,2,41,125,106,225,
+	74,102,137,90,240,165,172,138,38,178,226,82,242,47,114,17,34,11,40,154,77,17,173,23,
+	74,114,68,43,107,202,200,165,45,42,236,89,37,19,186,226,227,202,17,213,93,42,150,166,
+	234,101,138,212,183,37,46,105,79,190,57,106,114,127,75,145,120,128,79,8,145,17,254,107,
+	174,250,125,116,138,17,41,154,11,68,175,241,200,118,104,141,18,51,58,100,46,179,209,18,
+	140,173,117,95,9,108,207,44,210,144,177,38,220,138,85,111,205,127,165,217,19,169,245,37,
+	199,10,86,76,77,92,75,37,255,165,18,57,79,76,166,84,197,52,138,154,173,221,16,51,
+	38,55,9,103,217,165,180,177,45,205,236,241,197,228,70,114,33,162,69,73,100,37,189,19,
+	73,39,56,207,85,112,183,33,17,158,73,145,55,8,153,136,147,56,90,89,84,169,45,76,
+	137,15,180,184,150,74,133,202,42,10,116,141,165,19,102,173,17,182,82,169,68,137,166,139,
+	45,147,80,189,164,236,91,93,72,163,100,147,84,158,178,106,90,85,151,22,86,146,178,116,
+	77,28,158,201,53,202,197,124,165,85,138,196,180,180,81,220,147,150,92,125,35,162,91,132,
+	233,197,156,150,54,239,146,52,72,104,86,111,209,40,246,110,165,165,21,180,75,72,151,82,
+	81,22,252,202,49,9,8,182,34,105,34,72,44,166,184,77,101,173,57,117,9,116,71,147,
+	101,137,178,119,41,109,34,89,108,165,42,189,77,163,202,175,254,73,172,92,82,14,69,105,
+	54,250,101,164,200,151,247,219,18,91,214,229,201,33,90,174,118,228,242,156,66,38,146,39,
+	243,187,178,71,100,155,246,156,212,154,131,52,36,108,165,249,222,143,8,53,36,154,22,77,
+	72,180,81,117,103,216,167,11,196,41,33,226,158,98,244,137,168,82,182,166,34,123,89,53,
+	204,166,212,203,47,44,84,142,9,58,20,208,154,213,146,166,187,71,82,167,110,196,158,186,
+	75,50,218,139,146,165,93,170,221,11,42,93,221,175,45,104,122,90,166,78,91,22,210,48,
+	92,167,9,159,22,228,148,161,146,10,54,81,113,66,235,231,241,74,62,120,139,133,74,137,
+	18,149,40,147,188,137,68,90,92,162,21,114,210,89,64,136,190,210,230,150,72,167,138,228,
+	39,10,206,73,28,20,180,159,23,36,151,222,163,159,250,121,162,121,41,160,158,233,82,79,
+	109,210,147,114,120,47,101,202,37,153,13,31,169,100,158,137,55,100,114,102,176,147,37,99,
+	144,168,85,157,154,235,50,155,133,226,105,73,84,136,170,39,99,137,56,90,188,150,210,115,
+	244,150,81,36,101,52,149,150,169,59,220,106,175,171,76,124,137,8,154,33,52,190,134,206,
+	19,63,51,150,217,151,33,21,16,217,140,165,8,128,185,28,84,230,93,106,22,190,66,59,
+	36,226,152,163,68,234,214,170,117,53,214,138,159,80,157,75,154,159,37,194,174,92,166,162,
+	238,128,104,66,126,243,73,117,132,170,111,61,154,20,101,27,68,156,148,210,180,34,172,75,
+	36,146,110,14,210,5,10,88,218,36,99,104,180,91,72,158,16,149,36,37,32,75,181,18,
+	229,37,153,70,137,144,139,174,22,197,145,98,114,69,181,178,238,80,87,85,37,150,164,101,
+	235,188,156,162,245,222,42,92,201,81,178,242,138,36,74,53,15,85,170,229,18,76,159,34,
+	233,99,146,171,80,229,59,55,202,153,150,139,149,75,228,248,133,190,184,133,141,150,178,153,
+	136,89,33,109,205,144,147,163,142,61,17,29,19,141,31,30,133,68,223,35,72,167,83,130,
+	174,36,98,113,197,254,184,132,139,105,217,19,158,148,73,239,56,32,168,212,78,165,175,185,
+	45,37,35,171,85,78,47,37,164,115,36,92,81,217,93,169,213,38,93,149,202,237,63,81,
+	83,212,202,40,105,16,44,109,98,149,109,57,19,17,23,78,68,153,236,80,81,154,66,122,
+	18,249,137,52,173,251,244,145,222,82,197,52,36,90,18,80,147,34,252,104,132,81,106,112,
+	114,106,254,139,181,194,180,242,90,197,58,35,105,26,106,201,69,9,38,121,42,34,106,76,
+	169,47,189,55,25,205,28,153,19,74,154,243,114,76,80,113,35,181,105,56,136,158,42,103,
+	161,28,42,109,125,170,168,226,210,220,148,145,73,45,201,163,201,38,84,39,38,154,79,73,
+	232,189,50,148,146,240,23,44,81,9,194,143,163,136,201,8,162,27,34,36,130,134,138,209,
+	118,126,61,25,255,57,250,79,8,87,79,13,244,158,155,246,219,89,162,113,102,123,31,176,
+	173,119,92,151,201,116,79,233,203,149,184,170,201,93,89,124,47,215,82,156,77,83,163,139,
+	133,233,42,57,34,117,165,53,10,105,96,177,87,122,45,236,242,51,93,182,230,235,231,8,
+	157,206,234,33,27,17,55,166,29,201,252,50,17,75,43,200,147,212,218,165,45,99,208,145,
+	249,22,157,23,126,101,209,73,105,74,90,80,138,34,157,197,52,86,139,150,196,210,139,149,
+	57,72,42,106,200,155,212,169,81,45,166,210,173,101,197,128,68,174,133,157,52,91,170,79,
+	81,116,139,247,139,50,220,126,147,213,173,37,172,183,43,201,95,242,185,168,148,181,53,74,
+	56,71,197,217,128,160,207,156,156,147,173,17,77,162,219,158,234,38,148,168,68,42,124,100,
+	21,182,249,9,68,251,72,146,190,86,209,231,188,164,153,203,170,244,34,128,132,226,69,167,
+	42,101,210,180,133,25,42,85,114,146,159,91,68,209,113,210,235,68,42,127,77,81,113,81,
+	19,66,213,18,180,46,138,126,150,72,34,201,200,112,145,151,236,244,38,40,202,93,103,228,
+	164,87,118,73,200,139,223,73,41,209,164,161,157,52,208,220,42,21,254,150,73,101,23,36,
+	204,231,142,201,116,241,81,42,121,90,68,164,34,53,166,203,237,122,41,87,170,43,228,229,
+	76,209,144,75,18,17,111,158,215,68,138,114,46,172,196,128,146,73,177,35,181,171,235,237,
+	210,184,173,250,203,252,155,117,164,163,100,202,171,83,181,35,42,93,227,75,157,150,87,36,
+	62,205,110,36,89,161,40,73,215,110,18,82,75,18,122,72,243,82,17,118,102,106,132,35,
+	108,178,9,95,146,17,32,136,68,73,234,25,54,130,41,30,175,107,68,72,68,112,165,64,
+	212,85,228,228,147,77,23,147,164,71,21,106,36,121,53,194,117,41,38,46,95,199,114,125,
+	246,47,74,105,115,201,127,107,151,205,114,244,166,234,241,205,209,57,52,161,151,205,183,164,
+	113,31,161,54,154,79,86,36,155,138,146,86,200,254,137,22,146,58,77,168,90,35,116,91,
+	68,179,176,128,137,69,45,100,87,50,166,222,132,154,71,202,20,100,90,50,181,20,253,4,
+	143,189,9,155,187,178,149,50,103,87,146,209,167,228,53,16,162,171,90,209,35,136,249,16,
+	237,39,234,36,187,139,148,78,167,74,146,235,249,63,139,66,244,66,60,82,122,139,133,77,
+	91,178,37,173,82,165,162,73,0,159,71,162,90,62,254,178,82,235,182,127,145,56,39,210,
+	207,68,94,86,72,182,132,248,133,199,29,44,226,136,75,161,70,226,146,55,203,31,89,128,
+	86,196,170,170,201,50,164,78,156,95,78,148,36,121,53,200,230,83,185,46,101,161,122,201,
+	83,86,170,172,154,137,26,101,121,62,68,113,83,158,232,255,103,72,154,252,189,16,158,182,
+	169,186,114,139,46,71,101,105,150,244,106,54,35,112,182,190,115,227,164,90,9,39,187,83,
+	130,34,219,128,72,72,17,98,37,107,154,40,82,109,219,65,44,164,235,106,41,8,75,106,
+	76,122,19,211,145,90,214,225,116,37,66,41,74,229,204,157,42,17,231,40,64,74,82,92,
+	178,54,81,52,85,73,213,89,41,49,76,178,154,85,210,213,158,169,170,182,184,94,187,92,
+	214,83,43,87,11,98,226,35,174,128,163,77,138,177,74,45,61,77,218,99,117,76,201,213,
+	105,156,153,169,179,231,137,50,141,34,47,209,113,38,202,190,22,210,205,63,136,164,148,137,
+	28,215,162,187,244,91,138,82,174,43,93,173,43,180,183,250,38,148,231,33,28,23,209,117,
+	9,218,133,92,216,167,244,81,98,145,76,143,79,128,63,215,162,90,113,25,165,73,162,76,
+	69,217,173,34,109,79,200,206,202,107,146,101,60,147,136,146,236,251,212,114,199,65,110,138,
+	166,115,91,194,225,128,36,161,93,249,22,169,54,73,187,197,73,116,93,26,44,158,178,74,
+	26,121,11,157,181,155,253,46,81,93,54,41,100,180,68,198,211,222,180,78,96,132,121,122,
+	233,122,239,94,164,178,151,115,87,82,246,166,177,77,11,173,56,166,161,59,172,171,241,115,
+	164,165,119,53,210,180,173,24,68,224,137,4,241,16,242,226,89,125,179,77,39,17,8,180,
+	61,154,237,231,11,164,246,136,132,186,228,167,190,122,94,211,161,41,52,141,43,35,196,109,
+	139,150,197,185,108,168,147,34,114,23,80,162,108,181,205,66,46,39,84,91,89,17,109,109,
+	194,45,46,52,213,175,151,142,106,123,20,105,185,114,78,112,74,119,201,104,152,146,82,156,
+	169,100,60,79,53,123,119,5,210,84,139,144,188,86,79,66,51,185,70,174,91,76,167,33,
+	8,183,89,193,54,228,66,192,54,209,122,253,250,63,221,239,139,110,156,210,145,39,4,70,
+	66,68,108,113,188,74,79,203,100,81,126,92,42,68,196,69,200,217,150,69,147,66,138,73,
+	54,138,101,101,114,117,34,140,137,210,17,217,78,214,84,237,42,162,212,251,73,84,211,180,
+	157,87,147,228,92,37,124,151,21,114,233,114,128,110,28,122,73,4,78,39,42,66,69,149,
+	86,125,233,182,21,33,185,177,41,169,8,190,55,26,244,92,89,233,110,33,39,254,90,206,
+	37,144,137,93,240,76,144,145,91,182,93,10,83,82,230,182,180,172,74,45,105,201,50,210,
+	91,180,74,66,248,142,78,45,50,38,162,220,146,42,50,210,159,82,254,78,83,203,153,235,
+	196,228,201,85,81,113,20,94,132,221,161,70,94,185,237,39,73,71,75,55,60,219,36,126,
+	71,116,73,63,26,10,78,116,151,0,205,73,104,137,116,215,162,83,205,244,177,251,196,141,
+	104,91,33,92,145,68,43,116,110,60,137,10,132,132,149,104,164,34,165,254,10,196,122,253,
+	58,160,185,138,173,84,141,69,174,229,25,69,212,78,36,118,83,42,185,20,212,183,76,181,
+	37,115,75,139,215,73,79,138,106,142,20,158,170,88,103,98,206,18,217,68,88,168,236,218,
+	114,38,83,162,137,56,136,148,145,20,156,180,218,21,17,100,83,68,173,117,55,54,156,68,
+	34,34,108,151,59,73,216,38,164,70,151,26,150,113,41,4,77,34,173,36,230,245,184,237,
+	23,209,46,166,203,121,162,176,146,103,246,159,52,79,139,59,126,83,238,56,89,96,141,39,
+	211,84,147,180,207,149,37,90,148,155,226,153,254,177,16,205,115,73,178,158,234,215,41,235,
+	45,102,176,169,73,206,219,77,150,165,232,92,82,137,18,226,121,17,126,140,113,61,206,130,
+	185,238,68,138,228,162,161,250,34,76,162,36,153,184,201,82,230,31,163,251,49,40,130,50,
+	72,154,148,136,133,103,52,78,137,52,158,81,146,101,82,114,201,202,236,189,84,235,69,95,
+	107,139,241,70,139,168,182,45,168,82,235,46,222,82,126,133,208,228,153,79,208,184,69,55,
+	66,136,92,52,155,81,43,183,18,138,52,74,34,5,18,153,145,87,44,44,75,76,214,68,
+	148,132,38,107,125,148,69,20,113,74,128,81,39,167,113,58,59,41,78,20,90,11,209,78,
+	74,249,184,143,223,91,111,47,170,34,57,234,180,172,253,235,147,68,121,17,247,250,114,44,
+	161,111,46,145,61,68,125,49,85,104,170,75,184,214,162,75,166,121,35,122,19,147,106,23,
+	137,19,106,21,151,55,183,100,83,246,139,146,105,75,143,39,16,179,101,200,137,255,163,205,
+	81,75,57,85,146,36,154,152,169,233,169,190,22,222,172,174,146,80,200,185,73,196,67,34,
+	223,163,62,182,230,178,46,137,112,151,105,194,178,69,175,245,167,69,91,178,181,145,218,168,
+	163,20,152,186,245,218,28,90,21,68,106,80,92,73,216,145,216,163,184,225,106,218,162,69,
+	234,127,209,92,147,195,227,146,218,49,18,58,126,59,145,100,140,58,46,70,43,87,172,182,
+	138,100,37,43,63,38,133,50,22,55,8,42,133,38,124,71,239,212,87,138,138,80,81,16,
+	178,105,71,182,130,34,37,202,98,153,44,164,154,214,233,17,31,163,83,58,164,153,82,39,
+	111,39,25,0,140,151,72,157,164,186,78,41,47,41,42,171,45,87,26,73,66,213,221,105,
+	50,95,95,28,148,165,197,164,147,197,230,139,223,38,41,214,141,136,82,8,75,167,209,87,
+	157,51,237,159,252,83,68,39,171,99,136,73,22,195,54,99,67,133,106,52,69,164,114,21,
+	69,104,68,201,26,89,17,80,140,138,128,186,45,185,116,140,153,74,158,156,140,90,164,154,
+	180,98,154,185,210,110,87,36,212,90,169,90,104,155,95,105,63,21,146,179,20,78,73,100,
+	128,100,223,11,173,17,69,36,180,185,45,28,34,90,106,159,11,37,104,78,156,84,36,146,
+	36,201,8,165,53,206,33,237,228,200,78,161,36,138,236,200,88,160,34,33,90,121,38,231,
+	239,244,132,218,182,66,61,164,178,138,55,190,217,81,71,34,61,236,235,54,241,162,137,28,
+	138,43,139,144,166,240,242,185,189,216,137,73,93,87,166,79,22,79,81,119,41,84,85,74,
+	107,43,165,107,68,156,213,122,175,151,10,213,94,78,139,149,95,17,181,69,48,163,219,95,
+	213,37,72,175,100,79,17,126,118,69,17,25,22,136,161,211,26,17,177,210,100,42,108,132,
+	72,184,81,160,69,205,219,59,211,31,121,108,170,224,138,71,19,78,138,228,163,238,46,114,
+	47,68,250,249,90,184,197,169,138,74,172,166,151,249,213,10,50,93,57,26,45,168,210,45,
+	112,169,240,233,118,171,118,76,214,63,226,164,246,218,250,211,201,19,183,171,38,45,93,8,
+	149,20,229,236,121,103,23,39,38,95,157,148,144,68,154,121,160,69,102,185,214,130,10,97,
+	20,153,115,169,17,45,158,208,180,45,186,246,122,136,163,63,217,241,56,152,208,173,8,147,
+	116,132,139,210,249,54,136,209,241,8,64,196,250,105,210,242,134,88,158,177,93,113,119,65,
+	78,74,233,241,101,151,47,81,77,66,210,205,69,178,43,107,21,151,125,26,101,19,95,165,
+	128,33,36,34,68,73,164,116,56,136,89,52,183,32,146,72,89,122,245,197,9,8,179,20,
+	138,41,165,52,155,114,17,162,113,228,138,86,84,34,66,148,38,61,197,27,96,220,166,55,
+	69,74,216,147,122,17,98,172,219,157,104,226,172,81,191,60,174,47,112,85,194,69,173,196,
+	233,111,118,154,33,217,244,50,178,156,94,64,111,92,117,39,37,220,212,150,90,38,151,71,
+	150,221,116,105,175,77,172,147,75,218,253,26,200,92,52,154,201,143,164,173,178,206,101,46,
+	73,32,22,46,226,233,18,224,132,97,255,126,43,22,121,81,80,156,158,74,159,35,242,157,
+	206,210,16,165,25,196,69,80,210,145,38,206,144,42,80,151,180,141,128,181,211,73,194,249,
+	49,77,92,40,203,77,57,18,118,146,218,197,153,45,50,147,148,178,238,168,188,84,234,213,
+	76,149,186,23,209,109,90,152,155,58,116,103,165,230,236,36,38,117,34,137,233,183,39,212,
+	66,92,36,137,36,181,18,138,102,219,74,203,142,101,250,90,90,72,230,125,198,170,144,101,
+	106,73,105,47,82,92,229,194,77,180,104,171,66,181,221,46,33,89,237,11,220,186,43,201,
+	34,230,141,20,174,36,116,200,37,146,52,148,45,136,196,221,101,36,110,10,170,127,159,92,
+	150,147,105,9,159,10,37,142,147,196,168,232,41,151,220,249,164,162,212,37,107,68,178,136,
+	148,68,104,154,122,69,202,17,27,210,138,115,221,45,101,39,182,177,76,161,9,77,168,227,
+	89,147,173,83,113,17,34,143,137,68,162,59,57,103,239,138,56,210,28,92,176,187,172,147,
+	74,235,20,209,56,182,81,40,229,78,203,86,88,150,151,92,147,93,39,87,197,226,211,117,
+	170,44,170,116,47,82,113,88,147,120,221,30,43,41,156,196,141,34,226,244,84,56,34,142,
+	50,40,147,186,215,201,238,136,162,87,210,16,138,170,212,105,194,37,84,163,90,72,74,85,
+	128,74,214,139,61,196,211,86,185,56,185,197,115,93,217,194,37,162,100,174,94,74,70,214,
+	56,217,183,253,163,201,70,175,26,68,249,120,249,223,96,132,177,108,73,186,201,45,87,167,
+	72,154,84,229,229,244,21,189,122,72,121,98,184,244,206,59,95,228,237,50,82,212,89,85,
+	70,253,169,210,94,145,101,37,114,75,17,69,47,119,178,118,83,130,41,155,148,34,186,46,
+	4,80,222,132,138,82,175,221,47,145,43,90,73,42,18,18,19,138,77,128,89,35,165,149,
+	251,75,234,146,157,42,174,70,180,181,36,233,212,156,38,186,73,197,124,155,82,203,202,173,
+	200,213,126,158,200,156,184,192,144,148,45,105,74,237,89,229,109,171,130,252,197,11,20,137,
+	56,36,66,220,155,253,70,77,181,58,9,14,20,166,109,51,243,51,228,143,54,246,74,69,
+	160,68,207,116,133,184,144,217,73,49,18,146,153,89,10,158,126,242,221,13,46,45,18,228,
+	100,150,164,18,19,139,255,72,36,104,157,45,110,133,23,127,144,128,204,157,39,44,114,40,
+	236,89,146,89,52,236,181,196,189,59,72,189,203,121,9,141,69,202,57,5,26,68,141,65,
+	80,74,170,52,238,122,244,180,172,128,42,34,139,53,101,174,90,41,180,22,103,147,66,153,
+	200,78,66,146,165,197,209,219,89,39,173,193,18,83,81,34,242,17,9,66,186,98,37,22,
+	230,115,160,197,181,38,169,210,147,79,17,218,45,105,56,154,72,188,90,122,72,120,164,145,
+	70,145,98,146,165,181,28,167,211,234,113,115,138,35,146,170,211,200,189,207,189,42,75,108,
+	139,30,137,66,155,33,99,201,67,108,138,68,109,185,252,170,95,5,37,52,36,164,151,79,
+	166,218,36,82,116,154,66,66,80,219,81,22,232,169,239,153,57,118,69,201,206,35,139,178,
+	36,199,148,148,41,34,40,89,166,208,254,63,63,247,62,241,91,23,230,201,119,91,54,192,
+	142,132,136,251,17,229,254,226,237,75,174,91,78,43,63,85,107,38,190,66,59,208,235,148,
+	116,245,214,187,156,154,202,104,150,100,236,142,128,157,183,234,68,41,37,200,177,170,37,123,
+	164,150,36,53,146,159,63,41,26,139,25,194,71,82,69,52,137,13,10,37,210,66,91,103,
+	223,226,114,44,136,184,158,181,42,71,23,72,93,34,215,18,254,209,93,168,175,162,234,60,
+	185,194,106,83,212,237,61,52,106,68,108,88,184,171,168,84,154,128,201,152,132,93,82,191,
+	82,242,133,203,81,149,169,181,250,169,203,79,67,233,80,82,234,63,232,74,221,40,69,30,
+	200,138,157,155,249,66,154,16,84,78,248,165,234,37,198,245,105,10,132,242,41,22,132,242,
+	164,174,138,180,122,156,214,144,165,184,221,164,241,171,17,102,164,201,28,132,21,183,48,146,
+	78,79,114,191,148,85,175,42,105,148,210,147,162,141,90,19,233,115,85,53,148,190,200,226,
+	122,234,172,169,58,167,111,18,71,50,112,69,61,77,61,66,41,243,52,41,231,63,117,73,
+	156,19,136,66,19,101,180,166,74,17,49,241,51,242,65,23,161,5,57,36,244,37,150,54,
+	104,157,24,147,186,247,10,145,118,44,81,200,202,136,230,44,227,36,92,200,200,190,87,85,
+	36,37,47,221,136,153,106,212,229,22,137,237,53,141,42,68,77,66,146,92,192,62,42,77,
+	213,228,175,120,180,168,249,214,166,237,197,203,196,33,34,133,34,92,75,156,93,18,202,118,
+	44,151,162,57,92,88,137,21,39,18,43,165,31,78,98,40,173,150,145,178,68,146,233,95,
+	101,30,254,125,79,191,196,218,34,58,241,232,91,147,255,28,159,25,111,34,58,114,197,186,
+	192,165,168,92,232,73,173,35,83,139,98,189,84,245,46,87,69,82,189,82,157,196,230,147,
+	180,154,82,169,228,217,68,211,147,171,177,73,164,218,107,74,61,113,184,22,196,148,185,241,
+	54,34,200,175,32,179,226,225,51,226,220,18,70,242,36,17,54,61,53,36,141,89,8,36,
+	66,72,82,40,137,100,39,38,96,71,50,206,112,150,228,50,183,82,36,214,68,79,106,142,
+	50,162,211,116,236,136,201,86,153,103,36,146,19,89,106,88,181,29,70,159,121,235,34,146,
+	64,217,90,228,161,253,26,132,167,184,135,147,155,210,115,82,81,34,93,7,136,145,174,149,
+	218,203,40,34,214,145,196,154,218,199,21,95,108,205,230,180,92,78,73,124,9,19,57,252,
+	118,173,4,184,75,153,34,75,217,210,18,137,223,59,172,144,86,127,152,228,22,101,143,36,
+	200,168,228,82,69,228,74,94,148,142,92,212,165,153,66,140,43,250,170,138,93,107,136,242,
+	209,210,214,150,165,116,87,66,114,180,71,19,86,171,202,165,29,91,133,38,17,20,237,99,
+	177,153,250,37,101,20,132,138,203,200,172,254,144,146,230,164,130,73,52,142,75,140,100,179,
+	36,105,118,181,14,40,138,33,18,169,248,244,197,0,107,78,68,78,42,75,212,90,69,123,
+	126,74,34,105,215,253,74,205,53,141,66,221,208,86,83,35,178,226,69,194,79,126,237,94,
+	145,20,158,240,109,187,73,201,75,68,147,227,98,145,174,69,98,98,210,210,39,217,121,72,
+	179,73,188,187,234,82,131,40,138,130,72,237,105,220,87,181,36,136,218,72,146,212,34,81,
+	17,189,30,137,34,101,47,68,164,146,79,214,54,226,165,181,104,34,43,34,208,136,165,43,
+	59,98,71,191,73,46,155,34,16,179,109,60,64,139,93,125,85,35,151,50,187,172,170,169,
+	196,211,201,174,92,86,149,245,209,70,75,171,20,235,151,146,169,165,78,212,83,72,182,64,
+	211,39,242,111,17,22,62,140,230,111,121,71,221,66,66,22,209,178,41,235,73,41,151,102,
+	132,36,179,163,75,20,121,102,66,229,202,205,55,164,137,2,148,212,76,132,147,90,169,36,
+	86,34,213,86,138,18,158,250,69,16,156,233,125,237,87,218,15,145,29,61,23,150,163,170,
+	69,74,11,154,207,38,76,181,146,229,39,37,19,19,196,237,43,125,66,166,212,89,73,11,
+	49,20,190,19,53,52,158,76,184,237,78,34,36,250,156,35,237,169,250,73,84,128,22,161,
+	93,231,102,251,120,74,67,214,68,70,212,136,146,30,103,198,132,110,103,217,81,23,170,36,
+	146,105,17,203,86,214,136,161,34,68,163,98,92,149,248,184,186,151,52,186,165,45,53,45,
+	52,145,214,147,148,203,81,60,167,197,107,39,174,75,254,42,117,149,26,105,46,226,175,43,
+	161,122,123,34,120,222,38,139,232,74,85,138,112,82,169,24,210,104,91,20,162,110,202,104,
+	136,87,50,122,219,107,17,57,148,45,34,69,147,57,47,46,170,145,160,139,100,169,175,37,
+	196,167,180,173,90,111,70,130,68,43,40,228,185,196,147,157,211,178,22,138,178,231,137,68,
+	156,253,226,90,247,165,162,151,40,221,22,83,113,57,89,18,81,90,170,37,163,139,82,146,
+	221,92,165,102,210,118,132,233,94,145,37,60,162,112,143,62,90,189,106,245,148,134,221,37,
+	234,237,222,105,242,156,60,158,74,211,140,60,72,105,120,219,111,122,75,41,81,236,219,165,
+	121,185,34,35,250,37,72,251,204,219,148,139,90,92,255,89,82,46,59,45,241,77,90,23,
+	138,170,66,72,186,151,41,38,42,250,69,119,41,74,126,151,23,77,26,45,146,19,87,178,
+	128,46,255,38,89,118,83,55,154,108,200,147,111,232,180,39,16,158,95,156,180,45,164,222,
+	163,178,78,227,34,74,210,49,10,23,241,249,100,137,44,218,80,192,242,18,71,194,246,177,
+	145,40,152,137,150,238,202,105,180,151,188,73,145,109,23,38,150,74,21,119,201,68,118,141,
+	138,55,150,73,197,18,143,225,26,104,72,244,139,143,167,42,77,41,170,200,119,69,50,143,
+	138,59,36,232,140,178,118,68,212,85,223,212,169,36,244,91,225,46,38,162,142,9,78,162,
+	96,68,39,201,161,91,113,110,218,210,66,40,132,108,74,42,137,30,213,62,147,207,120,38,
+	124,36,183,173,166,120,244,132,122,162,202,210,227,164,142,212,179,167,139,163,22,78,94,163,
+	137,77,159,72,158,157,198,68,105,44,167,69,92,75,106,170,116,84,18,69,45,78,202,23,
+	246,209,81,83,50,181,64,41,214,36,164,92,146,21,45,44,226,121,237,121,52,140,136,82,
+	52,69,162,93,202,31,60,91,81,75,212,74,72,133,251,89,209,250,210,124,46,138,196,78,
+	83,119,253,207,230,73,90,37,164,217,81,5,33,238,234,162,141,198,200,145,90,144,130,37,
+	57,81,211,229,138,33,100,42,133,79,23,18,51,96,133,116,155,41,168,210,168,157,57,119,
+	206,203,241,91,245,151,81,91,146,74,89,149,234,199,35,178,82,38,150,142,104,169,216,165,
+	203,143,128,60,212,72,162,214,132,130,87,77,216,139,105,117,27,237,196,40,170,153,157,242,
+	127,80,82,220,68,74,242,18,221,237,46,21,167,68,84,214,208,136,148,158,245,98,210,221,
+	61,56,145,146,113,37,60,72,159,84,180,68,141,11,41,86,212,161,53,241,144,91,43,190,
+	214,173,10,206,197,62,44,202,192,17,86,210,137,164,49,121,144,159,200,67,33,117,43,66,
+	82,103,10,91,137,14,164,41,172,178,127,35,113,34,143,101,26,220,233,79,183,85,43,44,
+	196,221,69,206,243,37,76,201,20,167,137,233,70,102,235,138,163,244,56,180,73,150,202,178,
+	209,44,210,191,202,21,33,36,66,40,229,136,145,207,180,18,136,154,202,58,41,235,66,60,
+	190,169,60,181,74,125,104,164,251,202,113,43,154,89,101,52,171,201,196,235,85,107,174,161,
+	105,212,92,181,128,102,135,102,217,104,143,68,37,84,205,71,105,16,166,166,218,81,78,204,
+	132,147,94,81,47,120,154,33,92,210,200,138,70,150,218,223,214,140,255,82,89,0,178,146,
+	47,34,70,149,211,34,18,104,178,234,204,162,66,249,90,23,18,174,146,213,17,81,163,40,
+	114,43,79,33,56,173,105,113,10,90,23,252,242,93,21,18,104,40,147,105,141,238,19,150,
+	90,55,201,249,36,199,228,217,35,103,196,155,172,169,11,157,178,73,186,138,73,20,139,80,
+	73,22,47,34,107,24,189,241,229,232,63,84,141,43,17,90,181,16,145,154,204,215,146,20,
+	132,178,68,150,139,36,79,219,52,77,19,222,184,239,72,83,115,40,226,39,109,146,128,154,
+	185,212,150,169,87,43,162,56,90,164,226,141,69,73,85,221,41,117,22,169,127,92,167,107,
+	35,151,212,145,203,138,242,53,89,0,49,136,173,184,34,68,158,51,221,165,53,72,75,75,
+	130,18,18,4,90,41,242,109,133,46,88,167,171,34,36,137,56,38,202,36,137,10,116,164,
+	104,153,68,113,108,192,93,219,181,153,9,104,91,68,92,169,110,108,76,215,249,126,213,233,
+	90,255,137,52,84,55,153,196,231,43,149,127,181,221,163,197,136,225,75,201,247,29,107,47,
+	68,107,79,146,196,164,217,241,219,213,121,170,138,105,52,173,124,206,52,147,139,29,19,232,
+	158,191,41,122,46,132,43,182,68,89,17,37,241,250,121,10,255,133,254,218,165,68,90,122,
+	189,20,154,17,109,233,117,66,40,230,113,98,119,200,75,186,51,126,100,43,230,136,216,153,
+	114,202,146,227,90,78,101,26,46,19,97,90,105,42,90,122,159,149,149,108,169,39,72,187,
+	95,98,78,47,165,226,181,9,92,86,150,241,0,74,168,223,98,23,20,207,83,116,90,38,
+	200,73,200,92,210,22,65,89,241,154,105,23,121,37,20,200,72,138,162,66,38,163,156,17,
+	18,17,69,63,144,165,4,214,165,173,94,158,187,132,228,137,234,126,173,95,18,35,201,45,
+	36,228,177,87,89,242,59,237,239,242,218,173,11,134,210,153,118,117,56,66,122,236,81,52,
+	143,101,218,68,73,105,202,153,48,187,82,233,206,220,149,182,77,170,215,173,162,108,155,232,
+	166,66,27,148,123,73,254,212,74,192,106,69,51,110,144,162,17,22,253,179,156,133,189,249,
+	44,118,100,68,161,169,174,210,132,81,30,75,253,138,72,37,68,218,51,92,216,149,181,250,
+	17,14,100,128,153,21,242,105,169,162,163,149,9,86,183,196,78,138,202,170,217,71,66,85,
+	245,85,197,78,138,165,234,149,149,217,92,100,178,124,166,128,17,47,141,43,85,139,27,196,
+	155,144,93,186,66,110,148,232,73,45,221,203,86,236,208,146,21,170,17,17,50,138,196,171,
+	196,69,37,165,245,8,136,208,104,174,100,139,35,76,203,84,77,122,108,137,148,75,77,156,
+	40,143,20,81,9,82,160,138,21,209,232,127,215,29,181,57,16,210,246,200,86,175,252,248,
+	139,122,36,142,201,15,94,114,94,165,151,174,178,207,69,73,255,186,90,106,21,173,109,45,
+	19,235,59,68,244,246,147,63,164,171,187,77,128,163,73,191,201,18,226,45,8,150,105,170,
+	108,217,153,8,157,220,164,66,142,229,113,166,124,84,38,210,72,34,36,229,226,34,218,44,
+	245,157,189,205,214,128,73,49,35,81,73,178,145,202,84,210,37,203,171,87,53,17,247,232,
+	182,85,180,165,215,75,57,173,200,150,83,132,121,126,165,90,149,39,192,43,200,137,180,209,
+	226,216,254,75,116,164,68,73,147,54,75,244,157,61,20,91,66,45,92,121,36,155,79,106,
+	150,111,255,178,210,145,105,150,180,222,102,141,101,210,18,74,18,149,235,178,141,155,160,150,
+	170,104,170,250,18,102,159,118,33,68,182,69,136,89,121,4,161,42,137,50,211,124,246,188,
+	132,150,133,82,90,28,180,106,82,199,69,140,182,255,85,202,185,74,72,242,139,171,252,181,
+	150,212,79,177,30,166,72,208,182,169,78,73,110,116,150,139,148,90,56,180,124,90,141,66,
+	109,82,233,39,74,180,187,66,60,89,62,170,148,171,232,159,34,61,102,41,162,125,165,114,
+	174,71,84,192,202,145,42,210,83,77,113,234,23,10,169,87,82,36,249,204,137,162,173,45,
+	222,177,37,186,38,212,46,40,196,90,44,166,137,74,173,19,170,192,78,206,39,74,172,211,
+	254,122,85,20,142,250,220,132,134,222,145,34,218,148,92,232,247,246,169,36,101,106,40,161,
+	42,165,41,236,179,196,166,241,46,18,154,94,226,146,34,210,89,165,46,74,16,138,119,20,
+	34,61,146,64,146,121,166,34,162,22,150,105,157,113,17,77,82,245,26,92,169,21,254,75,
+	78,165,197,231,21,50,229,26,167,210,185,202,232,78,146,178,244,150,201,39,23,117,105,113,
+	119,106,146,120,90,238,71,170,44,106,32,103,55,221,25,35,200,184,110,140,233,176,219,137,
+	186,53,72,74,54,99,201,111,169,138,68,113,68,33,36,71,82,191,62,63,163,187,105,201,
+	185,34,132,154,137,145,233,79,183,38,136,68,113,50,234,228,136,137,221,240,84,87,234,123,
+	41,197,108,181,142,133,233,56,92,74,157,76,138,81,23,37,248,128,37,235,76,225,10,142,
+	114,14,135,244,68,212,181,34,68,141,54,137,90,57,93,18,211,72,147,70,153,194,72,188,
+	79,210,212,237,122,185,17,49,36,252,239,10,71,167,187,34,21,8,73,100,113,180,180,140,
+	222,51,133,69,37,74,157,45,86,141,99,162,76,190,17,24,165,89,33,194,77,136,95,182,
+	124,57,200,139,133,178,149,61,98,116,92,142,202,53,61,173,93,148,78,181,197,233,39,170,
+	245,114,166,178,221,20,53,113,56,189,86,156,181,196,116,164,202,74,34,72,138,71,162,118,
+	196,169,17,73,223,243,58,91,210,82,196,112,206,69,191,241,37,99,135,193,18,100,199,235,
+	136,133,145,120,171,146,22,128,77,34,163,237,29,165,164,153,70,137,75,34,242,150,146,211,
+	186,154,53,164,73,58,210,41,52,133,32,169,246,200,154,196,149,85,171,145,104,232,64,205,
+	66,103,101,188,230,45,63,20,209,21,52,222,180,172,173,201,67,90,181,186,8,206,9,45,
+	98,72,85,126,230,145,75,217,21,41,37,10,69,34,32,40,156,153,105,62,68,165,168,139,
+	105,233,76,74,91,163,139,35,69,36,74,243,94,92,169,223,143,73,17,39,68,210,145,38,
+	102,227,57,153,155,62,30,154,92,100,187,37,213,106,229,252,23,57,75,165,138,101,83,168,
+	165,57,119,177,70,167,17,165,46,59,81,166,181,53,23,149,173,74,160,154,151,23,250,45,
+	74,250,73,138,197,71,11,207,189,43,185,36,137,150,200,38,85,11,118,209,90,203,79,214,
+	232,145,110,196,216,191,233,47,218,181,203,178,155,231,43,106,70,133,17,194,175,180,92,132,
+	140,219,246,145,184,221,49,19,75,133,229,212,210,40,203,237,74,10,196,165,174,148,139,101,
+	31,137,166,170,214,76,181,229,150,86,78,63,114,204,138,191,222,85,147,132,76,86,227,127,
+	5,178,134,161,99,80,158,87,162,93,151,8,146,64,166,149,9,9,105,189,73,247,83,229,
+	125,49,17,37,21,163,81,46,251,65,109,238,18,145,78,141,110,82,138,211,36,218,36,38,
+	185,194,102,62,128,164,71,83,46,37,221,21,201,113,70,165,52,184,210,81,62,150,180,174,
+	66,56,82,229,177,77,33,75,87,180,249,85,113,85,43,212,244,136,73,223,31,251,169,124,
+	180,144,136,75,76,56,180,124,74,73,41,138,68,73,150,139,85,166,138,56,147,91,110,58,
+	54,82,76,73,59,159,28,65,40,147,44,162,22,66,146,181,66,162,87,207,65,22,95,181,
+	86,169,132,76,253,51,113,108,175,23,11,211,210,162,151,41,223,233,223,240,139,159,24,191,
+	69,68,200,150,163,88,213,98,226,205,100,205,69,157,172,74,110,77,169,46,77,211,165,37,
+	57,41,241,42,218,98,141,86,122,43,36,254,102,146,145,146,93,34,38,171,80,141,77,209,
+	56,155,106,63,213,217,105,55,114,77,145,37,61,228,84,214,73,19,109,30,122,122,164,93,
+	13,146,81,20,187,21,85,39,164,78,91,20,101,107,181,228,171,40,238,248,185,169,66,149,
+	175,226,157,139,133,41,91,18,53,36,165,222,169,171,157,136,162,138,77,4,84,225,8,220,
+	108,147,69,83,230,91,36,17,35,222,207,67,217,180,21,201,250,136,68,121,184,133,27,250,
+	36,138,130,249,92,214,105,126,209,0,157,208,151,51,246,201,33,19,37,164,46,225,18,57,
+	75,71,16,147,130,184,87,181,20,95,212,129,9,173,189,114,146,82,88,203,89,184,166,22,
+	105,80,128,87,217,113,57,213,19,149,23,197,81,52,146,68,181,37,162,104,216,162,226,197,
+	214,94,173,93,174,80,180,149,29,148,154,28,87,139,158,166,164,74,76,112,137,136,177,34,
+	44,69,162,86,255,108,109,60,55,218,238,98,41,122,45,136,164,205,249,185,229,27,147,134,
+	108,197,31,43,53,208,245,204,156,157,233,101,197,242,71,203,113,121,86,203,92,73,106,152,
+	174,21,52,239,68,112,79,150,132,210,153,70,146,211,148,78,234,154,33,77,19,178,208,72,
+	217,253,169,175,34,238,149,197,169,145,103,248,132,218,101,103,36,70,241,36,222,211,59,31,
+	240,81,202,202,82,84,199,137,39,68,149,168,81,45,0,52,137,23,66,242,45,255,173,17,
+	184,110,47,40,149,147,98,69,148,66,22,209,175,154,66,81,18,82,246,133,8,151,51,180,
+	90,35,244,174,156,194,89,236,146,203,106,185,235,189,17,40,211,81,171,221,148,232,162,234,
+	168,179,42,122,170,165,46,53,11,196,203,105,80,142,38,125,104,235,47,91,64,68,185,101,
+	18,84,138,50,95,61,50,82,20,160,153,156,19,119,190,218,16,149,164,155,213,43,153,236,
+	231,164,190,146,9,104,137,72,33,33,8,182,33,63,178,92,236,168,211,151,252,138,181,36,
+	189,169,241,45,100,184,79,226,177,105,168,163,98,101,194,250,229,87,149,201,171,186,124,133,
+	234,70,161,127,211,188,151,86,74,75,196,66,145,73,21,250,225,136,136,161,68,147,164,162,
+	146,180,180,74,40,68,36,216,148,90,244,230,139,219,150,83,148,135,133,40,74,88,146,34,
+	68,218,146,110,121,231,51,122,162,73,145,248,226,35,34,155,55,186,208,249,201,76,243,157,
+	181,181,145,118,100,212,163,139,137,64,141,125,171,76,75,146,94,69,45,56,169,194,211,171,
+	21,247,107,172,163,34,238,197,157,232,78,93,35,74,71,74,44,230,39,149,253,37,224,103,
+	232,79,44,200,170,89,211,114,205,165,41,162,44,186,10,65,105,153,218,204,163,103,84,237,
+	35,105,233,10,209,5,121,28,109,192,132,189,81,34,109,240,162,107,82,73,117,186,21,9,
+	219,180,39,81,43,101,19,53,139,50,156,78,20,148,146,165,22,139,82,172,185,220,138,215,
+	110,138,236,150,37,0,144,145,42,84,219,105,248,146,241,223,137,53,180,41,169,166,118,74,
+	244,206,68,217,101,53,113,69,185,56,136,189,239,107,69,50,70,57,38,113,18,36,161,23,
+	223,100,43,148,41,148,166,149,72,73,250,34,45,8,245,229,154,180,101,156,197,156,68,172,
+	232,253,183,81,76,154,145,173,145,68,212,74,155,64,146,85,197,77,45,189,106,244,167,53,
+	208,188,85,39,19,106,98,79,93,108,162,190,82,59,81,203,249,149,205,74,117,166,81,213,
+	53,192,110,94,66,218,244,173,161,9,189,110,182,56,208,165,155,140,234,69,17,33,90,122,
+	69,89,106,40,147,165,19,210,23,93,233,103,52,16,187,126,252,146,221,123,74,137,85,123,
+	68,142,101,160,138,107,152,132,105,21,73,244,167,69,67,178,81,219,82,69,18,138,202,180,
+	165,172,183,90,78,45,192,33,117,100,131,183,4,125,250,255,38,208,145,71,52,205,55,189,
+	36,246,169,164,73,52,217,18,181,86,74,22,148,160,139,88,179,133,36,116,236,169,64,49,
+	55,147,132,132,151,20,66,37,100,32,152,196,141,109,16,132,89,5,89,74,69,8,87,109,
+	232,72,133,47,146,37,148,168,228,115,30,69,17,55,9,66,22,185,18,149,85,165,57,58,
+	85,35,170,226,105,197,167,41,125,125,82,93,47,162,106,149,149,165,88,171,100,170,211,74,
+	151,59,46,139,98,172,74,47,229,149,196,170,74,66,39,21,166,101,240,78,39,220,162,165,
+	30,77,164,202,83,20,237,45,17,169,178,46,55,137,196,78,117,47,37,176,136,186,178,126,
+	228,142,85,217,175,19,202,161,115,226,229,121,237,186,203,81,208,163,126,221,63,81,229,222,
+	44,144,167,171,68,235,245,68,192,185,21,113,122,167,15,83,41,243,181,20,101,7,233,181,
+	9,30,211,34,91,201,29,43,237,200,169,105,103,161,48,237,114,39,201,30,92,102,196,70,
+	38,36,145,19,69,92,74,92,139,132,181,40,139,130,232,138,146,109,122,35,51,186,230,211,
+	90,146,34,108,148,45,57,52,146,154,78,147,227,181,83,177,86,101,170,149,92,244,167,42,
+	138,114,215,21,175,112,148,241,73,221,149,165,93,43,72,229,85,83,87,21,210,215,36,142,
+	214,128,75,209,219,72,162,253,190,81,81,8,181,33,184,100,90,200,71,161,73,46,46,202,
+	217,160,163,95,62,41,39,19,194,40,170,44,213,20,53,62,71,180,197,52,183,39,156,137,
+	52,154,109,187,228,225,30,69,251,206,43,201,236,137,167,21,68,228,141,164,71,185,76,69,
+	211,212,101,66,19,138,100,151,226,72,228,185,145,20,98,138,89,42,139,34,86,173,81,87,
+	17,228,161,49,108,156,104,184,245,100,182,158,175,161,102,133,223,138,53,57,125,218,31,200,
+	192,36,100,91,169,142,68,242,183,41,213,56,37,229,27,243,202,52,153,153,9,173,138,37,
+	114,35,50,9,51,30,151,70,121,158,71,148,138,100,40,136,178,136,68,160,133,25,90,101,
+	234,45,151,201,217,107,114,185,147,233,42,229,154,202,214,45,73,172,73,165,231,34,178,87,
+	201,210,203,46,244,113,57,93,32,113,62,16,165,140,155,233,149,41,203,153,187,66,142,70,
+	242,159,145,118,78,138,27,37,68,149,180,127,50,34,133,62,41,154,69,18,55,164,109,41,
+	142,141,85,233,90,85,58,143,240,182,133,250,112,91,37,22,87,83,105,98,113,241,139,221,
+	20,188,82,166,158,90,144,154,178,124,76,177,38,180,124,217,86,156,41,164,242,52,168,88,
+	200,159,34,116,163,82,133,42,106,213,22,237,210,139,249,31,211,162,158,143,145,60,74,110,
+	137,162,147,166,176,41,62,140,205,201,40,167,9,33,89,8,148,36,148,43,197,38,54,37,
+	4,71,118,74,34,73,39,250,203,98,136,145,54,41,88,182,156,201,120,204,66,209,38,224,
+	220,93,105,213,151,100,233,234,119,78,219,201,125,204,151,50,34,201,171,125,221,100,175,83,
+	187,233,105,167,148,158,42,106,113,82,44,103,164,151,221,107,168,139,171,125,249,154,69,110,
+	82,136,198,115,69,147,57,158,231,229,50,142,79,188,178,38,185,51,123,122,218,74,78,190,
+	81,27,73,164,136,233,13,180,241,69,77,104,181,191,18,87,154,41,41,182,82,11,148,74,
+	109,79,38,113,127,209,73,86,23,94,45,217,75,212,240,137,218,122,234,189,93,175,20,142,
+	168,167,165,244,189,33,77,90,42,57,59,170,181,83,188,92,118,146,145,203,173,203,201,47,
+	101,176,165,25,181,232,68,162,187,183,203,184,162,37,27,109,117,46,161,79,39,233,16,168,
+	175,63,100,45,138,109,211,185,31,20,68,149,8,141,34,181,128,180,157,18,178,107,147,218,
+	20,156,203,242,229,36,170,202,74,178,93,241,109,82,84,42,85,23,18,168,175,137,210,202,
+	206,88,91,235,36,81,11,34,20,136,90,148,202,215,20,164,178,102,178,74,88,136,206,174,
+	149,36,80,210,66,89,26,191,83,63,45,148,252,85,148,72,79,34,36,109,19,112,219,77,
+	185,159,55,194,187,82,35,141,146,178,252,109,103,242,201,57,41,199,232,191,47,101,107,200,
+	149,54,166,69,45,255,178,220,207,94,66,68,158,85,215,85,203,178,73,37,60,162,104,173,
+	220,202,169,84,164,197,56,171,209,77,77,46,46,115,149,62,36,95,66,242,249,242,232,49,
+	205,174,189,91,214,181,179,37,52,162,180,145,86,137,9,10,243,114,202,248,206,77,46,187,
+	252,178,89,21,53,110,116,66,77,118,68,83,136,170,151,197,101,55,115,150,137,167,82,149,
+	196,175,89,57,107,173,137,57,82,165,241,42,133,82,154,235,154,69,84,76,164,191,66,226,
+	238,233,21,244,171,82,36,150,169,184,220,206,83,103,109,165,229,21,53,246,234,73,234,122,
+	44,228,77,173,201,94,147,114,180,211,116,160,66,186,90,75,61,109,154,215,113,106,42,170,
+	187,36,136,191,73,63,149,81,84,170,136,145,50,142,214,214,85,108,180,155,213,43,82,44,
+	90,79,93,75,212,212,171,156,85,230,85,214,186,215,125,73,233,92,234,170,151,167,18,202,
+	59,72,185,110,202,252,147,234,93,128,220,191,150,202,254,36,169,87,73,108,146,110,213,244,
+	229,55,149,40,171,229,125,79,225,84,174,34,146,125,81,42,151,90,83,80,90,73,59,145,
+	114,163,251,245,105,255,194,241,47,249,73,110,75,214,181,223,117,82,86,210,73,83,187,85,
+	78,106,170,228,189,128,203,171,149,90,126,245,139,165,119,68,202,138,41,82,110,82,222,175,
+	210,184,170,107,249,122,115,229,213,33,89,186,164,183,73,36,247,138,90,247,205,73,38,191,
+	211,178,145,54,202,155,249,37,152,150,68,75,61,36,37,100,186,233,164,238,137,36,79,245,
+	164,183,170,21,182,192,186,148,253,72,146,18,85,190,110,69,107,182,74,125,168,169,150,254,
+	242,46,75,100,159,81,37,151,37,181,186,249,73,61,110,37,220,64,178,187,69,37,102,174,
+	233,74,93,29,86,236,150,151,59,201,118,36,84,247,173,145,41,125,93,62,100,68,171,191,
+	166,138,73,74,112,146,85,169,68,231,79,235,180,158,189,34,187,186,133,194,190,189,107,156,
+	146,87,38,164,168,181,146,106,137,226,212,148,173,107,171,32,100,185,16,139,190,27,78,109,
+	34,229,181,69,16,153,103,149,63,74,82,86,78,66,81,58,27,94,141,204,245,180,157,174,
+	141,249,22,68,78,115,123,73,203,90,116,37,162,169,74,107,73,127,109,8,181,105,174,146,
+	168,84,57,168,248,172,83,215,10,74,81,52,87,197,186,172,187,170,18,128,254,38,239,74,
+	214,75,81,105,252,155,143,124,75,234,178,144,173,121,95,175,181,37,59,144,148,153,110,36,
+	175,45,233,125,38,171,212,84,146,171,105,202,205,87,242,210,72,136,162,109,197,34,173,254,
+	139,138,235,87,93,36,255,109,209,77,62,83,169,113,92,165,68,248,71,107,219,229,229,70,
+	146,94,174,90,202,100,189,113,209,107,184,149,209,46,164,229,101,50,187,171,116,188,182,178,
+	142,92,101,217,78,173,221,84,72,148,68,69,62,95,123,222,69,234,236,138,86,156,18,223,
+	111,242,149,121,9,41,119,165,171,87,74,179,238,115,148,137,0,137,53,122,113,105,212,148,
+	214,38,210,173,69,196,165,245,90,47,45,59,186,168,150,237,151,68,70,139,105,52,90,233,
+	77,43,164,213,172,83,147,178,117,147,145,34,221,23,149,206,137,62,82,137,43,201,178,139,
+	229,75,40,186,146,47,178,235,101,154,77,201,95,109,82,116,150,132,172,166,89,34,205,54,
+	217,184,133,33,34,132,184,229,164,79,55,232,89,19,143,169,110,106,219,245,57,17,146,56,
+	132,210,74,200,146,165,100,159,36,192,154,71,11,169,107,201,222,186,95,44,142,232,175,148,
+	233,46,214,197,89,115,147,185,82,202,213,122,166,162,85,245,213,175,148,176,144,132,145,10,
+	228,230,132,75,9,43,52,201,75,136,180,74,253,8,132,41,49,17,5,76,251,145,85,164,
+	108,39,221,18,43,94,133,73,197,115,81,77,26,231,159,228,121,36,196,154,57,86,171,111,
+	245,149,42,226,51,217,180,166,175,194,84,50,69,41,177,92,83,231,117,30,142,211,132,209,
+	44,145,169,0,218,164,94,140,175,82,207,147,26,91,123,72,249,57,202,73,198,229,79,210,
+	237,42,89,33,22,154,84,180,142,45,245,205,236,159,109,164,152,128
+};
+
+static const uint16_t TrackStart[512] = {
+	0,40,75,115,155,194,235,272,313,352,392,434,
+	471,510,550,587,628,665,705,747,785,826,861,902,
+	942,978,1019,1058,1100,1140,1176,1217,1256,1294,1335,1371,
+	1412,1451,1489,1529,1565,1609,1649,1686,1725,1761,1801,1840,
+	1877,1917,1955,1998,2038,2075,2115,2153,2195,2232,2267,2305,
+	2343,2382,2424,2460,2500,2538,2576,2615,2650,2691,2732,2768,
+	2809,2846,2885,2924,2962,3003,3040,3082,3121,3158,3197,3233,
+	3270,3310,3347,3388,3425,3465,3507,3544,3583,3621,3660,3700,
+	3738,3779,3817,3856,3895,3931,3971,4009,4048,4091,4127,4167,
+	4206,4244,4284,4322,4361,4400,4437,4478,4514,4556,4597,4633,
+	4674,4711,4751,4790,4828,4871,4910,4948,4988,5025,5068,5105,
+	5143,5182,5218,5261,5300,5338,5379,5416,5458,5497,5536,5577,
+	5614,5656,5695,5732,5772,5810,5851,5890,5926,5966,6004,6047,
+	6088,6124,6164,6202,6241,6285,6321,6362,6399,6438,6476,6511,
+	6550,6587,6626,6668,6703,6743,6781,6821,6862,6899,6938,6978,
+	7015,7055,7092,7131,7171,7207,7250,7288,7328,7367,7402,7442,
+	7480,7518,7561,7598,7638,7676,7715,7755,7790,7831,7869,7908,
+	7948,7983,8021,8060,8097,8136,8172,8211,8250,8289,8328,8365,
+	8406,8446,8484,8524,8563,8606,8647,8684,8724,8763,8801,8840,
+	8875,8913,8950,8988,9030,9066,9107,9145,9182,9221,9257,9297,
+	9337,9375,9417,9453,9493,9534,9570,9610,9647,9690,9729,9766,
+	9807,9845,9883,9924,9960,9999,10037,10077,10118,10154,10197,10235,
+	10273,10314,10350,10392,10431,10470,10512,10547,10586,10624,10661,10700,
+	10737,10777,10816,10852,10896,10932,10972,11011,11049,11088,11125,11164,
+	11205,11242,11281,11318,11358,11397,11432,11473,11512,11552,11593,11629,
+	11669,11707,11746,11786,11822,11863,11902,11939,11980,12017,12059,12096,
+	12134,12173,12211,12251,12292,12328,12371,12409,12450,12490,12525,12566,
+	12603,12641,12683,12721,12765,12804,12842,12883,12920,12959,12998,13037,
+	13077,13113,13153,13191,13228,13268,13304,13345,13386,13426,13467,13505,
+	13545,13584,13621,13661,13698,13735,13775,13811,13853,13893,13931,13969,
+	14005,14049,14089,14128,14168,14204,14246,14284,14323,14365,14400,14441,
+	14479,14518,14559,14594,14635,14673,14710,14748,14785,14826,14867,14905,
+	14945,14983,15022,15062,15099,15138,15177,15217,15257,15293,15334,15373,
+	15414,15455,15490,15534,15571,15608,15647,15685,15727,15763,15802,15844,
+	15880,15920,15960,15997,16038,16075,16114,16154,16191,16228,16266,16303,
+	16343,16379,16419,16458,16498,16539,16575,16616,16655,16695,16735,16771,
+	16808,16846,16886,16925,16961,17001,17039,17077,17116,17152,17194,17235,
+	17272,17313,17351,17391,17432,17469,17510,17546,17585,17626,17663,17704,
+	17742,17782,17822,17858,17897,17935,17975,18019,18053,18092,18129,18168,
+	18207,18242,18282,18322,18361,18404,18441,18481,18519,18557,18600,18635,
+	18672,18711,18746,18785,18821,18862,18900,18935,18973,19008,19044,19080,
+	19114,19148,19182,19216,19254,19290,19325,19360,19399,19436,19471,19506,
+	19541,19577,19613,19649,19690,19724,19765,19804};
+
+const Track TerrainTrack = {512, 109, TrackStart, TrackData};
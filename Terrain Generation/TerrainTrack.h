@@ -0,0 +1,13 @@
+// TerrainTrack.h
+// Runs on TM4C123
+// Generated by Host/BakeTerrain.c, do not edit.
+
+#ifndef _TERRAINTRACKH_
+#define _TERRAINTRACKH_
+
+#include "Track.h"
+
+// A loop of 512 terrain rows, 109 heights wide
+extern const Track TerrainTrack;
+
+#endif
@@ -0,0 +1,41 @@
+// Track.c
+// Runs on TM4C123
+// Playback of terrain baked on the host into flash.
+
+#include <stdint.h>
+#include "Track.h"
+
+void Track_Row(const Track *t, uint32_t row, int32_t *out,
+               uint8_t first, uint8_t step, uint8_t count){
+	const uint8_t *p = t->data + t->start[row % t->numRows];
+	uint8_t bits = *p++, left = 8, i, want = first;
+	uint16_t v;
+	for(i = 0; count; i++){
+		// Zeros up to the one give v>>1, the bit after it the low bit
+		v = 0;
+		while(1){
+			if(!left){
+				bits = *p++;
+				left = 8;
+			}
+			left--;
+			if(bits & 0x80)
+				break;
+			bits <<= 1;
+			v += 2;
+		}
+		bits <<= 1;
+		if(!left){
+			bits = *p++;
+			left = 8;
+		}
+		left--;
+		v |= bits >> 7;
+		bits <<= 1;
+		if(i == want){
+			*out++ = (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+			want += step;
+			count--;
+		}
+	}
+}
@@ -0,0 +1,37 @@
+// Track.h
+// Runs on TM4C123
+// Playback of terrain baked on the host into flash. A track is a loop of
+// heightmap rows wide enough for every level of detail, so a fixed
+// flight path costs no noise at all, only a few hundred bit reads a
+// frame, and the first screen needs no generation before it shows.
+// Heights are stored as Rice codes with one fraction bit: zigzag value
+// v = 0, -1, 1, -2, 2 ... is sent as v>>1 zero bits, a one, then the
+// low bit of v. Small heights, by far the most common, take 2 or 3 bits.
+// Host/BakeTerrain.c produces the tables.
+
+#ifndef _TRACKH_
+#define _TRACKH_
+
+#include <stdint.h>
+
+typedef struct {
+	uint16_t numRows;       // rows in the loop
+	uint8_t width;          // heights in each row
+	const uint16_t *start;  // byte offset of each row into data
+	const uint8_t *data;
+} Track;
+
+//------------Track_Row------------
+// Read heights from one row of a track, every step-th from first on.
+// Row numbers past the end wrap around the loop.
+// Input: t      track
+//        row    row number, any size
+//        out    receives count heights
+//        first  first height wanted, 0 to width-1
+//        step   spacing between the heights wanted
+//        count  heights wanted, first + (count-1)*step below width
+// Output: none
+void Track_Row(const Track *t, uint32_t row, int32_t *out,
+               uint8_t first, uint8_t step, uint8_t count);
+
+#endif